@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// What BleManager needs from the BLE stack to send notifications. The
+// firmware implements it on the ESP32 GATT server; tools/ble_loopback.h
+// stands in for the stack and the radio on the host so the data paths can
+// be run against a simulated central.
+
+namespace ergo {
+
+// Characteristics the device notifies on or takes writes on.
+enum class BleChannel : uint8_t {
+  Vitals = 0,
+  HeartRate = 1,
+  Stream = 2,
+  Sync = 3,
+  File = 4,
+  // Vitals payload format; read and written, never notified.
+  Version = 5,
+};
+
+constexpr size_t kBleChannelCount = 6;
+
+class BleTransport {
+ public:
+  virtual ~BleTransport() = default;
+  // False when the stack did not take the notification, e.g. its queue is
+  // full or the central is gone. The caller decides whether to retry.
+  virtual bool notify(BleChannel channel, const uint8_t *data, size_t size) = 0;
+  // Whether the central enabled notifications on the channel.
+  virtual bool subscribed(BleChannel channel) const = 0;
+};
+
+}  // namespace ergo
@@ -0,0 +1,103 @@
+#include "codec_benchmark.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "recording_format.h"
+#include "sample_codec.h"
+
+namespace ergo {
+
+namespace {
+
+constexpr float kTwoPi = 6.2831853f;
+
+struct SyntheticSource {
+  uint32_t rng = 0x2545F491U;
+  uint32_t timestampMs = 0;
+  uint32_t frame = 0;
+  float motion = 0.0f;
+
+  int32_t noise(int32_t amplitude) {
+    rng = rng * 1664525U + 1013904223U;
+    return static_cast<int32_t>((rng >> 8U) % (2U * amplitude + 1U)) - amplitude;
+  }
+
+  // 25 Hz PPG with a 72 bpm pulse on an 18-bit DC level, and a wrist IMU at
+  // rest with short bursts of movement every few seconds.
+  void next(int32_t *out) {
+    const float t = static_cast<float>(frame) / 25.0f;
+    const float pulse = sinf(kTwoPi * 1.2f * t) + 0.3f * sinf(kTwoPi * 2.4f * t);
+    motion = (frame % 200U) < 20U ? 1.0f : motion * 0.9f;
+    timestampMs += 40U + static_cast<uint32_t>(noise(1));
+    out[kRawChannelTimestampMs] = static_cast<int32_t>(timestampMs);
+    out[kRawChannelIr] = 118000 + static_cast<int32_t>(1400.0f * pulse) + noise(24);
+    out[kRawChannelRed] = 96000 + static_cast<int32_t>(900.0f * pulse) + noise(24);
+    out[kRawChannelAccelXmg] = static_cast<int32_t>(120.0f * motion * sinf(t * 9.0f)) + noise(6);
+    out[kRawChannelAccelYmg] = static_cast<int32_t>(80.0f * motion * cosf(t * 7.0f)) + noise(6);
+    out[kRawChannelAccelZmg] = 1000 + noise(6);
+    ++frame;
+  }
+};
+
+}  // namespace
+
+float CodecBenchmarkResult::ratio() const {
+  return encodedBytes > 0U ? static_cast<float>(rawBytes) / encodedBytes : 0.0f;
+}
+
+float CodecBenchmarkResult::encodeMbPerSecond() const {
+  return encodeUs > 0U ? static_cast<float>(rawBytes) / encodeUs : 0.0f;
+}
+
+float CodecBenchmarkResult::decodeMbPerSecond() const {
+  return decodeUs > 0U ? static_cast<float>(rawBytes) / decodeUs : 0.0f;
+}
+
+CodecBenchmarkResult runCodecBenchmark(uint32_t blocks, uint16_t framesPerBlock,
+                                       MicrosClock clock) {
+  CodecBenchmarkResult result;
+  if (clock == nullptr || framesPerBlock == 0U ||
+      framesPerBlock > kCodecMaxBlockSamples) {
+    result.roundTripOk = false;
+    return result;
+  }
+
+  static int32_t frames[kCodecMaxBlockSamples * kRawChannelCount];
+  static int32_t decoded[kCodecMaxBlockSamples * kRawChannelCount];
+  static uint8_t encoded[maxEncodedBlockSize(kRawChannelCount, kCodecMaxBlockSamples)];
+  const size_t capacity = maxEncodedBlockSize(kRawChannelCount, framesPerBlock);
+
+  SyntheticSource source;
+  for (uint32_t block = 0; block < blocks; ++block) {
+    for (uint16_t i = 0; i < framesPerBlock; ++i) {
+      source.next(&frames[i * kRawChannelCount]);
+    }
+
+    const uint32_t encodeStart = clock();
+    const size_t size =
+        encodeSampleBlock(frames, kRawChannelCount, framesPerBlock, encoded, capacity);
+    const uint32_t encodeElapsed = clock() - encodeStart;
+
+    const uint32_t decodeStart = clock();
+    const bool decodedOk =
+        decodeSampleBlock(encoded, size, kRawChannelCount, framesPerBlock, decoded);
+    result.decodeUs += clock() - decodeStart;
+
+    result.encodeUs += encodeElapsed;
+    if (encodeElapsed > result.worstBlockEncodeUs) {
+      result.worstBlockEncodeUs = encodeElapsed;
+    }
+    result.encodedBytes += static_cast<uint32_t>(size + kBlockHeaderSize);
+    result.rawBytes += framesPerBlock * kRawFrameBytes;
+    result.frames += framesPerBlock;
+    ++result.blocks;
+    if (size == 0U || !decodedOk ||
+        memcmp(frames, decoded, framesPerBlock * kRawChannelCount * sizeof(int32_t)) != 0) {
+      result.roundTripOk = false;
+    }
+  }
+  return result;
+}
+
+}  // namespace ergo
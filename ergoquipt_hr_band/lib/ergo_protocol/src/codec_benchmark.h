@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+// Synthetic PPG/IMU workload for the sample codec. The same routine runs on
+// the band (ERGO_CODEC_BENCHMARK build) and in the host tool so ratios and
+// throughput can be compared directly.
+
+namespace ergo {
+
+struct CodecBenchmarkResult {
+  uint32_t blocks = 0;
+  uint32_t frames = 0;
+  // Raw size counts the in-memory capture layout: 4 bytes each for timestamp,
+  // IR and red, 2 bytes per IMU axis.
+  uint32_t rawBytes = 0;
+  uint32_t encodedBytes = 0;
+  uint32_t encodeUs = 0;
+  uint32_t decodeUs = 0;
+  uint32_t worstBlockEncodeUs = 0;
+  bool roundTripOk = true;
+
+  float ratio() const;
+  float encodeMbPerSecond() const;
+  float decodeMbPerSecond() const;
+};
+
+using MicrosClock = uint32_t (*)();
+
+CodecBenchmarkResult runCodecBenchmark(uint32_t blocks, uint16_t framesPerBlock,
+                                       MicrosClock clock);
+
+}  // namespace ergo
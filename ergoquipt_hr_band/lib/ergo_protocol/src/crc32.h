@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ergo {
+
+// CRC-32 (IEEE 802.3, as used by zlib). Calls chain: passing the result of
+// one call as `crc` continues the checksum over the next buffer.
+uint32_t crc32(const uint8_t *data, size_t size, uint32_t crc = 0);
+
+}  // namespace ergo
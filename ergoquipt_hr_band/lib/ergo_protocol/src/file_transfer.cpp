@@ -0,0 +1,160 @@
+#include "file_transfer.h"
+
+#include <cstring>
+
+#include "crc32.h"
+#include "recording_format.h"
+
+namespace ergo {
+
+bool parseFileCommand(const uint8_t *in, size_t size, FileCommand &command) {
+  if (in == nullptr || size < 1U) {
+    return false;
+  }
+  command = FileCommand{};
+  command.opcode = static_cast<FileOpcode>(in[0]);
+  switch (command.opcode) {
+    case FileOpcode::List:
+      if (size < 5U) {
+        return false;
+      }
+      command.sequence = readLe32(in + 1);
+      return true;
+    case FileOpcode::Read:
+      if (size < 11U || in[5] > 1U) {
+        return false;
+      }
+      command.sequence = readLe32(in + 1);
+      command.erg = in[5] == 1U;
+      command.offset = readLe32(in + 6);
+      command.window = in[10];
+      return command.window > 0U;
+    case FileOpcode::Ack:
+      if (size < 5U) {
+        return false;
+      }
+      command.offset = readLe32(in + 1);
+      return true;
+    case FileOpcode::Stop:
+      return true;
+  }
+  return false;
+}
+
+size_t serializeFileCommand(const FileCommand &command,
+                            uint8_t out[kFileCommandMaxSize]) {
+  out[0] = static_cast<uint8_t>(command.opcode);
+  switch (command.opcode) {
+    case FileOpcode::List:
+      writeLe32(out + 1, command.sequence);
+      return 5;
+    case FileOpcode::Read:
+      writeLe32(out + 1, command.sequence);
+      out[5] = command.erg ? 1U : 0U;
+      writeLe32(out + 6, command.offset);
+      out[10] = command.window;
+      return 11;
+    case FileOpcode::Ack:
+      writeLe32(out + 1, command.offset);
+      return 5;
+    case FileOpcode::Stop:
+      break;
+  }
+  return 1;
+}
+
+size_t fileEntrySize(const FileEntry &entry) {
+  const size_t length = strnlen(entry.name, kFileNameMaxSize);
+  return kFileEntryHeaderSize + length;
+}
+
+size_t serializeFileEntry(const FileEntry &entry, uint8_t *out) {
+  const size_t length = strnlen(entry.name, kFileNameMaxSize);
+  writeLe32(out, entry.sequence);
+  writeLe32(out + 4, entry.size);
+  out[8] = entry.flags;
+  out[9] = static_cast<uint8_t>(length);
+  memcpy(out + kFileEntryHeaderSize, entry.name, length);
+  return kFileEntryHeaderSize + length;
+}
+
+bool parseFileEntry(const uint8_t *in, size_t size, size_t &offset, FileEntry &entry) {
+  if (offset > size || size - offset < kFileEntryHeaderSize) {
+    return false;
+  }
+  const uint8_t length = in[offset + 9];
+  if (length > kFileNameMaxSize || size - offset - kFileEntryHeaderSize < length) {
+    return false;
+  }
+  entry.sequence = readLe32(in + offset);
+  entry.size = readLe32(in + offset + 4);
+  entry.flags = in[offset + 8];
+  memcpy(entry.name, in + offset + kFileEntryHeaderSize, length);
+  entry.name[length] = '\0';
+  offset += kFileEntryHeaderSize + length;
+  return true;
+}
+
+size_t serializeFileData(uint32_t offset, const uint8_t *bytes, size_t count,
+                         uint8_t *out) {
+  out[0] = static_cast<uint8_t>(FileFrameType::Data);
+  writeLe32(out + 1, offset);
+  writeLe32(out + 5, crc32(bytes, count));
+  memcpy(out + kFileDataHeaderSize, bytes, count);
+  return kFileDataHeaderSize + count;
+}
+
+bool parseFileData(const uint8_t *in, size_t size, uint32_t &offset,
+                   const uint8_t *&bytes, size_t &count) {
+  if (in == nullptr || size < kFileDataHeaderSize ||
+      in[0] != static_cast<uint8_t>(FileFrameType::Data)) {
+    return false;
+  }
+  offset = readLe32(in + 1);
+  bytes = in + kFileDataHeaderSize;
+  count = size - kFileDataHeaderSize;
+  return crc32(bytes, count) == readLe32(in + 5);
+}
+
+void FileSender::start(uint32_t offset, uint8_t window, uint32_t nowMs) {
+  next_ = offset;
+  acked_ = offset;
+  window_ = window > 0U ? window : 1U;
+  lastAckMs_ = nowMs;
+  resends_ = 0;
+}
+
+void FileSender::ack(uint32_t offset, uint32_t nowMs) {
+  if (offset - acked_ >= 0x80000000U) {
+    return;
+  }
+  acked_ = offset;
+  lastAckMs_ = nowMs;
+  // An ack for chunks sent before a go-back can pass next_.
+  if (next_ - acked_ >= 0x80000000U) {
+    next_ = acked_;
+  }
+}
+
+bool FileSender::checkTimeout(uint32_t nowMs, uint32_t timeoutMs) {
+  if (next_ == acked_ || nowMs - lastAckMs_ < timeoutMs) {
+    return false;
+  }
+  next_ = acked_;
+  lastAckMs_ = nowMs;
+  ++resends_;
+  return true;
+}
+
+bool FileSender::nextChunk(uint32_t end, size_t chunkSize, uint32_t &offset,
+                           size_t &count) const {
+  if (chunkSize == 0U || next_ >= end ||
+      next_ - acked_ >= static_cast<uint32_t>(window_) * chunkSize) {
+    return false;
+  }
+  offset = next_;
+  count = end - next_ < chunkSize ? end - next_ : chunkSize;
+  return true;
+}
+
+}  // namespace ergo
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Recording download over the file characteristic. The central pages through
+// the recordings on the SD card with List, then asks for one file with Read
+// from any byte offset, so an interrupted download resumes where it stopped.
+//
+// The device answers Read with Data notifications while fewer than `window`
+// chunks are unacknowledged, goes back to the last ack when acks stop, and
+// sends Done once everything up to the readable end is acked. Each chunk
+// carries its file offset and a CRC-32 of its bytes; the central drops a
+// chunk that does not start at its next offset or fails the CRC, and may send
+// Read again from that offset instead of waiting for the ack timeout. A file
+// still being recorded is readable up to the recorder's last commit; its Done
+// has kFileFlagActive set and a later Read picks up the rest.
+// All multi-byte fields are little-endian.
+
+namespace ergo {
+
+constexpr size_t kFileCommandMaxSize = 11;
+constexpr size_t kFileDataHeaderSize = 9;
+constexpr size_t kFileListHeaderSize = 3;
+constexpr size_t kFileEntryHeaderSize = 10;
+constexpr size_t kFileNameMaxSize = 39;
+constexpr size_t kFileDoneSize = 6;
+constexpr size_t kFileErrorSize = 2;
+
+// FileEntry and Done flags.
+constexpr uint8_t kFileFlagErg = 1U << 0;
+constexpr uint8_t kFileFlagActive = 1U << 1;
+// List page flag.
+constexpr uint8_t kFileListLast = 1U << 0;
+
+enum class FileOpcode : uint8_t {
+  // sequence u32: list recordings from this sequence on.
+  List = 1,
+  // sequence u32, kind u8 (0 .csv, 1 .erg), offset u32, window u8 = chunks
+  // in flight.
+  Read = 2,
+  // offset u32 = next byte the central expects.
+  Ack = 3,
+  Stop = 4,
+};
+
+enum class FileFrameType : uint8_t {
+  // flags u8, count u8, then count entries in (sequence, .csv before .erg)
+  // order. A page holds all files of each sequence it names.
+  List = 1,
+  // offset u32, crc32 u32 of the bytes, then the bytes.
+  Data = 2,
+  // flags u8, readable size u32.
+  Done = 3,
+  // FileError u8.
+  Error = 4,
+};
+
+enum class FileError : uint8_t {
+  NoCard = 1,
+  NotFound = 2,
+  // The MTU leaves no room for a list entry or a data chunk.
+  MtuTooSmall = 3,
+  ReadFailed = 4,
+};
+
+struct FileCommand {
+  FileOpcode opcode = FileOpcode::Stop;
+  uint32_t sequence = 0;
+  bool erg = false;
+  uint32_t offset = 0;
+  uint8_t window = 0;
+};
+
+// sequence u32, size u32, flags u8, name length u8, then the name (no
+// terminator, at most kFileNameMaxSize bytes).
+struct FileEntry {
+  uint32_t sequence = 0;
+  uint32_t size = 0;
+  uint8_t flags = 0;
+  char name[kFileNameMaxSize + 1] = "";
+};
+
+constexpr size_t fileChunkSize(uint16_t mtu) {
+  return mtu > 3U + kFileDataHeaderSize ? mtu - 3U - kFileDataHeaderSize : 0U;
+}
+
+bool parseFileCommand(const uint8_t *in, size_t size, FileCommand &command);
+size_t serializeFileCommand(const FileCommand &command,
+                            uint8_t out[kFileCommandMaxSize]);
+
+size_t fileEntrySize(const FileEntry &entry);
+// Returns the entry size; `out` must hold fileEntrySize(entry) bytes.
+size_t serializeFileEntry(const FileEntry &entry, uint8_t *out);
+// Parses the entry at `offset` and advances it; false if truncated.
+bool parseFileEntry(const uint8_t *in, size_t size, size_t &offset, FileEntry &entry);
+
+// Returns the frame size, kFileDataHeaderSize + count.
+size_t serializeFileData(uint32_t offset, const uint8_t *bytes, size_t count,
+                         uint8_t *out);
+// False if the frame is truncated or its bytes fail the CRC. `bytes` points
+// into `in`.
+bool parseFileData(const uint8_t *in, size_t size, uint32_t &offset,
+                   const uint8_t *&bytes, size_t &count);
+
+// Device-side window bookkeeping for one Read, shared by the firmware and
+// the host simulator. Offsets only move forward except for go-back.
+class FileSender {
+ public:
+  void start(uint32_t offset, uint8_t window, uint32_t nowMs);
+  // Acks only move forward.
+  void ack(uint32_t offset, uint32_t nowMs);
+  // Goes back to the last ack if none arrived for `timeoutMs`; returns true
+  // when it did.
+  bool checkTimeout(uint32_t nowMs, uint32_t timeoutMs);
+  // The next chunk to send, or false while the window is full or everything
+  // up to `end` was sent.
+  bool nextChunk(uint32_t end, size_t chunkSize, uint32_t &offset, size_t &count) const;
+  void sent(size_t count) { next_ += static_cast<uint32_t>(count); }
+  bool complete(uint32_t end) const { return acked_ >= end; }
+
+  uint32_t next() const { return next_; }
+  uint32_t acked() const { return acked_; }
+  uint32_t resends() const { return resends_; }
+
+ private:
+  uint32_t next_ = 0;
+  uint32_t acked_ = 0;
+  uint8_t window_ = 1;
+  uint32_t lastAckMs_ = 0;
+  uint32_t resends_ = 0;
+};
+
+}  // namespace ergo
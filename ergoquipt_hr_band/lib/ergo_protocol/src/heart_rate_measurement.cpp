@@ -0,0 +1,90 @@
+#include "heart_rate_measurement.h"
+
+#include "recording_format.h"
+
+namespace ergo {
+
+size_t serializeHeartRateMeasurement(const HeartRateMeasurement &measurement,
+                                     const uint16_t *rr1024, size_t rrCount,
+                                     uint8_t *out) {
+  uint8_t flags = 0;
+  size_t offset = 1;
+  if (measurement.bpm > 0xFFU) {
+    flags |= kHrmFlagHeartRate16;
+    writeLe16(out + offset, measurement.bpm);
+    offset += 2U;
+  } else {
+    out[offset++] = static_cast<uint8_t>(measurement.bpm);
+  }
+  if (measurement.contactSupported) {
+    flags |= kHrmFlagContactSupported;
+    if (measurement.contactDetected) {
+      flags |= kHrmFlagContactDetected;
+    }
+  }
+  if (measurement.hasEnergy) {
+    flags |= kHrmFlagEnergyExpended;
+    writeLe16(out + offset, measurement.energyKj);
+    offset += 2U;
+  }
+  if (rr1024 != nullptr && rrCount > 0U) {
+    flags |= kHrmFlagRrIntervals;
+    for (size_t i = 0; i < rrCount; ++i) {
+      writeLe16(out + offset, rr1024[i]);
+      offset += 2U;
+    }
+  }
+  out[0] = flags;
+  return offset;
+}
+
+bool parseHeartRateMeasurement(const uint8_t *in, size_t size,
+                               HeartRateMeasurement &measurement, uint16_t *rr1024,
+                               size_t rrCapacity, size_t &rrCount) {
+  rrCount = 0;
+  if (in == nullptr || size < 2U) {
+    return false;
+  }
+  const uint8_t flags = in[0];
+  measurement = HeartRateMeasurement{};
+  size_t offset = 1;
+  if ((flags & kHrmFlagHeartRate16) != 0U) {
+    if (size < offset + 2U) {
+      return false;
+    }
+    measurement.bpm = readLe16(in + offset);
+    offset += 2U;
+  } else {
+    measurement.bpm = in[offset++];
+  }
+  measurement.contactSupported = (flags & kHrmFlagContactSupported) != 0U;
+  measurement.contactDetected =
+      measurement.contactSupported && (flags & kHrmFlagContactDetected) != 0U;
+  if ((flags & kHrmFlagEnergyExpended) != 0U) {
+    if (size < offset + 2U) {
+      return false;
+    }
+    measurement.hasEnergy = true;
+    measurement.energyKj = readLe16(in + offset);
+    offset += 2U;
+  }
+  if ((flags & kHrmFlagRrIntervals) == 0U) {
+    return offset == size;
+  }
+  if ((size - offset) % 2U != 0U) {
+    return false;
+  }
+  rrCount = (size - offset) / 2U;
+  for (size_t i = 0; i < rrCount && i < rrCapacity && rr1024 != nullptr; ++i) {
+    rr1024[i] = readLe16(in + offset + i * 2U);
+  }
+  return true;
+}
+
+uint16_t RrIntervalConverter::convert(uint16_t rriMs) {
+  const uint32_t scaled = static_cast<uint32_t>(rriMs) * 1024U + remainder_;
+  remainder_ = scaled % 1000U;
+  return static_cast<uint16_t>(scaled / 1000U);
+}
+
+}  // namespace ergo
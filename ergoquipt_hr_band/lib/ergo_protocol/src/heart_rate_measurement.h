@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Heart Rate Measurement characteristic (0x2A37) of the standard Bluetooth
+// Heart Rate Service (0x180D): flags, heart rate as uint8 or uint16, optional
+// energy expended in kJ, then any number of RR intervals in 1/1024 s that fit
+// the ATT payload. All multi-byte fields are little-endian.
+
+namespace ergo {
+
+constexpr uint8_t kHrmFlagHeartRate16 = 1U << 0;
+constexpr uint8_t kHrmFlagContactDetected = 1U << 1;
+constexpr uint8_t kHrmFlagContactSupported = 1U << 2;
+constexpr uint8_t kHrmFlagEnergyExpended = 1U << 3;
+constexpr uint8_t kHrmFlagRrIntervals = 1U << 4;
+constexpr uint16_t kHrmEnergyMaxKj = 0xFFFFU;
+// Heart Rate Control Point (0x2A39) opcode.
+constexpr uint8_t kHrcpResetEnergyExpended = 0x01;
+// Body Sensor Location (0x2A38) value.
+constexpr uint8_t kBodySensorLocationWrist = 0x02;
+
+struct HeartRateMeasurement {
+  uint16_t bpm = 0;
+  bool contactSupported = false;
+  bool contactDetected = false;
+  bool hasEnergy = false;
+  uint16_t energyKj = 0;
+};
+
+constexpr size_t heartRateHeaderSize(const HeartRateMeasurement &measurement) {
+  return 1U + (measurement.bpm > 0xFFU ? 2U : 1U) + (measurement.hasEnergy ? 2U : 0U);
+}
+
+// RR intervals that fit in one notification at the given MTU.
+constexpr size_t heartRateRrCapacity(const HeartRateMeasurement &measurement,
+                                     uint16_t mtu) {
+  return mtu > 3U + heartRateHeaderSize(measurement)
+             ? (mtu - 3U - heartRateHeaderSize(measurement)) / 2U
+             : 0U;
+}
+
+// Writes the header and up to heartRateRrCapacity() intervals; the caller
+// sizes `out` for that. Returns the encoded length.
+size_t serializeHeartRateMeasurement(const HeartRateMeasurement &measurement,
+                                     const uint16_t *rr1024, size_t rrCount,
+                                     uint8_t *out);
+// Copies at most `rrCapacity` intervals; `rrCount` is how many the
+// notification carried.
+bool parseHeartRateMeasurement(const uint8_t *in, size_t size,
+                               HeartRateMeasurement &measurement, uint16_t *rr1024,
+                               size_t rrCapacity, size_t &rrCount);
+
+// Converts millisecond RR intervals to 1/1024 s, carrying the rounding
+// remainder so a long run of intervals still sums to the right duration.
+class RrIntervalConverter {
+ public:
+  uint16_t convert(uint16_t rriMs);
+  void reset() { remainder_ = 0; }
+
+ private:
+  uint32_t remainder_ = 0;
+};
+
+}  // namespace ergo
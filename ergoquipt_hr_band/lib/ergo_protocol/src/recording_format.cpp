@@ -0,0 +1,213 @@
+#include "recording_format.h"
+
+#include <cstring>
+
+#include "crc32.h"
+
+namespace ergo {
+
+namespace {
+
+void writeMetric(uint8_t *out, const MetricSummary &metric) {
+  writeLe16(out, metric.min);
+  writeLe16(out + 2, metric.max);
+  writeLe16(out + 4, metric.mean);
+}
+
+void readMetric(const uint8_t *in, MetricSummary &metric) {
+  metric.min = readLe16(in);
+  metric.max = readLe16(in + 2);
+  metric.mean = readLe16(in + 4);
+}
+
+}  // namespace
+
+void SummaryAccumulator::Metric::add(uint16_t value) {
+  min = value < min ? value : min;
+  max = value > max ? value : max;
+  sum += value;
+  ++count;
+}
+
+void SummaryAccumulator::Metric::store(MetricSummary &out) const {
+  if (count == 0U) {
+    out = MetricSummary{};
+    return;
+  }
+  out.min = min;
+  out.max = max;
+  out.mean = static_cast<uint16_t>(sum / count);
+}
+
+void SummaryAccumulator::reset(uint32_t startMs, uint32_t csvOffset,
+                               uint32_t ergOffset) {
+  *this = SummaryAccumulator{};
+  summary_.startMs = startMs;
+  summary_.endMs = startMs;
+  summary_.csvOffset = csvOffset;
+  summary_.ergOffset = ergOffset;
+}
+
+void SummaryAccumulator::add(uint32_t nowMs, bool vitalsValid, uint16_t hr,
+                             uint16_t spo2X100, uint16_t motionX1000) {
+  ++summary_.rows;
+  summary_.endMs = nowMs;
+  if (vitalsValid) {
+    ++summary_.validRows;
+    hr_.add(hr);
+    spo2_.add(spo2X100);
+  }
+  motion_.add(motionX1000);
+  hr_.store(summary_.hr);
+  spo2_.store(summary_.spo2);
+  motion_.store(summary_.motion);
+}
+
+void serializeFileHeader(const FileHeader &header, uint8_t out[kFileHeaderSize]) {
+  memset(out, 0, kFileHeaderSize);
+  memcpy(out, kRecordingMagic, sizeof(kRecordingMagic));
+  writeLe16(out + 4, header.version);
+  writeLe16(out + 6, static_cast<uint16_t>(kFileHeaderSize));
+  out[8] = header.channels;
+  out[9] = header.rtcValid;
+  writeLe32(out + 12, header.startMs);
+  writeLe16(out + 16, header.year);
+  out[18] = header.month;
+  out[19] = header.day;
+  out[20] = header.hour;
+  out[21] = header.minute;
+  out[22] = header.second;
+}
+
+bool parseFileHeader(const uint8_t *in, size_t size, FileHeader &header) {
+  if (in == nullptr || size < kFileHeaderSize ||
+      memcmp(in, kRecordingMagic, sizeof(kRecordingMagic)) != 0 ||
+      readLe16(in + 6) != kFileHeaderSize) {
+    return false;
+  }
+  header.version = readLe16(in + 4);
+  header.channels = in[8];
+  header.rtcValid = in[9];
+  header.startMs = readLe32(in + 12);
+  header.year = readLe16(in + 16);
+  header.month = in[18];
+  header.day = in[19];
+  header.hour = in[20];
+  header.minute = in[21];
+  header.second = in[22];
+  return header.version == kRecordingVersion;
+}
+
+void serializeBlockHeader(const BlockHeader &header,
+                          uint8_t out[kBlockHeaderSize]) {
+  memset(out, 0, kBlockHeaderSize);
+  writeLe16(out, kBlockSync);
+  out[2] = static_cast<uint8_t>(header.type);
+  out[3] = header.channels;
+  writeLe16(out + 4, header.sampleCount);
+  writeLe32(out + 8, header.firstSampleMs);
+  writeLe32(out + 12, header.payloadBytes);
+  writeLe32(out + kBlockCrcOffset, header.crc);
+}
+
+bool parseBlockHeader(const uint8_t *in, size_t size, BlockHeader &header) {
+  if (in == nullptr || size < kBlockHeaderSize || readLe16(in) != kBlockSync) {
+    return false;
+  }
+  header.type = static_cast<BlockType>(in[2]);
+  header.channels = in[3];
+  header.sampleCount = readLe16(in + 4);
+  header.firstSampleMs = readLe32(in + 8);
+  header.payloadBytes = readLe32(in + 12);
+  header.crc = readLe32(in + kBlockCrcOffset);
+  return true;
+}
+
+uint32_t blockHeaderCrc(const BlockHeader &header) {
+  uint8_t encoded[kBlockHeaderSize];
+  serializeBlockHeader(header, encoded);
+  return crc32(encoded, kBlockCrcOffset);
+}
+
+uint32_t blockCrc(const BlockHeader &header, const uint8_t *payload, size_t size) {
+  return crc32(payload, size, blockHeaderCrc(header));
+}
+
+void serializeIntervalSummary(const IntervalSummary &summary,
+                              uint8_t out[kIntervalSummarySize]) {
+  memset(out, 0, kIntervalSummarySize);
+  writeLe32(out, summary.startMs);
+  writeLe32(out + 4, summary.endMs);
+  writeLe32(out + 8, summary.csvOffset);
+  writeLe32(out + 12, summary.ergOffset);
+  writeLe32(out + 16, summary.rows);
+  writeLe32(out + 20, summary.validRows);
+  writeMetric(out + 24, summary.hr);
+  writeMetric(out + 30, summary.spo2);
+  writeMetric(out + 36, summary.motion);
+}
+
+bool parseIntervalSummary(const uint8_t *in, size_t size,
+                          IntervalSummary &summary) {
+  if (in == nullptr || size < kIntervalSummarySize) {
+    return false;
+  }
+  summary.startMs = readLe32(in);
+  summary.endMs = readLe32(in + 4);
+  summary.csvOffset = readLe32(in + 8);
+  summary.ergOffset = readLe32(in + 12);
+  summary.rows = readLe32(in + 16);
+  summary.validRows = readLe32(in + 20);
+  readMetric(in + 24, summary.hr);
+  readMetric(in + 30, summary.spo2);
+  readMetric(in + 36, summary.motion);
+  return true;
+}
+
+void serializeFooter(const FooterInfo &footer, uint8_t out[kFooterPayloadSize]) {
+  serializeIntervalSummary(footer.session, out);
+  writeLe32(out + kIntervalSummarySize, footer.indexTableOffset);
+  writeLe32(out + kIntervalSummarySize + 4, footer.indexEntryCount);
+}
+
+bool parseFooter(const uint8_t *in, size_t size, FooterInfo &footer) {
+  if (!parseIntervalSummary(in, size, footer.session) ||
+      size < kFooterPayloadSize) {
+    return false;
+  }
+  footer.indexTableOffset = readLe32(in + kIntervalSummarySize);
+  footer.indexEntryCount = readLe32(in + kIntervalSummarySize + 4);
+  return true;
+}
+
+void serializeCommitRecord(const CommitRecord &record,
+                           uint8_t out[kCommitRecordSize]) {
+  memset(out, 0, kCommitRecordSize);
+  memcpy(out, kJournalMagic, sizeof(kJournalMagic));
+  writeLe32(out + 4, record.commitSequence);
+  writeLe32(out + 8, record.fileSequence);
+  writeLe32(out + 12, record.flags);
+  writeLe32(out + 16, record.csvBytes);
+  writeLe32(out + 20, record.ergBytes);
+  writeLe32(out + 24, record.rows);
+  writeLe32(out + 28, record.timestampMs);
+  writeLe32(out + kCommitRecordSize - 4, crc32(out, kCommitRecordSize - 4));
+}
+
+bool parseCommitRecord(const uint8_t *in, size_t size, CommitRecord &record) {
+  if (in == nullptr || size < kCommitRecordSize ||
+      memcmp(in, kJournalMagic, sizeof(kJournalMagic)) != 0 ||
+      readLe32(in + kCommitRecordSize - 4) != crc32(in, kCommitRecordSize - 4)) {
+    return false;
+  }
+  record.commitSequence = readLe32(in + 4);
+  record.fileSequence = readLe32(in + 8);
+  record.flags = readLe32(in + 12);
+  record.csvBytes = readLe32(in + 16);
+  record.ergBytes = readLe32(in + 20);
+  record.rows = readLe32(in + 24);
+  record.timestampMs = readLe32(in + 28);
+  return true;
+}
+
+}  // namespace ergo
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Binary recording container written next to the CSV log. A file starts with
+// a fixed FileHeader followed by a sequence of framed blocks. All multi-byte
+// fields are little-endian.
+//
+// Every minute the recorder appends an Index block summarising that minute.
+// A clean stop() appends an IndexTable block with all entries and finishes
+// the file with a fixed-size Footer block, so a reader can locate any minute
+// by reading the last kFooterBlockSize bytes and one table lookup.
+//
+// Every block carries a CRC-32 over its header and payload. The recorder
+// periodically appends a Commit block and mirrors the same CommitRecord into
+// a two-slot journal file; after a power loss only the bytes past the last
+// commit need to be checked.
+
+namespace ergo {
+
+constexpr uint8_t kRecordingMagic[4] = {'E', 'R', 'G', 'R'};
+constexpr uint16_t kRecordingVersion = 2;
+constexpr size_t kFileHeaderSize = 32;
+constexpr size_t kBlockHeaderSize = 20;
+constexpr size_t kBlockCrcOffset = 16;
+constexpr uint16_t kBlockSync = 0xB10C;
+
+// Raw sample channel layout, one int32 per channel per frame.
+enum RawChannel : uint8_t {
+  kRawChannelTimestampMs = 0,
+  kRawChannelIr = 1,
+  kRawChannelRed = 2,
+  kRawChannelAccelXmg = 3,
+  kRawChannelAccelYmg = 4,
+  kRawChannelAccelZmg = 5,
+  kRawChannelCount = 6,
+};
+
+// One raw frame as the sensor produces it (timestamp, IR and red as uint32,
+// three int16 accelerometer axes): the uncompressed size the codec ratio is
+// measured against.
+constexpr uint32_t kRawFrameBytes = 4U * 3U + 2U * 3U;
+
+enum class BlockType : uint8_t {
+  RawSamples = 1,
+  Index = 2,
+  IndexTable = 3,
+  Footer = 4,
+  Commit = 5,
+};
+
+constexpr size_t kIntervalSummarySize = 44;
+constexpr size_t kFooterPayloadSize = kIntervalSummarySize + 8;
+constexpr size_t kFooterBlockSize = kBlockHeaderSize + kFooterPayloadSize;
+constexpr uint8_t kJournalMagic[4] = {'E', 'R', 'G', 'J'};
+constexpr size_t kCommitRecordSize = 40;
+constexpr uint32_t kCommitFlagOpen = 1U << 0;
+
+struct FileHeader {
+  uint16_t version = kRecordingVersion;
+  uint8_t channels = kRawChannelCount;
+  uint8_t rtcValid = 0;
+  uint32_t startMs = 0;
+  uint16_t year = 0;
+  uint8_t month = 0;
+  uint8_t day = 0;
+  uint8_t hour = 0;
+  uint8_t minute = 0;
+  uint8_t second = 0;
+};
+
+struct BlockHeader {
+  BlockType type = BlockType::RawSamples;
+  uint8_t channels = 0;
+  uint16_t sampleCount = 0;
+  uint32_t firstSampleMs = 0;
+  uint32_t payloadBytes = 0;
+  uint32_t crc = 0;
+};
+
+struct MetricSummary {
+  uint16_t min = 0;
+  uint16_t max = 0;
+  uint16_t mean = 0;
+};
+
+// Statistics over an interval of 1 Hz vitals rows. Offsets point at the first
+// CSV row and the first .erg block of the interval. HR/SpO2 only count rows
+// with valid vitals; motion is the motion score x1000 over all rows.
+struct IntervalSummary {
+  uint32_t startMs = 0;
+  uint32_t endMs = 0;
+  uint32_t csvOffset = 0;
+  uint32_t ergOffset = 0;
+  uint32_t rows = 0;
+  uint32_t validRows = 0;
+  MetricSummary hr;
+  MetricSummary spo2;
+  MetricSummary motion;
+
+  uint8_t validPercent() const {
+    return rows > 0U ? static_cast<uint8_t>((validRows * 100U) / rows) : 0U;
+  }
+};
+
+class SummaryAccumulator {
+ public:
+  void reset(uint32_t startMs, uint32_t csvOffset, uint32_t ergOffset);
+  void add(uint32_t nowMs, bool vitalsValid, uint16_t hr, uint16_t spo2X100,
+           uint16_t motionX1000);
+  const IntervalSummary &summary() const { return summary_; }
+
+ private:
+  struct Metric {
+    uint16_t min = 0xFFFF;
+    uint16_t max = 0;
+    uint64_t sum = 0;
+    uint32_t count = 0;
+
+    void add(uint16_t value);
+    void store(MetricSummary &out) const;
+  };
+
+  IntervalSummary summary_;
+  Metric hr_;
+  Metric spo2_;
+  Metric motion_;
+};
+
+// Durable state of one recording: both files are valid up to csvBytes and
+// ergBytes. kCommitFlagOpen is cleared by the record written on close.
+struct CommitRecord {
+  uint32_t commitSequence = 0;
+  uint32_t fileSequence = 0;
+  uint32_t flags = 0;
+  uint32_t csvBytes = 0;
+  uint32_t ergBytes = 0;
+  uint32_t rows = 0;
+  uint32_t timestampMs = 0;
+};
+
+struct FooterInfo {
+  IntervalSummary session;
+  uint32_t indexTableOffset = 0;
+  uint32_t indexEntryCount = 0;
+};
+
+inline void writeLe16(uint8_t *buffer, uint16_t value) {
+  buffer[0] = static_cast<uint8_t>(value & 0xFF);
+  buffer[1] = static_cast<uint8_t>((value >> 8U) & 0xFF);
+}
+
+inline void writeLe32(uint8_t *buffer, uint32_t value) {
+  writeLe16(buffer, static_cast<uint16_t>(value & 0xFFFF));
+  writeLe16(buffer + 2, static_cast<uint16_t>(value >> 16U));
+}
+
+inline uint16_t readLe16(const uint8_t *buffer) {
+  return static_cast<uint16_t>(buffer[0] | (buffer[1] << 8U));
+}
+
+inline uint32_t readLe32(const uint8_t *buffer) {
+  return static_cast<uint32_t>(readLe16(buffer)) |
+         (static_cast<uint32_t>(readLe16(buffer + 2)) << 16U);
+}
+
+void serializeFileHeader(const FileHeader &header, uint8_t out[kFileHeaderSize]);
+bool parseFileHeader(const uint8_t *in, size_t size, FileHeader &header);
+void serializeBlockHeader(const BlockHeader &header,
+                          uint8_t out[kBlockHeaderSize]);
+bool parseBlockHeader(const uint8_t *in, size_t size, BlockHeader &header);
+// CRC of the header fields before kBlockCrcOffset. Chain it through the
+// payload with crc32() to get BlockHeader::crc.
+uint32_t blockHeaderCrc(const BlockHeader &header);
+uint32_t blockCrc(const BlockHeader &header, const uint8_t *payload, size_t size);
+void serializeIntervalSummary(const IntervalSummary &summary,
+                              uint8_t out[kIntervalSummarySize]);
+bool parseIntervalSummary(const uint8_t *in, size_t size,
+                          IntervalSummary &summary);
+void serializeFooter(const FooterInfo &footer, uint8_t out[kFooterPayloadSize]);
+bool parseFooter(const uint8_t *in, size_t size, FooterInfo &footer);
+void serializeCommitRecord(const CommitRecord &record,
+                           uint8_t out[kCommitRecordSize]);
+// Fails on a bad magic or CRC, e.g. a torn journal slot.
+bool parseCommitRecord(const uint8_t *in, size_t size, CommitRecord &record);
+
+}  // namespace ergo
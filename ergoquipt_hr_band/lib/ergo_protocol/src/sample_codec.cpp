@@ -0,0 +1,252 @@
+#include "sample_codec.h"
+
+namespace ergo {
+
+namespace {
+
+class BitWriter {
+ public:
+  BitWriter(uint8_t *out, size_t capacity) : out_(out), capacity_(capacity) {}
+
+  void write(uint32_t value, uint8_t bits) {
+    accumulator_ = (accumulator_ << bits) | (value & lowMask(bits));
+    pendingBits_ = static_cast<uint8_t>(pendingBits_ + bits);
+    while (pendingBits_ >= 8U) {
+      pendingBits_ = static_cast<uint8_t>(pendingBits_ - 8U);
+      emit(static_cast<uint8_t>(accumulator_ >> pendingBits_));
+    }
+  }
+
+  void writeOnes(uint8_t count) { write(static_cast<uint32_t>(lowMask(count)), count); }
+
+  void writeBit(uint32_t bit) { write(bit, 1); }
+
+  size_t finish() {
+    if (pendingBits_ > 0U) {
+      emit(static_cast<uint8_t>(accumulator_ << (8U - pendingBits_)));
+      pendingBits_ = 0;
+    }
+    return overflow_ ? 0 : size_;
+  }
+
+  static uint64_t lowMask(uint8_t bits) { return (1ULL << bits) - 1ULL; }
+
+ private:
+  void emit(uint8_t byte) {
+    if (size_ >= capacity_) {
+      overflow_ = true;
+      return;
+    }
+    out_[size_++] = byte;
+  }
+
+  uint8_t *out_;
+  size_t capacity_;
+  size_t size_ = 0;
+  uint64_t accumulator_ = 0;
+  uint8_t pendingBits_ = 0;
+  bool overflow_ = false;
+};
+
+class BitReader {
+ public:
+  BitReader(const uint8_t *in, size_t size) : in_(in), size_(size) {}
+
+  bool read(uint8_t bits, uint32_t &value) {
+    while (availableBits_ < bits && position_ < size_) {
+      accumulator_ = (accumulator_ << 8U) | in_[position_++];
+      availableBits_ = static_cast<uint8_t>(availableBits_ + 8U);
+    }
+    if (availableBits_ < bits) {
+      return false;
+    }
+    availableBits_ = static_cast<uint8_t>(availableBits_ - bits);
+    value = static_cast<uint32_t>((accumulator_ >> availableBits_) &
+                                  BitWriter::lowMask(bits));
+    return true;
+  }
+
+  // Counts leading one bits up to `limit` and consumes them plus the
+  // terminating zero (no terminator is consumed when `limit` is reached).
+  // `limit` must be below 57 so one refill always covers it.
+  bool readOnes(uint8_t limit, uint32_t &count) {
+    while (availableBits_ <= 56U && position_ < size_) {
+      accumulator_ = (accumulator_ << 8U) | in_[position_++];
+      availableBits_ = static_cast<uint8_t>(availableBits_ + 8U);
+    }
+    if (availableBits_ == 0U) {
+      return false;
+    }
+    const uint64_t window = accumulator_ << (64U - availableBits_);
+    const uint8_t ones =
+        ~window == 0U ? 64U : static_cast<uint8_t>(__builtin_clzll(~window));
+    if (ones >= limit && availableBits_ >= limit) {
+      availableBits_ = static_cast<uint8_t>(availableBits_ - limit);
+      count = limit;
+      return true;
+    }
+    if (ones >= availableBits_) {
+      return false;
+    }
+    availableBits_ = static_cast<uint8_t>(availableBits_ - ones - 1U);
+    count = ones;
+    return true;
+  }
+
+ private:
+  const uint8_t *in_;
+  size_t size_;
+  size_t position_ = 0;
+  uint64_t accumulator_ = 0;
+  uint8_t availableBits_ = 0;
+};
+
+uint32_t zigzag(int32_t value) {
+  return (static_cast<uint32_t>(value) << 1U) ^
+         static_cast<uint32_t>(value >> 31);
+}
+
+int32_t unzigzag(uint32_t value) {
+  return static_cast<int32_t>((value >> 1U) ^ (0U - (value & 1U)));
+}
+
+uint8_t bitLength(uint32_t value) {
+  uint8_t bits = 0;
+  while (value != 0U) {
+    ++bits;
+    value >>= 1U;
+  }
+  return bits;
+}
+
+// Residual of sample `i` under the given predictor order. Arithmetic wraps in
+// uint32 so the mapping stays lossless for any input.
+uint32_t residualAt(const int32_t *frames, uint8_t channels, uint8_t channel,
+                    uint16_t i, uint8_t order) {
+  const uint32_t x0 = static_cast<uint32_t>(frames[i * channels + channel]);
+  const uint32_t x1 = static_cast<uint32_t>(frames[(i - 1U) * channels + channel]);
+  if (order == 1U || i < 2U) {
+    return zigzag(static_cast<int32_t>(x0 - x1));
+  }
+  const uint32_t x2 = static_cast<uint32_t>(frames[(i - 2U) * channels + channel]);
+  return zigzag(static_cast<int32_t>(x0 - (2U * x1 - x2)));
+}
+
+uint8_t riceParameter(uint64_t sum, uint16_t count) {
+  if (count == 0U) {
+    return 0;
+  }
+  const uint32_t mean = static_cast<uint32_t>(sum / count);
+  const uint8_t bits = bitLength(mean);
+  return bits > 0U ? static_cast<uint8_t>(bits - 1U) : 0U;
+}
+
+void writeRice(BitWriter &writer, uint32_t value, uint8_t k) {
+  const uint32_t quotient = value >> k;
+  if (quotient >= kCodecEscapeQuotient) {
+    writer.writeOnes(kCodecEscapeQuotient);
+    writer.write(value, 32);
+    return;
+  }
+  writer.writeOnes(static_cast<uint8_t>(quotient));
+  writer.writeBit(0U);
+  if (k > 0U) {
+    writer.write(value, k);
+  }
+}
+
+bool readRice(BitReader &reader, uint8_t k, uint32_t &value) {
+  uint32_t quotient = 0;
+  if (!reader.readOnes(kCodecEscapeQuotient, quotient)) {
+    return false;
+  }
+  if (quotient >= kCodecEscapeQuotient) {
+    return reader.read(32, value);
+  }
+  uint32_t remainder = 0;
+  if (k > 0U && !reader.read(k, remainder)) {
+    return false;
+  }
+  value = (quotient << k) | remainder;
+  return true;
+}
+
+}  // namespace
+
+size_t encodeSampleBlock(const int32_t *frames, uint8_t channels,
+                         uint16_t samples, uint8_t *out, size_t outCapacity) {
+  if (frames == nullptr || out == nullptr || channels == 0U ||
+      channels > kCodecMaxChannels || samples == 0U ||
+      samples > kCodecMaxBlockSamples) {
+    return 0;
+  }
+
+  BitWriter writer(out, outCapacity);
+  for (uint8_t channel = 0; channel < channels; ++channel) {
+    uint64_t firstOrderSum = 0;
+    uint64_t secondOrderSum = 0;
+    for (uint16_t i = 1; i < samples; ++i) {
+      firstOrderSum += residualAt(frames, channels, channel, i, 1);
+      secondOrderSum += residualAt(frames, channels, channel, i, 2);
+    }
+    const uint8_t order = secondOrderSum < firstOrderSum ? 2U : 1U;
+    const uint8_t k = riceParameter(order == 2U ? secondOrderSum : firstOrderSum,
+                                    static_cast<uint16_t>(samples - 1U));
+
+    const uint32_t first = zigzag(frames[channel]);
+    const uint8_t firstBits = bitLength(first);
+    writer.write(order - 1U, 1);
+    writer.write(k, kCodecRiceParamBits);
+    writer.write(firstBits, kCodecLengthBits);
+    if (firstBits > 0U) {
+      writer.write(first, firstBits);
+    }
+    for (uint16_t i = 1; i < samples; ++i) {
+      writeRice(writer, residualAt(frames, channels, channel, i, order), k);
+    }
+  }
+  return writer.finish();
+}
+
+bool decodeSampleBlock(const uint8_t *in, size_t inSize, uint8_t channels,
+                       uint16_t samples, int32_t *frames) {
+  if (in == nullptr || frames == nullptr || channels == 0U ||
+      channels > kCodecMaxChannels || samples == 0U ||
+      samples > kCodecMaxBlockSamples) {
+    return false;
+  }
+
+  BitReader reader(in, inSize);
+  for (uint8_t channel = 0; channel < channels; ++channel) {
+    uint32_t orderBit = 0;
+    uint32_t k = 0;
+    uint32_t firstBits = 0;
+    uint32_t first = 0;
+    if (!reader.read(1, orderBit) || !reader.read(kCodecRiceParamBits, k) ||
+        !reader.read(kCodecLengthBits, firstBits) || firstBits > 32U ||
+        (firstBits > 0U && !reader.read(static_cast<uint8_t>(firstBits), first))) {
+      return false;
+    }
+    frames[channel] = unzigzag(first);
+
+    const uint8_t order = orderBit != 0U ? 2U : 1U;
+    for (uint16_t i = 1; i < samples; ++i) {
+      uint32_t coded = 0;
+      if (!readRice(reader, static_cast<uint8_t>(k), coded)) {
+        return false;
+      }
+      const uint32_t residual = static_cast<uint32_t>(unzigzag(coded));
+      const uint32_t x1 = static_cast<uint32_t>(frames[(i - 1U) * channels + channel]);
+      uint32_t prediction = x1;
+      if (order == 2U && i >= 2U) {
+        const uint32_t x2 =
+            static_cast<uint32_t>(frames[(i - 2U) * channels + channel]);
+        prediction = 2U * x1 - x2;
+      }
+      frames[i * channels + channel] = static_cast<int32_t>(prediction + residual);
+    }
+  }
+  return true;
+}
+
+}  // namespace ergo
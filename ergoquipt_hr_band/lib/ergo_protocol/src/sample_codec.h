@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Lossless block codec for interleaved multi-channel integer streams (PPG
+// counts, IMU milli-g, sample timestamps). Each channel is predicted with a
+// first or second order difference, residuals are zigzag mapped and Rice
+// coded with a per-block parameter. Blocks are self-contained so a reader can
+// start decoding at any block boundary, and the work per block is linear in
+// channels * samples.
+
+namespace ergo {
+
+constexpr uint8_t kCodecMaxChannels = 8;
+constexpr uint16_t kCodecMaxBlockSamples = 256;
+constexpr uint8_t kCodecEscapeQuotient = 24;
+constexpr uint8_t kCodecRiceParamBits = 5;
+constexpr uint8_t kCodecLengthBits = 6;
+
+// Worst-case encoded size of one block, used to size output buffers: per
+// channel a predictor bit, Rice parameter, first value, then every residual
+// escaped to 32 bits.
+constexpr size_t maxEncodedBlockSize(uint8_t channels, uint16_t samples) {
+  return ((1U + kCodecRiceParamBits + kCodecLengthBits + 32U +
+           static_cast<size_t>(samples) * (kCodecEscapeQuotient + 32U)) *
+              channels +
+          7U) /
+         8U;
+}
+
+// Encodes `samples` interleaved frames of `channels` values each. Returns the
+// number of bytes written to `out`, or 0 if the arguments are out of range or
+// `outCapacity` is too small.
+size_t encodeSampleBlock(const int32_t *frames, uint8_t channels,
+                         uint16_t samples, uint8_t *out, size_t outCapacity);
+
+// Decodes a block produced by encodeSampleBlock back into interleaved frames.
+// Returns false on truncated or malformed input.
+bool decodeSampleBlock(const uint8_t *in, size_t inSize, uint8_t channels,
+                       uint16_t samples, int32_t *frames);
+
+}  // namespace ergo
@@ -0,0 +1,77 @@
+#include "stream_format.h"
+
+#include "recording_format.h"
+
+namespace ergo {
+
+namespace {
+
+void writeLe24(uint8_t *buffer, uint32_t value) {
+  buffer[0] = static_cast<uint8_t>(value & 0xFF);
+  buffer[1] = static_cast<uint8_t>((value >> 8U) & 0xFF);
+  buffer[2] = static_cast<uint8_t>((value >> 16U) & 0xFF);
+}
+
+uint32_t readLe24(const uint8_t *buffer) {
+  return static_cast<uint32_t>(buffer[0]) | (static_cast<uint32_t>(buffer[1]) << 8U) |
+         (static_cast<uint32_t>(buffer[2]) << 16U);
+}
+
+}  // namespace
+
+void serializeStreamHeader(const StreamFrameHeader &header,
+                           uint8_t out[kStreamHeaderSize]) {
+  writeLe16(out, header.sequence);
+  writeLe32(out + 2, header.firstSampleIndex);
+  writeLe32(out + 6, header.firstSampleMs);
+}
+
+bool parseStreamHeader(const uint8_t *in, size_t size, StreamFrameHeader &header) {
+  if (in == nullptr || size < kStreamHeaderSize ||
+      (size - kStreamHeaderSize) % kStreamSampleSize != 0U) {
+    return false;
+  }
+  header.sequence = readLe16(in);
+  header.firstSampleIndex = readLe32(in + 2);
+  header.firstSampleMs = readLe32(in + 6);
+  return true;
+}
+
+void serializeStreamSample(const StreamSample &sample, uint32_t previousMs,
+                           uint8_t out[kStreamSampleSize]) {
+  const uint32_t deltaMs = sample.timestampMs - previousMs;
+  out[0] = static_cast<uint8_t>(deltaMs < kStreamMaxDeltaMs ? deltaMs : kStreamMaxDeltaMs);
+  writeLe24(out + 1, sample.ir < kStreamMaxPpgValue ? sample.ir : kStreamMaxPpgValue);
+  writeLe24(out + 4, sample.red < kStreamMaxPpgValue ? sample.red : kStreamMaxPpgValue);
+  writeLe16(out + 7, static_cast<uint16_t>(sample.accelXmg));
+  writeLe16(out + 9, static_cast<uint16_t>(sample.accelYmg));
+  writeLe16(out + 11, static_cast<uint16_t>(sample.accelZmg));
+}
+
+void parseStreamSample(const uint8_t *in, uint32_t previousMs, StreamSample &sample) {
+  sample.timestampMs = previousMs + in[0];
+  sample.ir = readLe24(in + 1);
+  sample.red = readLe24(in + 4);
+  sample.accelXmg = static_cast<int16_t>(readLe16(in + 7));
+  sample.accelYmg = static_cast<int16_t>(readLe16(in + 9));
+  sample.accelZmg = static_cast<int16_t>(readLe16(in + 11));
+}
+
+void StreamGapTracker::accept(const StreamFrameHeader &header, size_t samples) {
+  if (started_) {
+    lostFrames_ += static_cast<uint16_t>(header.sequence - nextSequence_);
+    // A sample index behind the expected one means the device restarted the
+    // stream; only forward jumps are losses.
+    const uint32_t jump = header.firstSampleIndex - nextSampleIndex_;
+    if (jump < 0x80000000U) {
+      lostSamples_ += jump;
+    }
+  }
+  started_ = true;
+  nextSequence_ = static_cast<uint16_t>(header.sequence + 1U);
+  nextSampleIndex_ = header.firstSampleIndex + static_cast<uint32_t>(samples);
+  ++frames_;
+  samples_ += static_cast<uint32_t>(samples);
+}
+
+}  // namespace ergo
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Live waveform stream sent as notifications on the stream characteristic.
+// Each notification is one frame: a StreamFrameHeader followed by as many
+// fixed-size samples as fit in the negotiated ATT payload (MTU - 3). The
+// sample count is implied by the notification length. All multi-byte fields
+// are little-endian.
+//
+// `sequence` increments once per frame, so a gap means notifications were
+// lost on the link. `firstSampleIndex` counts sensor samples since boot, so a
+// gap there means samples were lost before they reached the link.
+
+namespace ergo {
+
+constexpr size_t kStreamHeaderSize = 10;
+// dt_ms u8, ir u24, red u24, accel x/y/z int16 mg.
+constexpr size_t kStreamSampleSize = 13;
+constexpr uint16_t kAttHeaderSize = 3;
+constexpr uint16_t kDefaultAttMtu = 23;
+constexpr uint32_t kStreamMaxPpgValue = 0xFFFFFFU;
+constexpr uint32_t kStreamMaxDeltaMs = 0xFFU;
+
+struct StreamFrameHeader {
+  uint16_t sequence = 0;
+  uint32_t firstSampleIndex = 0;
+  uint32_t firstSampleMs = 0;
+};
+
+struct StreamSample {
+  uint32_t timestampMs = 0;
+  uint32_t ir = 0;
+  uint32_t red = 0;
+  int16_t accelXmg = 0;
+  int16_t accelYmg = 0;
+  int16_t accelZmg = 0;
+};
+
+constexpr size_t streamSamplesPerFrame(uint16_t mtu) {
+  return mtu > kAttHeaderSize + kStreamHeaderSize
+             ? (mtu - kAttHeaderSize - kStreamHeaderSize) / kStreamSampleSize
+             : 0U;
+}
+
+constexpr size_t streamFrameSize(size_t samples) {
+  return kStreamHeaderSize + samples * kStreamSampleSize;
+}
+
+void serializeStreamHeader(const StreamFrameHeader &header,
+                           uint8_t out[kStreamHeaderSize]);
+bool parseStreamHeader(const uint8_t *in, size_t size, StreamFrameHeader &header);
+// `previousMs` is the timestamp of the sample before this one in the frame,
+// or firstSampleMs for the first sample. The caller starts a new frame when
+// the gap exceeds kStreamMaxDeltaMs; PPG values are clamped to 24 bits.
+void serializeStreamSample(const StreamSample &sample, uint32_t previousMs,
+                           uint8_t out[kStreamSampleSize]);
+void parseStreamSample(const uint8_t *in, uint32_t previousMs, StreamSample &sample);
+
+// Receiver-side bookkeeping for one subscription.
+class StreamGapTracker {
+ public:
+  // Call with every received header and the frame's sample count.
+  void accept(const StreamFrameHeader &header, size_t samples);
+  uint32_t frames() const { return frames_; }
+  uint32_t samples() const { return samples_; }
+  // Frames missing from the sequence, i.e. notifications lost on the link.
+  uint32_t lostFrames() const { return lostFrames_; }
+  // Samples missing from the sample index, wherever they were lost.
+  uint32_t lostSamples() const { return lostSamples_; }
+
+ private:
+  bool started_ = false;
+  uint16_t nextSequence_ = 0;
+  uint32_t nextSampleIndex_ = 0;
+  uint32_t frames_ = 0;
+  uint32_t samples_ = 0;
+  uint32_t lostFrames_ = 0;
+  uint32_t lostSamples_ = 0;
+};
+
+}  // namespace ergo
@@ -0,0 +1,311 @@
+#include "usb_protocol.h"
+
+#include <cstring>
+
+#include "crc32.h"
+#include "recording_format.h"
+
+namespace ergo {
+
+size_t cobsEncode(const uint8_t *in, size_t size, uint8_t *out, size_t capacity) {
+  if (out == nullptr || capacity < cobsMaxEncodedSize(size)) {
+    return 0;
+  }
+  size_t codeIndex = 0;
+  size_t written = 1;
+  uint8_t code = 1;
+  for (size_t i = 0; i < size; ++i) {
+    if (in[i] != 0U) {
+      out[written++] = in[i];
+      ++code;
+    }
+    // A zero ends the run; so does a full run, unless the input ends with it.
+    if (in[i] == 0U || (code == 0xFFU && i + 1U < size)) {
+      out[codeIndex] = code;
+      codeIndex = written++;
+      code = 1;
+    }
+  }
+  out[codeIndex] = code;
+  return written;
+}
+
+size_t cobsDecode(const uint8_t *in, size_t size, uint8_t *out, size_t capacity) {
+  size_t read = 0;
+  size_t written = 0;
+  while (read < size) {
+    const uint8_t code = in[read++];
+    if (code == 0U || read + code - 1U > size) {
+      return 0;
+    }
+    for (uint8_t i = 1; i < code; ++i) {
+      if (in[read] == 0U || written == capacity) {
+        return 0;
+      }
+      out[written++] = in[read++];
+    }
+    if (code != 0xFFU && read < size) {
+      if (written == capacity) {
+        return 0;
+      }
+      out[written++] = 0;
+    }
+  }
+  return written;
+}
+
+size_t encodeUsbFrame(UsbMessage type, uint16_t sequence, const uint8_t *payload,
+                      size_t size, uint8_t *out, size_t capacity) {
+  if (size > kUsbMaxPayload || (size > 0U && payload == nullptr)) {
+    return 0;
+  }
+  uint8_t frame[kUsbMaxPayload + kUsbFrameOverhead];
+  frame[0] = static_cast<uint8_t>(type);
+  writeLe16(frame + 1, sequence);
+  if (size > 0U) {
+    memcpy(frame + 3, payload, size);
+  }
+  writeLe32(frame + 3 + size, crc32(frame, 3U + size));
+  const size_t encoded = cobsEncode(frame, size + kUsbFrameOverhead, out,
+                                    capacity > 0U ? capacity - 1U : 0U);
+  if (encoded == 0U) {
+    return 0;
+  }
+  out[encoded] = 0;
+  return encoded + 1U;
+}
+
+bool UsbFrameDecoder::push(uint8_t byte) {
+  if (byte != 0U) {
+    if (encodedSize_ == sizeof(encoded_)) {
+      overrun_ = true;
+    } else {
+      encoded_[encodedSize_++] = byte;
+    }
+    return false;
+  }
+
+  const size_t encodedSize = encodedSize_;
+  const bool overrun = overrun_;
+  reset();
+  if (encodedSize == 0U) {
+    // Back-to-back delimiters, e.g. the one a host sends to flush.
+    return false;
+  }
+  const size_t size = overrun ? 0U : cobsDecode(encoded_, encodedSize, frame_, sizeof(frame_));
+  if (size < kUsbFrameOverhead ||
+      readLe32(frame_ + size - 4U) != crc32(frame_, size - 4U)) {
+    ++errors_;
+    return false;
+  }
+  frameSize_ = size;
+  ++frames_;
+  return true;
+}
+
+uint16_t UsbFrameDecoder::sequence() const { return readLe16(frame_ + 1); }
+
+void UsbFrameDecoder::reset() {
+  encodedSize_ = 0;
+  overrun_ = false;
+}
+
+void serializeUsbSamplesHeader(uint32_t firstSampleIndex,
+                               uint8_t out[kUsbSamplesHeaderSize]) {
+  writeLe32(out, firstSampleIndex);
+}
+
+void serializeUsbSample(const StreamSample &sample, uint8_t out[kUsbSampleSize]) {
+  writeLe32(out, sample.timestampMs);
+  writeLe32(out + 4, sample.ir);
+  writeLe32(out + 8, sample.red);
+  writeLe16(out + 12, static_cast<uint16_t>(sample.accelXmg));
+  writeLe16(out + 14, static_cast<uint16_t>(sample.accelYmg));
+  writeLe16(out + 16, static_cast<uint16_t>(sample.accelZmg));
+}
+
+bool parseUsbSamples(const uint8_t *in, size_t size, uint32_t &firstSampleIndex,
+                     size_t &count) {
+  if (in == nullptr || size < kUsbSamplesHeaderSize ||
+      (size - kUsbSamplesHeaderSize) % kUsbSampleSize != 0U) {
+    return false;
+  }
+  firstSampleIndex = readLe32(in);
+  count = (size - kUsbSamplesHeaderSize) / kUsbSampleSize;
+  return true;
+}
+
+void parseUsbSample(const uint8_t *in, StreamSample &sample) {
+  sample.timestampMs = readLe32(in);
+  sample.ir = readLe32(in + 4);
+  sample.red = readLe32(in + 8);
+  sample.accelXmg = static_cast<int16_t>(readLe16(in + 12));
+  sample.accelYmg = static_cast<int16_t>(readLe16(in + 14));
+  sample.accelZmg = static_cast<int16_t>(readLe16(in + 16));
+}
+
+void serializeUsbDiagnostics(const UsbDiagnostics &diagnostics,
+                             uint8_t out[kUsbDiagnosticsSize]) {
+  writeLe32(out, diagnostics.timestampMs);
+  writeLe16(out + 4, diagnostics.hr);
+  writeLe16(out + 6, diagnostics.spo2X100);
+  writeLe16(out + 8, diagnostics.rriMs);
+  writeLe16(out + 10, diagnostics.hrvMs);
+  out[12] = diagnostics.status;
+  out[13] = diagnostics.flags;
+  out[14] = diagnostics.motionState;
+  writeLe32(out + 15, diagnostics.irRaw);
+  writeLe32(out + 19, diagnostics.redRaw);
+  writeLe32(out + 23, diagnostics.irFiltered);
+  writeLe16(out + 27, static_cast<uint16_t>(diagnostics.accelXmg));
+  writeLe16(out + 29, static_cast<uint16_t>(diagnostics.accelYmg));
+  writeLe16(out + 31, static_cast<uint16_t>(diagnostics.accelZmg));
+  writeLe16(out + 33, diagnostics.accelMagnitudeMg);
+  writeLe16(out + 35, diagnostics.motionX1000);
+}
+
+bool parseUsbDiagnostics(const uint8_t *in, size_t size, UsbDiagnostics &diagnostics) {
+  if (in == nullptr || size != kUsbDiagnosticsSize) {
+    return false;
+  }
+  diagnostics.timestampMs = readLe32(in);
+  diagnostics.hr = readLe16(in + 4);
+  diagnostics.spo2X100 = readLe16(in + 6);
+  diagnostics.rriMs = readLe16(in + 8);
+  diagnostics.hrvMs = readLe16(in + 10);
+  diagnostics.status = in[12];
+  diagnostics.flags = in[13];
+  diagnostics.motionState = in[14];
+  diagnostics.irRaw = readLe32(in + 15);
+  diagnostics.redRaw = readLe32(in + 19);
+  diagnostics.irFiltered = readLe32(in + 23);
+  diagnostics.accelXmg = static_cast<int16_t>(readLe16(in + 27));
+  diagnostics.accelYmg = static_cast<int16_t>(readLe16(in + 29));
+  diagnostics.accelZmg = static_cast<int16_t>(readLe16(in + 31));
+  diagnostics.accelMagnitudeMg = readLe16(in + 33);
+  diagnostics.motionX1000 = readLe16(in + 35);
+  return true;
+}
+
+void serializeUsbCounters(const UsbCounters &counters, uint8_t out[kUsbCountersSize]) {
+  writeLe32(out, static_cast<uint32_t>(counters.uptimeUs));
+  writeLe32(out + 4, static_cast<uint32_t>(counters.uptimeUs >> 32U));
+  const uint32_t fields[] = {
+      counters.samplesSent, counters.samplesDropped, counters.samplesBacklog,
+      counters.framesSent, counters.bytesSent, counters.txStalls,
+      counters.framesDropped, counters.rxFrames, counters.rxErrors,
+      counters.logDropped, counters.pumpMaxUs, counters.freeHeap,
+      counters.minFreeHeap};
+  static_assert(8U + sizeof(fields) == kUsbCountersSize, "UsbCounters layout");
+  for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); ++i) {
+    writeLe32(out + 8 + i * 4U, fields[i]);
+  }
+}
+
+bool parseUsbCounters(const uint8_t *in, size_t size, UsbCounters &counters) {
+  if (in == nullptr || size != kUsbCountersSize) {
+    return false;
+  }
+  counters.uptimeUs = readLe32(in) | (static_cast<uint64_t>(readLe32(in + 4)) << 32U);
+  uint32_t *const fields[] = {
+      &counters.samplesSent, &counters.samplesDropped, &counters.samplesBacklog,
+      &counters.framesSent, &counters.bytesSent, &counters.txStalls,
+      &counters.framesDropped, &counters.rxFrames, &counters.rxErrors,
+      &counters.logDropped, &counters.pumpMaxUs, &counters.freeHeap,
+      &counters.minFreeHeap};
+  for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); ++i) {
+    *fields[i] = readLe32(in + 8 + i * 4U);
+  }
+  return true;
+}
+
+size_t serializeUsbPerf(const UsbPerf &perf, uint8_t out[kUsbMaxPerfSize]) {
+  const uint32_t fields[] = {
+      perf.timestampMs, perf.periodMs, perf.frames, perf.renderUsAvg, perf.renderUsMax,
+      perf.flushUsAvg, perf.flushUsMax, perf.missedDeadlines, perf.lvglUsedBytes,
+      perf.lvglMaxUsedBytes, perf.lvglTotalBytes, perf.internalFreeBytes,
+      perf.internalMinFreeBytes, perf.internalLargestBlock, perf.psramFreeBytes};
+  static_assert(sizeof(fields) + 2U == kUsbPerfHeaderSize, "UsbPerf layout");
+  for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); ++i) {
+    writeLe32(out + i * 4U, fields[i]);
+  }
+  const uint8_t taskCount =
+      perf.taskCount < kUsbMaxPerfTasks ? perf.taskCount : static_cast<uint8_t>(kUsbMaxPerfTasks);
+  out[sizeof(fields)] = perf.lvglFragPct;
+  out[sizeof(fields) + 1U] = taskCount;
+  uint8_t *task = out + kUsbPerfHeaderSize;
+  for (uint8_t i = 0; i < taskCount; ++i, task += kUsbPerfTaskSize) {
+    memset(task, 0, kUsbPerfTaskNameBytes);
+    strncpy(reinterpret_cast<char *>(task), perf.tasks[i].name, kUsbPerfTaskNameBytes - 1U);
+    writeLe32(task + kUsbPerfTaskNameBytes, perf.tasks[i].minFreeBytes);
+  }
+  return kUsbPerfHeaderSize + taskCount * kUsbPerfTaskSize;
+}
+
+bool parseUsbPerf(const uint8_t *in, size_t size, UsbPerf &perf) {
+  if (in == nullptr || size < kUsbPerfHeaderSize) {
+    return false;
+  }
+  uint32_t *const fields[] = {
+      &perf.timestampMs, &perf.periodMs, &perf.frames, &perf.renderUsAvg, &perf.renderUsMax,
+      &perf.flushUsAvg, &perf.flushUsMax, &perf.missedDeadlines, &perf.lvglUsedBytes,
+      &perf.lvglMaxUsedBytes, &perf.lvglTotalBytes, &perf.internalFreeBytes,
+      &perf.internalMinFreeBytes, &perf.internalLargestBlock, &perf.psramFreeBytes};
+  const size_t fieldCount = sizeof(fields) / sizeof(fields[0]);
+  for (size_t i = 0; i < fieldCount; ++i) {
+    *fields[i] = readLe32(in + i * 4U);
+  }
+  perf.lvglFragPct = in[fieldCount * 4U];
+  perf.taskCount = in[fieldCount * 4U + 1U];
+  if (perf.taskCount > kUsbMaxPerfTasks ||
+      size != kUsbPerfHeaderSize + perf.taskCount * kUsbPerfTaskSize) {
+    return false;
+  }
+  const uint8_t *task = in + kUsbPerfHeaderSize;
+  for (uint8_t i = 0; i < perf.taskCount; ++i, task += kUsbPerfTaskSize) {
+    memcpy(perf.tasks[i].name, task, kUsbPerfTaskNameBytes);
+    perf.tasks[i].name[kUsbPerfTaskNameBytes - 1U] = '\0';
+    perf.tasks[i].minFreeBytes = readLe32(task + kUsbPerfTaskNameBytes);
+  }
+  return true;
+}
+
+void serializeUsbAck(const UsbAck &ack, uint8_t out[kUsbAckSize]) {
+  out[0] = static_cast<uint8_t>(ack.request);
+  writeLe16(out + 1, ack.requestSequence);
+  out[3] = static_cast<uint8_t>(ack.status);
+}
+
+bool parseUsbAck(const uint8_t *in, size_t size, UsbAck &ack) {
+  if (in == nullptr || size != kUsbAckSize) {
+    return false;
+  }
+  ack.request = static_cast<UsbMessage>(in[0]);
+  ack.requestSequence = readLe16(in + 1);
+  ack.status = static_cast<UsbStatus>(in[3]);
+  return true;
+}
+
+void serializeUsbDateTime(const UsbDateTime &time, uint8_t out[kUsbDateTimeSize]) {
+  writeLe16(out, time.year);
+  out[2] = time.month;
+  out[3] = time.day;
+  out[4] = time.hour;
+  out[5] = time.minute;
+  out[6] = time.second;
+}
+
+bool parseUsbDateTime(const uint8_t *in, size_t size, UsbDateTime &time) {
+  if (in == nullptr || size != kUsbDateTimeSize) {
+    return false;
+  }
+  time.year = readLe16(in);
+  time.month = in[2];
+  time.day = in[3];
+  time.hour = in[4];
+  time.minute = in[5];
+  time.second = in[6];
+  return true;
+}
+
+}  // namespace ergo
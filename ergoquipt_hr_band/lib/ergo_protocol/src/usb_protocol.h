@@ -0,0 +1,245 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "stream_format.h"
+
+// Binary protocol on the USB CDC port for bench captures. Every frame is
+//
+//   COBS(type u8, sequence u16, payload, crc32 u32) 0x00
+//
+// so a receiver resynchronises on the next zero byte after garbage or a lost
+// byte. The CRC-32 covers type, sequence and payload. Each side numbers the
+// frames it sends; a gap in the device's sequence means frames were lost on
+// the way to the host.
+//
+// The port starts in text mode (log lines, RTC=/LOG= command lines). A Hello
+// frame switches it to binary mode: the device answers with Info and from
+// then on wraps log lines in Log frames. Bye, or the host closing the port,
+// switches back. All multi-byte fields are little-endian.
+
+namespace ergo {
+
+constexpr uint8_t kUsbProtocolVersion = 1;
+constexpr size_t kUsbMaxPayload = 480;
+// type u8, sequence u16 before the payload, crc32 u32 after it.
+constexpr size_t kUsbFrameOverhead = 7;
+
+// COBS adds one byte per started run of 254 bytes.
+constexpr size_t cobsMaxEncodedSize(size_t size) { return size + size / 254U + 1U; }
+
+// Largest frame on the wire, delimiter included.
+constexpr size_t kUsbMaxEncodedFrame =
+    cobsMaxEncodedSize(kUsbMaxPayload + kUsbFrameOverhead) + 1U;
+
+// timestamp u32, ir u32, red u32, accel x/y/z int16 mg.
+constexpr size_t kUsbSampleSize = 18;
+// firstSampleIndex u32 before the samples.
+constexpr size_t kUsbSamplesHeaderSize = 4;
+constexpr size_t kUsbMaxSamplesPerFrame =
+    (kUsbMaxPayload - kUsbSamplesHeaderSize) / kUsbSampleSize;
+constexpr size_t kUsbDiagnosticsSize = 37;
+constexpr size_t kUsbCountersSize = 60;
+constexpr size_t kUsbAckSize = 4;
+constexpr size_t kUsbDateTimeSize = 7;
+constexpr size_t kUsbInfoHeaderSize = 5;
+// Fixed fields, then one name + free-stack record per task.
+constexpr size_t kUsbPerfHeaderSize = 62;
+constexpr size_t kUsbPerfTaskNameBytes = 16;
+constexpr size_t kUsbPerfTaskSize = kUsbPerfTaskNameBytes + 4U;
+constexpr size_t kUsbMaxPerfTasks = 16;
+constexpr size_t kUsbMaxPerfSize = kUsbPerfHeaderSize + kUsbMaxPerfTasks * kUsbPerfTaskSize;
+static_assert(kUsbMaxPerfSize <= kUsbMaxPayload, "Perf frame too large");
+
+enum class UsbMessage : uint8_t {
+  // Host to device.
+  // Enter binary mode; answered with Info.
+  Hello = 0x01,
+  // One text command line, as typed on the console (RTC=..., LOG=...).
+  Command = 0x02,
+  // UsbDateTime.
+  SetRtc = 0x03,
+  // Stream samples from the newest one on, plus diagnostics and counters.
+  StartCapture = 0x04,
+  StopCapture = 0x05,
+  // Back to text mode.
+  Bye = 0x06,
+
+  // Device to host.
+  // UsbAck for every host frame but Hello.
+  Ack = 0x81,
+  // version u8, uptime ms u32, device name.
+  Info = 0x82,
+  // firstSampleIndex u32, then samples; the count is implied by the length.
+  Samples = 0x83,
+  Diagnostics = 0x84,
+  Counters = 0x85,
+  // One rendered log line, without the line break.
+  Log = 0x86,
+  // UsbPerf, once a second next to Counters.
+  Perf = 0x87,
+};
+
+enum class UsbStatus : uint8_t {
+  Ok = 0,
+  Failed = 1,
+  Unknown = 2,
+  Malformed = 3,
+};
+
+struct UsbAck {
+  UsbMessage request = UsbMessage::Hello;
+  uint16_t requestSequence = 0;
+  UsbStatus status = UsbStatus::Ok;
+};
+
+struct UsbDateTime {
+  uint16_t year = 0;
+  uint8_t month = 0;
+  uint8_t day = 0;
+  uint8_t hour = 0;
+  uint8_t minute = 0;
+  uint8_t second = 0;
+};
+
+// UsbDiagnostics::flags.
+constexpr uint8_t kUsbDiagImuReady = 1U << 0;
+constexpr uint8_t kUsbDiagFingerPresent = 1U << 1;
+constexpr uint8_t kUsbDiagPeakDetected = 1U << 2;
+constexpr uint8_t kUsbDiagRriAccepted = 1U << 3;
+
+// Latest vitals and signal-processing state, one per device pump.
+struct UsbDiagnostics {
+  uint32_t timestampMs = 0;
+  uint16_t hr = 0;
+  uint16_t spo2X100 = 0;
+  uint16_t rriMs = 0;
+  uint16_t hrvMs = 0;
+  uint8_t status = 0;
+  uint8_t flags = 0;
+  uint8_t motionState = 0;
+  uint32_t irRaw = 0;
+  uint32_t redRaw = 0;
+  uint32_t irFiltered = 0;
+  int16_t accelXmg = 0;
+  int16_t accelYmg = 0;
+  int16_t accelZmg = 0;
+  uint16_t accelMagnitudeMg = 0;
+  uint16_t motionX1000 = 0;
+};
+
+// Totals since the capture started, sent once a second.
+struct UsbCounters {
+  uint64_t uptimeUs = 0;
+  uint32_t samplesSent = 0;
+  // Samples the sensor ring overwrote before the link took them.
+  uint32_t samplesDropped = 0;
+  // Samples waiting in the ring when the counters were taken.
+  uint32_t samplesBacklog = 0;
+  uint32_t framesSent = 0;
+  uint32_t bytesSent = 0;
+  // Pumps that found the CDC buffer too full to take the next frame.
+  uint32_t txStalls = 0;
+  // Diagnostics, counters and log frames dropped for the same reason.
+  uint32_t framesDropped = 0;
+  uint32_t rxFrames = 0;
+  uint32_t rxErrors = 0;
+  uint32_t logDropped = 0;
+  uint32_t pumpMaxUs = 0;
+  uint32_t freeHeap = 0;
+  uint32_t minFreeHeap = 0;
+};
+
+struct UsbPerfTask {
+  // Zero-padded on the wire; always terminated here.
+  char name[kUsbPerfTaskNameBytes] = "";
+  uint32_t minFreeBytes = 0;
+};
+
+// UI frame time, memory and stack headroom. The UI counters cover the last
+// periodMs; heap and stacks are read when the frame is built.
+struct UsbPerf {
+  uint32_t timestampMs = 0;
+  uint32_t periodMs = 0;
+  uint32_t frames = 0;
+  uint32_t renderUsAvg = 0;
+  uint32_t renderUsMax = 0;
+  uint32_t flushUsAvg = 0;
+  uint32_t flushUsMax = 0;
+  uint32_t missedDeadlines = 0;
+  uint32_t lvglUsedBytes = 0;
+  uint32_t lvglMaxUsedBytes = 0;
+  uint32_t lvglTotalBytes = 0;
+  uint32_t internalFreeBytes = 0;
+  uint32_t internalMinFreeBytes = 0;
+  uint32_t internalLargestBlock = 0;
+  uint32_t psramFreeBytes = 0;
+  uint8_t lvglFragPct = 0;
+  uint8_t taskCount = 0;
+  UsbPerfTask tasks[kUsbMaxPerfTasks];
+};
+
+// Returns the encoded size, or 0 if `capacity` is too small. The output
+// holds no zero bytes.
+size_t cobsEncode(const uint8_t *in, size_t size, uint8_t *out, size_t capacity);
+// Decodes one frame without its delimiter. Returns the decoded size, or 0 on
+// malformed input or when `capacity` is too small.
+size_t cobsDecode(const uint8_t *in, size_t size, uint8_t *out, size_t capacity);
+
+// Builds a complete frame, delimiter included. Returns its size, or 0 if the
+// payload is larger than kUsbMaxPayload or `capacity` is too small.
+size_t encodeUsbFrame(UsbMessage type, uint16_t sequence, const uint8_t *payload,
+                      size_t size, uint8_t *out, size_t capacity);
+
+// Splits a byte stream into frames. Garbage between delimiters, bad CRCs and
+// overlong frames are counted as errors and skipped.
+class UsbFrameDecoder {
+ public:
+  // True when `byte` completed a valid frame; it stays readable until the
+  // next push().
+  bool push(uint8_t byte);
+
+  UsbMessage type() const { return static_cast<UsbMessage>(frame_[0]); }
+  uint16_t sequence() const;
+  const uint8_t *payload() const { return frame_ + 3; }
+  size_t payloadSize() const { return frameSize_ - kUsbFrameOverhead; }
+
+  uint32_t frames() const { return frames_; }
+  uint32_t errors() const { return errors_; }
+  // Drops a partial frame, e.g. when the port was reopened.
+  void reset();
+
+ private:
+  uint8_t encoded_[kUsbMaxEncodedFrame];
+  uint8_t frame_[kUsbMaxPayload + kUsbFrameOverhead];
+  size_t encodedSize_ = 0;
+  size_t frameSize_ = 0;
+  bool overrun_ = false;
+  uint32_t frames_ = 0;
+  uint32_t errors_ = 0;
+};
+
+// Samples payload: header, then one kUsbSampleSize record per sample.
+void serializeUsbSamplesHeader(uint32_t firstSampleIndex,
+                               uint8_t out[kUsbSamplesHeaderSize]);
+void serializeUsbSample(const StreamSample &sample, uint8_t out[kUsbSampleSize]);
+// Sets the sample count; false on a malformed payload.
+bool parseUsbSamples(const uint8_t *in, size_t size, uint32_t &firstSampleIndex,
+                     size_t &count);
+void parseUsbSample(const uint8_t *in, StreamSample &sample);
+
+void serializeUsbDiagnostics(const UsbDiagnostics &diagnostics,
+                             uint8_t out[kUsbDiagnosticsSize]);
+bool parseUsbDiagnostics(const uint8_t *in, size_t size, UsbDiagnostics &diagnostics);
+void serializeUsbCounters(const UsbCounters &counters, uint8_t out[kUsbCountersSize]);
+bool parseUsbCounters(const uint8_t *in, size_t size, UsbCounters &counters);
+// Returns the payload size; tasks past kUsbMaxPerfTasks are left out.
+size_t serializeUsbPerf(const UsbPerf &perf, uint8_t out[kUsbMaxPerfSize]);
+bool parseUsbPerf(const uint8_t *in, size_t size, UsbPerf &perf);
+void serializeUsbAck(const UsbAck &ack, uint8_t out[kUsbAckSize]);
+bool parseUsbAck(const uint8_t *in, size_t size, UsbAck &ack);
+void serializeUsbDateTime(const UsbDateTime &time, uint8_t out[kUsbDateTimeSize]);
+bool parseUsbDateTime(const uint8_t *in, size_t size, UsbDateTime &time);
+
+}  // namespace ergo
@@ -0,0 +1,249 @@
+#include "vitals_payload.h"
+
+#include "recording_format.h"
+
+namespace ergo {
+
+namespace {
+
+uint32_t zigzag(int32_t value) {
+  return (static_cast<uint32_t>(value) << 1U) ^ static_cast<uint32_t>(value >> 31);
+}
+
+int32_t unzigzag(uint32_t value) {
+  return static_cast<int32_t>((value >> 1U) ^ (0U - (value & 1U)));
+}
+
+size_t writeVarint(uint32_t value, uint8_t *out) {
+  size_t size = 0;
+  while (value >= 0x80U) {
+    out[size++] = static_cast<uint8_t>(value | 0x80U);
+    value >>= 7U;
+  }
+  out[size++] = static_cast<uint8_t>(value);
+  return size;
+}
+
+// A uint16 difference needs at most 17 zigzag bits, i.e. three bytes.
+bool readVarint(const uint8_t *in, size_t size, size_t &offset, uint32_t &value) {
+  value = 0;
+  for (uint8_t shift = 0; shift < 21U; shift = static_cast<uint8_t>(shift + 7U)) {
+    if (offset >= size) {
+      return false;
+    }
+    const uint8_t byte = in[offset++];
+    value |= static_cast<uint32_t>(byte & 0x7FU) << shift;
+    if ((byte & 0x80U) == 0U) {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t fieldDelta(uint16_t current, uint16_t previous) {
+  return zigzag(static_cast<int32_t>(current) - static_cast<int32_t>(previous));
+}
+
+bool applyDelta(uint16_t &field, uint32_t coded) {
+  const int32_t value = static_cast<int32_t>(field) + unzigzag(coded);
+  if (value < 0 || value > 0xFFFF) {
+    return false;
+  }
+  field = static_cast<uint16_t>(value);
+  return true;
+}
+
+// Encodes one reading against the previous one; returns 0 if it does not fit.
+size_t encodeDelta(const VitalsReading &current, const VitalsReading &previous,
+                   uint8_t *out, size_t capacity) {
+  const uint16_t VitalsReading::*const kFields[] = {
+      &VitalsReading::hr, &VitalsReading::spo2X100, &VitalsReading::rri,
+      &VitalsReading::hrv};
+  uint8_t scratch[kVitalsPayloadV2MaxDeltaSize];
+  uint8_t flags = 0;
+  size_t size = 1;
+  for (uint8_t i = 0; i < 4U; ++i) {
+    if (current.*kFields[i] != previous.*kFields[i]) {
+      flags |= static_cast<uint8_t>(1U << i);
+      size += writeVarint(fieldDelta(current.*kFields[i], previous.*kFields[i]),
+                          scratch + size);
+    }
+  }
+  if (current.status != previous.status) {
+    flags |= kVitalsDeltaStatus;
+    scratch[size++] = current.status;
+  }
+  if (size > capacity) {
+    return 0;
+  }
+  scratch[0] = flags;
+  for (size_t i = 0; i < size; ++i) {
+    out[i] = scratch[i];
+  }
+  return size;
+}
+
+}  // namespace
+
+void encodeVitalsPayloadV1(const VitalsReading &reading, uint8_t sequence,
+                           uint8_t out[kVitalsPayloadV1Size]) {
+  writeLe16(out, reading.hr);
+  writeLe16(out + 2, reading.spo2X100);
+  writeLe16(out + 4, reading.rri);
+  writeLe16(out + 6, reading.hrv);
+  out[8] = reading.status;
+  out[9] = sequence;
+  out[10] = 0x00;
+  out[11] = 0x00;
+}
+
+bool decodeVitalsPayloadV1(const uint8_t *in, size_t size, VitalsReading &reading,
+                           uint8_t &sequence) {
+  if (in == nullptr || size != kVitalsPayloadV1Size) {
+    return false;
+  }
+  reading.hr = readLe16(in);
+  reading.spo2X100 = readLe16(in + 2);
+  reading.rri = readLe16(in + 4);
+  reading.hrv = readLe16(in + 6);
+  reading.status = in[8];
+  sequence = in[9];
+  return true;
+}
+
+bool parseVitalsVersionWrite(const uint8_t *in, size_t size, uint8_t &version) {
+  if (in == nullptr || size != 1U ||
+      (in[0] != kVitalsPayloadV1 && in[0] != kVitalsPayloadV2)) {
+    return false;
+  }
+  version = in[0];
+  return true;
+}
+
+size_t encodeVitalsPayloadV2(VitalsPayloadHeader header, const VitalsReading *readings,
+                             size_t count, uint8_t *out, size_t capacity,
+                             size_t &encoded) {
+  encoded = 0;
+  if (readings == nullptr || out == nullptr || count == 0U ||
+      capacity < kVitalsPayloadV2HeaderSize + kVitalsPayloadV2KeyframeSize) {
+    return 0;
+  }
+
+  size_t offset = kVitalsPayloadV2HeaderSize;
+  const VitalsReading &first = readings[0];
+  writeLe16(out + offset, first.hr);
+  writeLe16(out + offset + 2, first.spo2X100);
+  writeLe16(out + offset + 4, first.rri);
+  writeLe16(out + offset + 6, first.hrv);
+  out[offset + 8] = first.status;
+  offset += kVitalsPayloadV2KeyframeSize;
+  encoded = 1;
+
+  const size_t limit =
+      count < kVitalsPayloadV2MaxReadings ? count : kVitalsPayloadV2MaxReadings;
+  while (encoded < limit) {
+    const size_t size = encodeDelta(readings[encoded], readings[encoded - 1U],
+                                    out + offset, capacity - offset);
+    if (size == 0U) {
+      break;
+    }
+    offset += size;
+    ++encoded;
+  }
+
+  header.version = kVitalsPayloadV2;
+  header.count = static_cast<uint8_t>(encoded);
+  out[0] = header.version;
+  out[1] = header.sequence;
+  out[2] = header.count;
+  writeLe32(out + 3, header.firstSequence);
+  return offset;
+}
+
+bool decodeVitalsPayloadV2(const uint8_t *in, size_t size, VitalsPayloadHeader &header,
+                           VitalsReading *readings, size_t capacity) {
+  if (in == nullptr ||
+      size < kVitalsPayloadV2HeaderSize + kVitalsPayloadV2KeyframeSize ||
+      in[0] != kVitalsPayloadV2 || in[2] == 0U || in[2] > capacity ||
+      readings == nullptr) {
+    return false;
+  }
+  header.version = in[0];
+  header.sequence = in[1];
+  header.count = in[2];
+  header.firstSequence = readLe32(in + 3);
+
+  size_t offset = kVitalsPayloadV2HeaderSize;
+  VitalsReading current;
+  current.hr = readLe16(in + offset);
+  current.spo2X100 = readLe16(in + offset + 2);
+  current.rri = readLe16(in + offset + 4);
+  current.hrv = readLe16(in + offset + 6);
+  current.status = in[offset + 8];
+  offset += kVitalsPayloadV2KeyframeSize;
+  readings[0] = current;
+
+  uint16_t VitalsReading::*const kFields[] = {&VitalsReading::hr, &VitalsReading::spo2X100,
+                                              &VitalsReading::rri, &VitalsReading::hrv};
+  for (size_t i = 1; i < header.count; ++i) {
+    if (offset >= size) {
+      return false;
+    }
+    const uint8_t flags = in[offset++];
+    if ((flags & ~0x1FU) != 0U) {
+      return false;
+    }
+    for (uint8_t field = 0; field < 4U; ++field) {
+      if ((flags & (1U << field)) == 0U) {
+        continue;
+      }
+      uint32_t coded = 0;
+      if (!readVarint(in, size, offset, coded) ||
+          !applyDelta(current.*kFields[field], coded)) {
+        return false;
+      }
+    }
+    if ((flags & kVitalsDeltaStatus) != 0U) {
+      if (offset >= size) {
+        return false;
+      }
+      current.status = in[offset++];
+    }
+    readings[i] = current;
+  }
+  return offset == size;
+}
+
+bool VitalsBatcher::add(uint32_t sequence, const VitalsReading &reading) {
+  if (count_ == 0U) {
+    if (capacity_ == 0U) {
+      return false;
+    }
+    firstSequence_ = sequence;
+  } else if (count_ >= capacity_ ||
+             sequence != firstSequence_ + static_cast<uint32_t>(count_)) {
+    return false;
+  }
+  readings_[count_++] = reading;
+  return true;
+}
+
+size_t VitalsBatcher::next(VitalsPayloadHeader header, uint8_t *out, size_t capacity) {
+  if (count_ == 0U) {
+    return 0;
+  }
+  header.firstSequence = firstSequence_;
+  size_t encoded = 0;
+  const size_t size = encodeVitalsPayloadV2(header, readings_, count_, out, capacity, encoded);
+  if (size == 0U) {
+    return 0;
+  }
+  count_ -= encoded;
+  firstSequence_ += static_cast<uint32_t>(encoded);
+  for (size_t i = 0; i < count_; ++i) {
+    readings_[i] = readings_[i + encoded];
+  }
+  return size;
+}
+
+}  // namespace ergo
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Vitals characteristic payloads. The version characteristic holds one byte
+// naming the format the device sends:
+//
+// v1: one 12-byte snapshot per notification (hr, spo2_x100, rri, hrv as
+//     uint16, status, sequence, two reserved bytes).
+// v2: several consecutive 1 Hz readings per notification. A 7-byte header
+//     (version, notification sequence, reading count, history sequence of the
+//     first reading as uint32), the first reading in full (9 bytes), then one
+//     delta per following reading: a flag byte with one bit per changed field
+//     and, for each set bit in field order, the new status byte or a zigzag
+//     LEB128 varint of the uint16 field's difference. A stable reading costs
+//     one byte. Readings are consecutive, so reading i has history sequence
+//     first_sequence + i. All multi-byte fields are little-endian.
+
+namespace ergo {
+
+constexpr uint8_t kVitalsPayloadV1 = 1;
+constexpr uint8_t kVitalsPayloadV2 = 2;
+constexpr size_t kVitalsPayloadV1Size = 12;
+constexpr size_t kVitalsPayloadV2HeaderSize = 7;
+constexpr size_t kVitalsPayloadV2KeyframeSize = 9;
+// Flag byte plus four 3-byte varints and a status byte.
+constexpr size_t kVitalsPayloadV2MaxDeltaSize = 14;
+constexpr size_t kVitalsPayloadV2MaxReadings = 255;
+
+constexpr uint8_t kVitalsDeltaHr = 1U << 0;
+constexpr uint8_t kVitalsDeltaSpo2 = 1U << 1;
+constexpr uint8_t kVitalsDeltaRri = 1U << 2;
+constexpr uint8_t kVitalsDeltaHrv = 1U << 3;
+constexpr uint8_t kVitalsDeltaStatus = 1U << 4;
+
+struct VitalsReading {
+  uint16_t hr = 0;
+  uint16_t spo2X100 = 0;
+  uint16_t rri = 0;
+  uint16_t hrv = 0;
+  uint8_t status = 0;
+};
+
+struct VitalsPayloadHeader {
+  uint8_t version = kVitalsPayloadV2;
+  uint8_t sequence = 0;
+  uint8_t count = 0;
+  uint32_t firstSequence = 0;
+};
+
+constexpr size_t maxVitalsPayloadV2Size(size_t readings) {
+  return readings == 0U ? 0U
+                        : kVitalsPayloadV2HeaderSize + kVitalsPayloadV2KeyframeSize +
+                              (readings - 1U) * kVitalsPayloadV2MaxDeltaSize;
+}
+
+void encodeVitalsPayloadV1(const VitalsReading &reading, uint8_t sequence,
+                           uint8_t out[kVitalsPayloadV1Size]);
+bool decodeVitalsPayloadV1(const uint8_t *in, size_t size, VitalsReading &reading,
+                           uint8_t &sequence);
+// A version characteristic write: exactly one byte naming v1 or v2.
+bool parseVitalsVersionWrite(const uint8_t *in, size_t size, uint8_t &version);
+
+// Encodes as many leading readings as fit in `capacity` (at most 255) and
+// reports that number in `encoded`; header.count is filled in. Returns the
+// byte length, or 0 when not even the first reading fits.
+size_t encodeVitalsPayloadV2(VitalsPayloadHeader header, const VitalsReading *readings,
+                             size_t count, uint8_t *out, size_t capacity,
+                             size_t &encoded);
+// Rejects truncated or trailing bytes, reserved flag bits and deltas that
+// leave the uint16 range. `capacity` must hold header.count readings.
+bool decodeVitalsPayloadV2(const uint8_t *in, size_t size, VitalsPayloadHeader &header,
+                           VitalsReading *readings, size_t capacity);
+
+// Device-side batch of consecutive readings waiting for a v2 notification,
+// shared by the firmware and the host simulator. The caller owns the
+// storage and decides when to flush.
+class VitalsBatcher {
+ public:
+  VitalsBatcher(VitalsReading *storage, size_t capacity)
+      : readings_(storage), capacity_(capacity) {}
+
+  // False when the batch is full or `sequence` does not follow the last
+  // reading; flush and add again.
+  bool add(uint32_t sequence, const VitalsReading &reading);
+  // Encodes the next notification of the batch into `out`, at most
+  // `capacity` bytes, and drops the readings it carries. `header.sequence`
+  // is the caller's notification counter. Returns 0 once the batch is empty
+  // or nothing fits.
+  size_t next(VitalsPayloadHeader header, uint8_t *out, size_t capacity);
+  void clear() { count_ = 0; }
+
+  size_t count() const { return count_; }
+  bool full() const { return count_ >= capacity_; }
+  uint32_t firstSequence() const { return firstSequence_; }
+
+ private:
+  VitalsReading *readings_;
+  size_t capacity_;
+  size_t count_ = 0;
+  uint32_t firstSequence_ = 0;
+};
+
+}  // namespace ergo
@@ -0,0 +1,72 @@
+#include "vitals_sync.h"
+
+#include "recording_format.h"
+
+namespace ergo {
+
+void serializeVitalsRecord(const VitalsRecord &record,
+                           uint8_t out[kVitalsRecordSize]) {
+  writeLe32(out, record.sequence);
+  writeLe32(out + 4, record.timestampMs);
+  writeLe32(out + 8, record.rtcSeconds);
+  writeLe16(out + 12, record.hr);
+  writeLe16(out + 14, record.spo2X100);
+  writeLe16(out + 16, record.rri);
+  writeLe16(out + 18, record.hrv);
+  out[20] = record.status;
+  out[21] = record.batteryPercent;
+}
+
+void parseVitalsRecord(const uint8_t *in, VitalsRecord &record) {
+  record.sequence = readLe32(in);
+  record.timestampMs = readLe32(in + 4);
+  record.rtcSeconds = readLe32(in + 8);
+  record.hr = readLe16(in + 12);
+  record.spo2X100 = readLe16(in + 14);
+  record.rri = readLe16(in + 16);
+  record.hrv = readLe16(in + 18);
+  record.status = in[20];
+  record.batteryPercent = in[21];
+}
+
+bool parseSyncCommand(const uint8_t *in, size_t size, SyncCommand &command) {
+  if (in == nullptr || size < 1U) {
+    return false;
+  }
+  command = SyncCommand{};
+  command.opcode = static_cast<SyncOpcode>(in[0]);
+  switch (command.opcode) {
+    case SyncOpcode::Start:
+      if (size < 6U) {
+        return false;
+      }
+      command.sequence = readLe32(in + 1);
+      command.window = in[5];
+      return command.window > 0U;
+    case SyncOpcode::Ack:
+      if (size < 5U) {
+        return false;
+      }
+      command.sequence = readLe32(in + 1);
+      return true;
+    case SyncOpcode::Stop:
+      return true;
+  }
+  return false;
+}
+
+size_t serializeSyncCommand(const SyncCommand &command,
+                            uint8_t out[kSyncCommandMaxSize]) {
+  out[0] = static_cast<uint8_t>(command.opcode);
+  if (command.opcode == SyncOpcode::Stop) {
+    return 1;
+  }
+  writeLe32(out + 1, command.sequence);
+  if (command.opcode == SyncOpcode::Ack) {
+    return 5;
+  }
+  out[5] = command.window;
+  return 6;
+}
+
+}  // namespace ergo
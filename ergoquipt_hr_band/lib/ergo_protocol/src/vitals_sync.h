@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Store-and-forward vitals history and the bulk sync protocol on the sync
+// characteristic. Every 1 Hz vitals row gets a sequence number; sequence
+// space is split into pages of kHistoryPageRecords and a reboot resumes at the
+// next unused page, so numbers only ever grow. Gaps are possible (history
+// overwritten, reboot) and are visible as jumps in the record sequence.
+//
+// The central writes a SyncCommand; the device answers with Data
+// notifications while fewer than `window` frames' worth of records are
+// unacknowledged, goes back to the last ack when acks stop, and finishes
+// with a Done notification once everything up to the live edge is acked.
+// Each Data frame names the sequence it was asked to serve: a first record
+// past it means the device no longer has the rows in between, while a
+// `from` past what the central has seen means earlier frames were lost and
+// the frame should be dropped. A central that hears nothing for a while
+// (e.g. a lost Done) simply sends Start again from its next sequence.
+// All multi-byte fields are little-endian.
+
+namespace ergo {
+
+constexpr size_t kVitalsRecordSize = 22;
+constexpr uint32_t kHistoryPageRecords = 64;
+constexpr size_t kSyncDataHeaderSize = 6;
+constexpr size_t kSyncDoneSize = 10;
+constexpr size_t kSyncCommandMaxSize = 6;
+
+// A VitalData row plus its history sequence and timestamps. `rtcSeconds` is
+// the RTC wall clock (as set, no time zone) in seconds since 1970-01-01, or 0
+// while the RTC is not set.
+struct VitalsRecord {
+  uint32_t sequence = 0;
+  uint32_t timestampMs = 0;
+  uint32_t rtcSeconds = 0;
+  uint16_t hr = 0;
+  uint16_t spo2X100 = 0;
+  uint16_t rri = 0;
+  uint16_t hrv = 0;
+  uint8_t status = 0;
+  uint8_t batteryPercent = 0;
+};
+
+enum class SyncOpcode : uint8_t {
+  // sequence u32 = first record wanted, window u8 = frames in flight.
+  Start = 1,
+  // sequence u32 = next record the central expects.
+  Ack = 2,
+  Stop = 3,
+};
+
+enum class SyncFrameType : uint8_t {
+  // count u8, from sequence u32, then count consecutive records.
+  Data = 1,
+  // 0 u8, next sequence u32, oldest available sequence u32.
+  Done = 2,
+};
+
+struct SyncCommand {
+  SyncOpcode opcode = SyncOpcode::Stop;
+  uint32_t sequence = 0;
+  uint8_t window = 0;
+};
+
+constexpr size_t syncRecordsPerFrame(uint16_t mtu) {
+  return mtu > 3U + kSyncDataHeaderSize
+             ? (mtu - 3U - kSyncDataHeaderSize) / kVitalsRecordSize
+             : 0U;
+}
+
+void serializeVitalsRecord(const VitalsRecord &record,
+                           uint8_t out[kVitalsRecordSize]);
+void parseVitalsRecord(const uint8_t *in, VitalsRecord &record);
+bool parseSyncCommand(const uint8_t *in, size_t size, SyncCommand &command);
+size_t serializeSyncCommand(const SyncCommand &command,
+                            uint8_t out[kSyncCommandMaxSize]);
+
+}  // namespace ergo
@@ -6,12 +6,150 @@
 #include <BLEServer.h>
 #include <BLEUtils.h>
 #include <esp_bt.h>
+#include <esp_gap_ble_api.h>
 #include <esp_mac.h>
 
+#include <ble_transport.h>
+#include <recording_format.h>
+
+#include "logger.h"
+#include "ui_events.h"
+
 namespace {
 
 BLEServer *g_server = nullptr;
 BLECharacteristic *g_characteristic = nullptr;
+BLECharacteristic *g_versionCharacteristic = nullptr;
+BLECharacteristic *g_streamCharacteristic = nullptr;
+BLE2902 *g_streamCcc = nullptr;
+BLECharacteristic *g_syncCharacteristic = nullptr;
+BLE2902 *g_syncCcc = nullptr;
+BLECharacteristic *g_fileCharacteristic = nullptr;
+BLE2902 *g_fileCcc = nullptr;
+BLECharacteristic *g_hrsMeasurement = nullptr;
+BLE2902 *g_hrsCcc = nullptr;
+BLECharacteristic *g_hrsControlPoint = nullptr;
+
+// Notifications through the ESP32 GATT server. The stack reports the
+// outcome through onStatus() synchronously from notify(), on the task that
+// called it; each channel is only notified from one task.
+class GattTransport : public ergo::BleTransport {
+ public:
+  void attach(ergo::BleChannel channel, BLECharacteristic *characteristic, BLE2902 *ccc) {
+    Slot &slot = slots_[static_cast<size_t>(channel)];
+    slot.characteristic = characteristic;
+    slot.ccc = ccc;
+  }
+
+  void setConnected(bool connected) { connected_ = connected; }
+
+  void reportStatus(BLECharacteristic *characteristic, bool ok) {
+    for (Slot &slot : slots_) {
+      if (slot.characteristic == characteristic) {
+        slot.failed = !ok;
+      }
+    }
+  }
+
+  bool notify(ergo::BleChannel channel, const uint8_t *data, size_t size) override {
+    Slot &slot = slots_[static_cast<size_t>(channel)];
+    if (slot.characteristic == nullptr) {
+      return false;
+    }
+    // setValue() copies; readable characteristics keep the last value.
+    slot.characteristic->setValue(const_cast<uint8_t *>(data), size);
+    if (!connected_) {
+      return false;
+    }
+    slot.failed = false;
+    slot.characteristic->notify();
+    return !slot.failed;
+  }
+
+  bool subscribed(ergo::BleChannel channel) const override {
+    const Slot &slot = slots_[static_cast<size_t>(channel)];
+    return connected_ && slot.ccc != nullptr && slot.ccc->getNotifications();
+  }
+
+ private:
+  struct Slot {
+    BLECharacteristic *characteristic = nullptr;
+    BLE2902 *ccc = nullptr;
+    bool failed = false;
+  };
+
+  Slot slots_[ergo::kBleChannelCount];
+  volatile bool connected_ = false;
+};
+
+GattTransport g_transport;
+
+// Link parameters reported by the stack's GATT and GAP callbacks.
+struct LinkState {
+  uint16_t mtu = ergo::kDefaultAttMtu;
+  uint16_t txOctets = 27;
+  uint8_t phy = 1;
+  // Increments on every connection so the stream task notices reconnects.
+  uint32_t session = 0;
+  uint32_t connectedMs = 0;
+  esp_bd_addr_t peer = {0};
+  uint16_t interval = 0;
+  uint16_t latency = 0;
+  uint16_t timeout = 0;
+  // Connection parameter update events and whether the last one succeeded.
+  uint32_t paramUpdates = 0;
+  bool lastUpdateOk = false;
+};
+
+portMUX_TYPE g_linkMux = portMUX_INITIALIZER_UNLOCKED;
+LinkState g_link;
+
+void setLink(const LinkState &link) {
+  portENTER_CRITICAL(&g_linkMux);
+  g_link = link;
+  portEXIT_CRITICAL(&g_linkMux);
+}
+
+LinkState link() {
+  portENTER_CRITICAL(&g_linkMux);
+  const LinkState link = g_link;
+  portEXIT_CRITICAL(&g_linkMux);
+  return link;
+}
+
+void handleGapEvent(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) {
+  if (event == ESP_GAP_BLE_PHY_UPDATE_COMPLETE_EVT &&
+      param->phy_update.status == ESP_BT_STATUS_SUCCESS) {
+    portENTER_CRITICAL(&g_linkMux);
+    g_link.phy = param->phy_update.tx_phy;
+    portEXIT_CRITICAL(&g_linkMux);
+    LOG_INFO(Ble, "BLE PHY tx=%u rx=%u", param->phy_update.tx_phy,
+                  param->phy_update.rx_phy);
+  } else if (event == ESP_GAP_BLE_SET_PKT_LENGTH_COMPLETE_EVT &&
+             param->pkt_data_length_cmpl.status == ESP_BT_STATUS_SUCCESS) {
+    portENTER_CRITICAL(&g_linkMux);
+    g_link.txOctets = param->pkt_data_length_cmpl.params.tx_len;
+    portEXIT_CRITICAL(&g_linkMux);
+    LOG_INFO(Ble, "BLE data length tx=%u rx=%u",
+                  param->pkt_data_length_cmpl.params.tx_len,
+                  param->pkt_data_length_cmpl.params.rx_len);
+  } else if (event == ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT) {
+    // Also fires when the central changes parameters on its own.
+    const bool ok = param->update_conn_params.status == ESP_BT_STATUS_SUCCESS;
+    portENTER_CRITICAL(&g_linkMux);
+    if (ok) {
+      g_link.interval = param->update_conn_params.conn_int;
+      g_link.latency = param->update_conn_params.latency;
+      g_link.timeout = param->update_conn_params.timeout;
+    }
+    g_link.lastUpdateOk = ok;
+    ++g_link.paramUpdates;
+    portEXIT_CRITICAL(&g_linkMux);
+    LOG_INFO(Ble, "BLE conn params %s interval=%u latency=%u timeout=%u",
+                  ok ? "updated" : "rejected", param->update_conn_params.conn_int,
+                  param->update_conn_params.latency, param->update_conn_params.timeout);
+  }
+}
 
 void buildDeviceName(char *outName, size_t outSize) {
   uint8_t mac[6] = {0};
@@ -20,25 +158,186 @@ void buildDeviceName(char *outName, size_t outSize) {
   snprintf(outName, outSize, "%s-%03X", cfg::kDeviceNamePrefix, suffix);
 }
 
-void writeLe16(uint8_t *buffer, size_t offset, uint16_t value) {
-  buffer[offset] = static_cast<uint8_t>(value & 0xFF);
-  buffer[offset + 1U] = static_cast<uint8_t>((value >> 8U) & 0xFF);
+// Keytel et al. (2005) male regression, kJ per minute; the intercept makes
+// it negative at low heart rates, which counts as zero.
+float energyKjPerMinute(uint16_t bpm) {
+  const float kj = -55.0969f + 0.6309f * static_cast<float>(bpm) +
+                   0.1988f * cfg::kEnergyWeightKg + 0.2017f * cfg::kEnergyAgeYears;
+  return kj > 0.0f ? kj : 0.0f;
+}
+
+// BLE2902 is deprecated in the core but still the only CCCD the Arduino GATT
+// server wires to notifications.
+BLE2902 *addCccd(BLECharacteristic *characteristic) {
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+  auto *ccc = new BLE2902();
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+  characteristic->addDescriptor(ccc);
+  return ccc;
+}
+
+ergo::VitalsReading toReading(const VitalData &data) {
+  ergo::VitalsReading reading;
+  reading.hr = data.hr;
+  reading.spo2X100 = data.spo2_x100;
+  reading.rri = data.rri;
+  reading.hrv = data.hrv;
+  reading.status = data.status;
+  return reading;
 }
 
 }  // namespace
 
+class BleManager::CharacteristicCallbacks : public BLECharacteristicCallbacks {
+ public:
+  explicit CharacteristicCallbacks(BleManager *owner) : owner_(owner) {}
+
+  // Called synchronously from notify(): the stream task for the stream, sync
+  // and file characteristics, the BLE task for the heart rate measurement.
+  void onStatus(BLECharacteristic *characteristic, Status status,
+                uint32_t /*code*/) override {
+    g_transport.reportStatus(characteristic, status == Status::SUCCESS_NOTIFY);
+  }
+
+  void onWrite(BLECharacteristic *characteristic) override {
+    if (characteristic == g_versionCharacteristic) {
+      takeVersionWrite(characteristic);
+      return;
+    }
+    if (characteristic == g_hrsControlPoint) {
+      if (characteristic->getLength() >= 1U &&
+          characteristic->getData()[0] == ergo::kHrcpResetEnergyExpended) {
+        portENTER_CRITICAL(&owner_->hrsMux_);
+        owner_->energyResetPending_ = true;
+        portEXIT_CRITICAL(&owner_->hrsMux_);
+      }
+      return;
+    }
+    if (characteristic == g_fileCharacteristic) {
+      takeFileCommand(characteristic);
+      return;
+    }
+    ergo::SyncCommand command;
+    if (characteristic != g_syncCharacteristic ||
+        !ergo::parseSyncCommand(characteristic->getData(), characteristic->getLength(),
+                                command)) {
+      return;
+    }
+    portENTER_CRITICAL(&owner_->syncMux_);
+    switch (command.opcode) {
+      case ergo::SyncOpcode::Start:
+        owner_->syncStart_ = command;
+        owner_->syncStartPending_ = true;
+        owner_->syncAckPending_ = false;
+        break;
+      case ergo::SyncOpcode::Ack:
+        owner_->syncAckSequence_ = command.sequence;
+        owner_->syncAckPending_ = true;
+        break;
+      case ergo::SyncOpcode::Stop:
+        owner_->syncStopPending_ = true;
+        owner_->syncStartPending_ = false;
+        break;
+    }
+    portEXIT_CRITICAL(&owner_->syncMux_);
+  }
+
+ private:
+  // Selects the vitals payload format for the rest of the connection;
+  // anything but 1 or 2 is ignored and reads back the format in use.
+  void takeVersionWrite(BLECharacteristic *characteristic) {
+    uint8_t requested = 0;
+    if (ergo::parseVitalsVersionWrite(characteristic->getData(), characteristic->getLength(),
+                                      requested)) {
+      owner_->payloadVersion_ = requested;
+      LOG_INFO(Ble, "BLE vitals payload v%u", static_cast<unsigned>(requested));
+    }
+    uint8_t version = owner_->payloadVersion_;
+    characteristic->setValue(&version, 1);
+  }
+
+  void takeFileCommand(BLECharacteristic *characteristic) {
+    ergo::FileCommand command;
+    if (!ergo::parseFileCommand(characteristic->getData(), characteristic->getLength(),
+                                command)) {
+      return;
+    }
+    portENTER_CRITICAL(&owner_->fileMux_);
+    switch (command.opcode) {
+      case ergo::FileOpcode::List:
+        owner_->fileListSequence_ = command.sequence;
+        owner_->fileListPending_ = true;
+        break;
+      case ergo::FileOpcode::Read:
+        owner_->fileRead_ = command;
+        owner_->fileReadPending_ = true;
+        owner_->fileAckPending_ = false;
+        break;
+      case ergo::FileOpcode::Ack:
+        owner_->fileAckOffset_ = command.offset;
+        owner_->fileAckPending_ = true;
+        break;
+      case ergo::FileOpcode::Stop:
+        owner_->fileStopPending_ = true;
+        owner_->fileReadPending_ = false;
+        break;
+    }
+    portEXIT_CRITICAL(&owner_->fileMux_);
+  }
+
+  BleManager *owner_;
+};
+
 class BleManager::ServerCallbacks : public BLEServerCallbacks {
  public:
   explicit ServerCallbacks(BleManager *owner) : owner_(owner) {}
 
-  void onConnect(BLEServer * /*server*/) override {
+  void onConnect(BLEServer * /*server*/, esp_ble_gatts_cb_param_t *param) override {
     owner_->deviceConnected_ = true;
-    Serial.println("BLE connected");
+    g_transport.setConnected(true);
+    LinkState fresh;
+    fresh.session = link().session + 1U;
+    fresh.connectedMs = millis();
+    memcpy(fresh.peer, param->connect.remote_bda, sizeof(fresh.peer));
+    fresh.interval = param->connect.conn_params.interval;
+    fresh.latency = param->connect.conn_params.latency;
+    fresh.timeout = param->connect.conn_params.timeout;
+    setLink(fresh);
+    // Both are requests; the central and controllers settle on what they
+    // support and report back through handleGapEvent().
+    esp_ble_gap_set_pkt_data_len(param->connect.remote_bda, cfg::kBleDataLength);
+    esp_ble_gap_set_preferred_phy(param->connect.remote_bda, 0,
+                                  ESP_BLE_GAP_PHY_2M_PREF_MASK,
+                                  ESP_BLE_GAP_PHY_2M_PREF_MASK,
+                                  ESP_BLE_GAP_PHY_OPTIONS_NO_PREF);
+    LOG_INFO(Ble, "BLE connected");
+    uiPostEvent(UiEvent::Ble);
+  }
+
+  void onMtuChanged(BLEServer * /*server*/, esp_ble_gatts_cb_param_t *param) override {
+    portENTER_CRITICAL(&g_linkMux);
+    g_link.mtu = param->mtu.mtu;
+    portEXIT_CRITICAL(&g_linkMux);
+    LOG_INFO(Ble, "BLE MTU %u", param->mtu.mtu);
   }
 
   void onDisconnect(BLEServer *server) override {
     owner_->deviceConnected_ = false;
-    Serial.println("BLE disconnected");
+    g_transport.setConnected(false);
+    // The next central gets the default format until it opts in itself.
+    owner_->payloadVersion_ = cfg::kBlePayloadVersion;
+    uint8_t version = cfg::kBlePayloadVersion;
+    g_versionCharacteristic->setValue(&version, 1);
+    LinkState idle;
+    idle.session = link().session;
+    setLink(idle);
+    LOG_INFO(Ble, "BLE disconnected");
+    uiPostEvent(UiEvent::Ble);
     server->getAdvertising()->start();
   }
 
@@ -50,7 +349,8 @@ void BleManager::begin() {
   buildDeviceName(deviceName_, sizeof(deviceName_));
 
   BLEDevice::init(deviceName_);
-  BLEDevice::setMTU(64);
+  BLEDevice::setMTU(cfg::kBleMtu);
+  BLEDevice::setCustomGapHandler(handleGapEvent);
 
   auto *security = new BLESecurity();
   security->setAuthenticationMode(ESP_LE_AUTH_REQ_SC_BOND);
@@ -62,66 +362,308 @@ void BleManager::begin() {
   callbacks_ = new ServerCallbacks(this);
   g_server->setCallbacks(callbacks_);
 
-  BLEService *service = g_server->createService(cfg::kServiceUuid);
+  BLEService *service =
+      g_server->createService(BLEUUID(cfg::kServiceUuid), cfg::kServiceHandles);
   g_characteristic = service->createCharacteristic(
       cfg::kCharacteristicUuid,
       BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_NOTIFY);
 
-#if defined(__GNUC__)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-#endif
-  auto *ccc = new BLE2902();
-#if defined(__GNUC__)
-#pragma GCC diagnostic pop
-#endif
+  BLE2902 *ccc = addCccd(g_characteristic);
   ccc->setNotifications(true);
-  g_characteristic->addDescriptor(ccc);
+
+  g_transport.attach(ergo::BleChannel::Vitals, g_characteristic, ccc);
 
   uint8_t initialPayload[cfg::kPayloadSize] = {0};
   g_characteristic->setValue(initialPayload, sizeof(initialPayload));
 
+  characteristicCallbacks_ = new CharacteristicCallbacks(this);
+  g_versionCharacteristic = service->createCharacteristic(
+      cfg::kVersionCharacteristicUuid,
+      BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_WRITE);
+  uint8_t payloadVersion = cfg::kBlePayloadVersion;
+  g_versionCharacteristic->setValue(&payloadVersion, 1);
+  g_versionCharacteristic->setCallbacks(characteristicCallbacks_);
+
+  g_streamCharacteristic = service->createCharacteristic(
+      cfg::kStreamCharacteristicUuid, BLECharacteristic::PROPERTY_NOTIFY);
+  g_streamCcc = addCccd(g_streamCharacteristic);
+  g_streamCharacteristic->setCallbacks(characteristicCallbacks_);
+  g_transport.attach(ergo::BleChannel::Stream, g_streamCharacteristic, g_streamCcc);
+
+  g_syncCharacteristic = service->createCharacteristic(
+      cfg::kSyncCharacteristicUuid, BLECharacteristic::PROPERTY_WRITE |
+                                        BLECharacteristic::PROPERTY_WRITE_NR |
+                                        BLECharacteristic::PROPERTY_NOTIFY);
+  g_syncCcc = addCccd(g_syncCharacteristic);
+  g_syncCharacteristic->setCallbacks(characteristicCallbacks_);
+  g_transport.attach(ergo::BleChannel::Sync, g_syncCharacteristic, g_syncCcc);
+
+  g_fileCharacteristic = service->createCharacteristic(
+      cfg::kFileCharacteristicUuid, BLECharacteristic::PROPERTY_WRITE |
+                                        BLECharacteristic::PROPERTY_WRITE_NR |
+                                        BLECharacteristic::PROPERTY_NOTIFY);
+  g_fileCcc = addCccd(g_fileCharacteristic);
+  g_fileCharacteristic->setCallbacks(characteristicCallbacks_);
+  g_transport.attach(ergo::BleChannel::File, g_fileCharacteristic, g_fileCcc);
+
   service->start();
 
+  // Standard Heart Rate Service for off-the-shelf apps and the gateway.
+  BLEService *hrsService = g_server->createService(BLEUUID(cfg::kHrsServiceUuid));
+  g_hrsMeasurement = hrsService->createCharacteristic(
+      BLEUUID(cfg::kHrsMeasurementUuid), BLECharacteristic::PROPERTY_NOTIFY);
+  g_hrsCcc = addCccd(g_hrsMeasurement);
+  g_hrsMeasurement->setCallbacks(characteristicCallbacks_);
+  g_transport.attach(ergo::BleChannel::HeartRate, g_hrsMeasurement, g_hrsCcc);
+
+  BLECharacteristic *location = hrsService->createCharacteristic(
+      BLEUUID(cfg::kHrsBodySensorLocationUuid), BLECharacteristic::PROPERTY_READ);
+  uint8_t wrist = ergo::kBodySensorLocationWrist;
+  location->setValue(&wrist, 1);
+
+  g_hrsControlPoint = hrsService->createCharacteristic(
+      BLEUUID(cfg::kHrsControlPointUuid), BLECharacteristic::PROPERTY_WRITE);
+  g_hrsControlPoint->setCallbacks(characteristicCallbacks_);
+  hrsService->start();
+
   BLEAdvertising *advertising = g_server->getAdvertising();
   advertising->addServiceUUID(cfg::kServiceUuid);
+  advertising->addServiceUUID(BLEUUID(cfg::kHrsServiceUuid));
   advertising->setScanResponse(true);
   advertising->start();
+  transport_ = &g_transport;
+}
+
+void BleManager::setRawSampleSource(const RawSampleRing *source) {
+  rawSource_ = source;
+  streamCursor_ = source != nullptr ? source->head() : 0;
+}
+
+void BleManager::setBeatSource(const BeatRing *source) {
+  beatSource_ = source;
+  beatCursor_ = source != nullptr ? source->head() : 0;
 }
 
+void BleManager::setHistory(VitalsHistory *history) { history_ = history; }
+
+void BleManager::setRecordings(RecordingManager *recordings) { recordings_ = recordings; }
+
 void BleManager::packPayload(const VitalData &data,
                              uint8_t payload[cfg::kPayloadSize]) {
-  memset(payload, 0, cfg::kPayloadSize);
-  writeLe16(payload, 0, data.hr);
-  writeLe16(payload, 2, data.spo2_x100);
-  writeLe16(payload, 4, data.rri);
-  writeLe16(payload, 6, data.hrv);
-  payload[8] = data.status;
-  payload[9] = sequenceCounter_++;
-  payload[10] = 0x00;
-  payload[11] = 0x00;
-}
-
-void BleManager::publishLatest(const VitalData &data) {
+  ergo::encodeVitalsPayloadV1(toReading(data), sequenceCounter_++, payload);
+}
+
+void BleManager::publishLatest(const VitalData &data, bool sensorContact,
+                               bool scheduled) {
   if (!enabled_) {
     return;
   }
 
+  const uint32_t nowMs = millis();
+  if (scheduled) {
+    accumulateEnergy(sensorContact ? data.hr : 0U, nowMs);
+  }
+  const bool vitalsDue = publishDue(data, sensorContact, scheduled, nowMs);
+  // In beat-synchronous mode a new beat only sends a Heart Rate Measurement;
+  // the custom payload waits for a change worth reporting.
+  const bool beatsDue = cfg::kBlePublishMode == BlePublishMode::BeatSync &&
+                        beatSource_ != nullptr && beatSource_->head() != beatHead_;
+  if (vitalsDue || beatsDue) {
+    if (beatSource_ != nullptr) {
+      beatHead_ = beatSource_->head();
+    }
+    publishHeartRate(data, sensorContact);
+  }
+  const uint8_t version = payloadVersion_;
+  if (version != batchVersion_) {
+    // Readings queued under the other format are not re-encoded; the
+    // history sync still has them.
+    batcher_.clear();
+    batchVersion_ = version;
+  }
+  const bool batched = version == ergo::kVitalsPayloadV2;
+  bool send = vitalsDue;
+  if (batched) {
+    // Readings are the 1 Hz rows: the tick that sees a change sends the
+    // batch, otherwise it goes out when full.
+    if (scheduled) {
+      queueReading(data);
+    }
+    send = scheduled &&
+           (batcher_.full() ||
+            (cfg::kBlePublishMode == BlePublishMode::BeatSync && vitalsDue));
+  }
+  if (!send) {
+    return;
+  }
+  published_ = true;
+  lastPublished_ = data;
+  lastContact_ = sensorContact;
+  lastPublishMs_ = nowMs;
+  if (batched) {
+    sendReadings();
+    return;
+  }
+
   uint8_t payload[cfg::kPayloadSize] = {0};
   packPayload(data, payload);
 
-  if (g_characteristic == nullptr) {
+  if (transport_ == nullptr) {
+    return;
+  }
+  transport_->notify(ergo::BleChannel::Vitals, payload, sizeof(payload));
+
+  LOG_DEBUG(Ble, "BLE status=%s seq=%u hr=%u rri=%u hrv=%u hrs=%lu beats_lost=%lu",
+                 deviceConnected_ ? "connected" : "idle",
+                 static_cast<unsigned>(payload[9]), data.hr, data.rri, data.hrv,
+                 static_cast<unsigned long>(hrsMeasurements_),
+                 static_cast<unsigned long>(beatsDropped_));
+}
+
+void BleManager::queueReading(const VitalData &data) {
+  const uint32_t sequence =
+      history_ != nullptr ? history_->nextSequence() - 1U : readingSequence_++;
+  const ergo::VitalsReading reading = toReading(data);
+  if (!batcher_.add(sequence, reading)) {
+    sendReadings();
+    batcher_.add(sequence, reading);
+  }
+}
+
+// Sends the queued readings in as few v2 notifications as the MTU allows.
+void BleManager::sendReadings() {
+  const size_t count = batcher_.count();
+  if (transport_ == nullptr || count == 0U) {
+    batcher_.clear();
     return;
   }
+  const ergo::VitalsReading last = readings_[count - 1U];
+  const uint32_t firstSequence = batcher_.firstSequence();
+  const uint16_t mtu = link().mtu < cfg::kBleMtu ? link().mtu : cfg::kBleMtu;
+  uint8_t payload[cfg::kBleMtu - ergo::kAttHeaderSize];
+  size_t notifications = 0;
+  size_t bytes = 0;
+  ergo::VitalsPayloadHeader header;
+  header.sequence = sequenceCounter_;
+  for (;;) {
+    const size_t size = batcher_.next(
+        header, payload, mtu > ergo::kAttHeaderSize ? mtu - ergo::kAttHeaderSize : 0U);
+    if (size == 0U) {
+      break;
+    }
+    transport_->notify(ergo::BleChannel::Vitals, payload, size);
+    header.sequence = ++sequenceCounter_;
+    bytes += size;
+    ++notifications;
+  }
+  // Whatever did not fit is dropped, as a lost notification would be.
+  batcher_.clear();
+
+  LOG_DEBUG(Ble, "BLE status=%s v2 seq=%lu+%u in %u notify/%uB hr=%u rri=%u hrv=%u "
+                 "hrs=%lu beats_lost=%lu",
+                 deviceConnected_ ? "connected" : "idle",
+                 static_cast<unsigned long>(firstSequence), static_cast<unsigned>(count),
+                 static_cast<unsigned>(notifications), static_cast<unsigned>(bytes),
+                 last.hr, last.rri, last.hrv,
+                 static_cast<unsigned long>(hrsMeasurements_),
+                 static_cast<unsigned long>(beatsDropped_));
+}
+
+// Whether the custom vitals payload should go out now.
+bool BleManager::publishDue(const VitalData &data, bool sensorContact,
+                            bool scheduled, uint32_t nowMs) const {
+  if (cfg::kBlePublishMode == BlePublishMode::Periodic || !published_) {
+    return scheduled;
+  }
+  const uint32_t sinceLastMs = nowMs - lastPublishMs_;
+  if (sinceLastMs >= cfg::kBleMaxPublishIntervalMs) {
+    return true;
+  }
+  if (sinceLastMs < cfg::kBleMinPublishIntervalMs) {
+    return false;
+  }
+  if (data.status != lastPublished_.status || sensorContact != lastContact_) {
+    return true;
+  }
+  const auto moved = [](uint16_t current, uint16_t previous, uint16_t deadband) {
+    return (current > previous ? current - previous : previous - current) >= deadband;
+  };
+  return moved(data.hr, lastPublished_.hr, cfg::kBleHrDeadbandBpm) ||
+         moved(data.spo2_x100, lastPublished_.spo2_x100, cfg::kBleSpo2DeadbandX100) ||
+         moved(data.hrv, lastPublished_.hrv, cfg::kBleHrvDeadbandMs);
+}
+
+void BleManager::publishHeartRate(const VitalData &data, bool sensorContact) {
+  if (!deviceConnected_ || beatSource_ == nullptr || transport_ == nullptr ||
+      !transport_->subscribed(ergo::BleChannel::HeartRate)) {
+    hrsSubscribed_ = false;
+    return;
+  }
+  if (!hrsSubscribed_) {
+    // Beats from before the subscription are not part of this session.
+    hrsSubscribed_ = true;
+    beatCursor_ = beatSource_->head();
+    hrsMeasurements_ = 0;
+    rrConverter_.reset();
+  }
+
+  BeatEvent beats[cfg::kBeatRingSize];
+  uint32_t dropped = 0;
+  const size_t beatCount =
+      beatSource_->read(beatCursor_, beats, cfg::kBeatRingSize, &dropped);
+  beatsDropped_ += dropped;
+  uint16_t rr1024[cfg::kBeatRingSize];
+  for (size_t i = 0; i < beatCount; ++i) {
+    rr1024[i] = rrConverter_.convert(beats[i].rriMs);
+  }
+
+  ergo::HeartRateMeasurement measurement;
+  measurement.bpm = data.hr;
+  measurement.contactSupported = true;
+  measurement.contactDetected = sensorContact;
+  measurement.hasEnergy = (hrsMeasurements_ % cfg::kHrsEnergyEveryN) == 0U;
+  measurement.energyKj = energyKj_ < static_cast<float>(ergo::kHrmEnergyMaxKj)
+                             ? static_cast<uint16_t>(energyKj_)
+                             : ergo::kHrmEnergyMaxKj;
 
-  g_characteristic->setValue(payload, sizeof(payload));
-  if (deviceConnected_) {
-    g_characteristic->notify();
+  // Intervals that do not fit one notification follow in the next ones, so
+  // none are dropped even at the default MTU.
+  const uint16_t mtu = link().mtu;
+  uint8_t frame[cfg::kBleMtu];
+  size_t sent = 0;
+  do {
+    size_t count = ergo::heartRateRrCapacity(measurement, mtu);
+    const size_t limit = ergo::heartRateRrCapacity(measurement, cfg::kBleMtu);
+    count = count < limit ? count : limit;
+    count = count < beatCount - sent ? count : beatCount - sent;
+    const size_t size =
+        ergo::serializeHeartRateMeasurement(measurement, rr1024 + sent, count, frame);
+    if (!transport_->notify(ergo::BleChannel::HeartRate, frame, size)) {
+      beatsDropped_ += static_cast<uint32_t>(beatCount - sent);
+      break;
+    }
+    ++hrsMeasurements_;
+    sent += count;
+    measurement.hasEnergy = false;
+  } while (sent < beatCount);
+}
+
+void BleManager::accumulateEnergy(uint16_t bpm, uint32_t nowMs) {
+  portENTER_CRITICAL(&hrsMux_);
+  const bool reset = energyResetPending_;
+  energyResetPending_ = false;
+  portEXIT_CRITICAL(&hrsMux_);
+  if (reset) {
+    energyKj_ = 0.0f;
   }
 
-  Serial.printf("BLE status=%s seq=%u hr=%u rri=%u hrv=%u\n",
-                deviceConnected_ ? "connected" : "idle",
-                static_cast<unsigned>(payload[9]), data.hr, data.rri, data.hrv);
+  const uint32_t elapsedMs = lastEnergyMs_ != 0U ? nowMs - lastEnergyMs_ : 0U;
+  lastEnergyMs_ = nowMs;
+  // Longer gaps mean the band was asleep or the task stalled; skip them.
+  if (bpm == 0U || elapsedMs > 5U * cfg::kBlePublishPeriodMs) {
+    return;
+  }
+  energyKj_ += energyKjPerMinute(bpm) * static_cast<float>(elapsedMs) / 60000.0f;
 }
 
 void BleManager::setEnabled(bool enabled) {
@@ -141,6 +683,595 @@ void BleManager::setEnabled(bool enabled) {
   }
 }
 
+void BleManager::pumpStream() {
+  const uint32_t nowMs = millis();
+  if (!enabled_ || !deviceConnected_ || rawSource_ == nullptr ||
+      transport_ == nullptr || !transport_->subscribed(ergo::BleChannel::Stream)) {
+    if (streaming_) {
+      streaming_ = false;
+      pendingCount_ = 0;
+      portENTER_CRITICAL(&statsMux_);
+      stats_.subscribed = false;
+      portEXIT_CRITICAL(&statsMux_);
+    }
+    updateStreamRates(nowMs);
+    return;
+  }
+
+  if (!streaming_) {
+    // Start live: the phone wants the current signal, not a backlog.
+    streaming_ = true;
+    streamCursor_ = rawSource_->head();
+    pendingCount_ = 0;
+    portENTER_CRITICAL(&statsMux_);
+    stats_.subscribed = true;
+    portEXIT_CRITICAL(&statsMux_);
+  }
+
+  const size_t capacity = sizeof(pending_) / sizeof(pending_[0]);
+  const size_t fit = ergo::streamSamplesPerFrame(link().mtu);
+  const size_t perFrame = fit < capacity ? fit : capacity;
+  if (perFrame == 0U) {
+    updateStreamRates(nowMs);
+    return;
+  }
+
+  uint32_t dropped = 0;
+  for (;;) {
+    if (pendingCount_ < perFrame) {
+      const size_t count = rawSource_->read(streamCursor_, pending_ + pendingCount_,
+                                            perFrame - pendingCount_, &dropped);
+      const uint32_t readIndex = streamCursor_ - static_cast<uint32_t>(count);
+      if (pendingCount_ == 0U) {
+        pendingIndex_ = readIndex;
+        pendingCount_ = count;
+      } else if (count > 0U &&
+                 readIndex != pendingIndex_ + static_cast<uint32_t>(pendingCount_)) {
+        // The ring lapped us. Frames hold consecutive samples, so the ones
+        // before the gap go out on their own.
+        pendingCount_ += count;
+        while (pendingCount_ > count) {
+          sendStreamFrame(pendingCount_ - count);
+        }
+        pendingIndex_ = readIndex;
+      } else {
+        pendingCount_ += count;
+      }
+    }
+    if (pendingCount_ < perFrame) {
+      break;
+    }
+    sendStreamFrame(perFrame);
+  }
+
+  if (pendingCount_ > 0U &&
+      (nowMs - pending_[0].timestampMs) >= cfg::kBleStreamMaxLatencyMs) {
+    while (pendingCount_ > 0U) {
+      sendStreamFrame(pendingCount_);
+    }
+  }
+
+  if (dropped > 0U) {
+    portENTER_CRITICAL(&statsMux_);
+    stats_.samplesDropped += dropped;
+    portEXIT_CRITICAL(&statsMux_);
+  }
+  updateStreamRates(nowMs);
+}
+
+void BleManager::sendStreamFrame(size_t count) {
+  uint8_t frame[ergo::streamFrameSize(sizeof(pending_) / sizeof(pending_[0]))];
+  ergo::StreamFrameHeader header;
+  header.sequence = streamSequence_++;
+  header.firstSampleIndex = pendingIndex_;
+  header.firstSampleMs = pending_[0].timestampMs;
+  ergo::serializeStreamHeader(header, frame);
+
+  // A pause longer than one delta byte can express ends the frame early.
+  size_t sent = 0;
+  uint32_t previousMs = header.firstSampleMs;
+  while (sent < count &&
+         pending_[sent].timestampMs - previousMs <= ergo::kStreamMaxDeltaMs) {
+    const RawSample &raw = pending_[sent];
+    ergo::StreamSample sample;
+    sample.timestampMs = raw.timestampMs;
+    sample.ir = raw.ir;
+    sample.red = raw.red;
+    sample.accelXmg = raw.accelXmg;
+    sample.accelYmg = raw.accelYmg;
+    sample.accelZmg = raw.accelZmg;
+    ergo::serializeStreamSample(sample, previousMs,
+                                frame + ergo::streamFrameSize(sent));
+    previousMs = raw.timestampMs;
+    ++sent;
+  }
+
+  const size_t size = ergo::streamFrameSize(sent);
+  const bool ok = transport_->notify(ergo::BleChannel::Stream, frame, size);
+
+  pendingCount_ -= sent;
+  pendingIndex_ += static_cast<uint32_t>(sent);
+  memmove(pending_, pending_ + sent, pendingCount_ * sizeof(RawSample));
+
+  portENTER_CRITICAL(&statsMux_);
+  if (!ok) {
+    ++stats_.notifyErrors;
+  } else {
+    ++stats_.framesSent;
+    stats_.samplesSent += static_cast<uint32_t>(sent);
+  }
+  portEXIT_CRITICAL(&statsMux_);
+  if (ok) {
+    rateWindowBytes_ += static_cast<uint32_t>(size);
+    rateWindowSamples_ += static_cast<uint32_t>(sent);
+  }
+}
+
+void BleManager::updateStreamRates(uint32_t nowMs) {
+  const uint32_t elapsedMs = nowMs - rateWindowStartMs_;
+  if (elapsedMs < 1000U) {
+    return;
+  }
+  portENTER_CRITICAL(&statsMux_);
+  stats_.bytesPerSecond = (rateWindowBytes_ * 1000U) / elapsedMs;
+  stats_.samplesPerSecond = (rateWindowSamples_ * 1000U) / elapsedMs;
+  portEXIT_CRITICAL(&statsMux_);
+  rateWindowStartMs_ = nowMs;
+  rateWindowBytes_ = 0;
+  rateWindowSamples_ = 0;
+}
+
+void BleManager::pumpSync() {
+  const uint32_t nowMs = millis();
+  takeSyncCommands(nowMs);
+  if (!syncActive_) {
+    return;
+  }
+  if (!deviceConnected_ || history_ == nullptr || transport_ == nullptr) {
+    // The central resumes with a new Start from its last good sequence.
+    syncActive_ = false;
+    return;
+  }
+  if (!transport_->subscribed(ergo::BleChannel::Sync)) {
+    return;
+  }
+  lastBulkMs_ = nowMs;
+
+  const size_t perFrame = ergo::syncRecordsPerFrame(link().mtu);
+  if (perFrame == 0U) {
+    return;
+  }
+  if (syncNext_ != syncAcked_ && (nowMs - syncLastAckMs_) >= cfg::kSyncAckTimeoutMs) {
+    // Go back to the last acknowledged record.
+    syncNext_ = syncAcked_;
+    syncLastAckMs_ = nowMs;
+    ++syncResends_;
+  }
+
+  for (uint8_t frame = 0; frame < cfg::kSyncMaxFramesPerPump; ++frame) {
+    if (syncNext_ - syncAcked_ >= syncWindow_ * perFrame) {
+      return;
+    }
+    if (!sendSyncFrame(perFrame)) {
+      if (syncNext_ == syncAcked_) {
+        finishSync();
+      }
+      return;
+    }
+  }
+}
+
+void BleManager::takeSyncCommands(uint32_t nowMs) {
+  portENTER_CRITICAL(&syncMux_);
+  const bool stop = syncStopPending_;
+  const bool start = syncStartPending_;
+  const bool ack = syncAckPending_;
+  const ergo::SyncCommand startCommand = syncStart_;
+  const uint32_t ackSequence = syncAckSequence_;
+  syncStopPending_ = false;
+  syncStartPending_ = false;
+  syncAckPending_ = false;
+  portEXIT_CRITICAL(&syncMux_);
+
+  if (stop) {
+    syncActive_ = false;
+  }
+  if (start) {
+    syncActive_ = true;
+    syncWindow_ = startCommand.window;
+    syncNext_ = startCommand.sequence;
+    syncAcked_ = startCommand.sequence;
+    syncLastAckMs_ = nowMs;
+    syncStartMs_ = nowMs;
+    syncRecordsSent_ = 0;
+    syncResends_ = 0;
+    LOG_INFO(Ble, "BLE sync from seq=%lu window=%u",
+                  static_cast<unsigned long>(startCommand.sequence), startCommand.window);
+  }
+  // Acks only move forward; a read gap may also move them past syncNext_.
+  if (ack && syncActive_ && ackSequence - syncAcked_ < 0x80000000U) {
+    syncAcked_ = ackSequence;
+    syncLastAckMs_ = nowMs;
+    if (syncNext_ - syncAcked_ >= 0x80000000U) {
+      syncNext_ = syncAcked_;
+    }
+  }
+}
+
+bool BleManager::sendSyncFrame(size_t perFrame) {
+  constexpr size_t kMaxRecords = ergo::syncRecordsPerFrame(cfg::kBleMtu);
+  ergo::VitalsRecord records[kMaxRecords];
+  uint32_t sequence = syncNext_;
+  const size_t count =
+      history_->read(sequence, records, perFrame < kMaxRecords ? perFrame : kMaxRecords);
+  if (count == 0U) {
+    return false;
+  }
+
+  uint8_t frame[ergo::kSyncDataHeaderSize + kMaxRecords * ergo::kVitalsRecordSize];
+  frame[0] = static_cast<uint8_t>(ergo::SyncFrameType::Data);
+  frame[1] = static_cast<uint8_t>(count);
+  ergo::writeLe32(frame + 2, syncNext_);
+  for (size_t i = 0; i < count; ++i) {
+    ergo::serializeVitalsRecord(
+        records[i], frame + ergo::kSyncDataHeaderSize + i * ergo::kVitalsRecordSize);
+  }
+  if (!transport_->notify(ergo::BleChannel::Sync, frame,
+                          ergo::kSyncDataHeaderSize + count * ergo::kVitalsRecordSize)) {
+    // Leave syncNext_ alone; the next pump retries the same records.
+    return false;
+  }
+  syncNext_ = sequence + static_cast<uint32_t>(count);
+  syncRecordsSent_ += static_cast<uint32_t>(count);
+  rateWindowBytes_ +=
+      static_cast<uint32_t>(ergo::kSyncDataHeaderSize + count * ergo::kVitalsRecordSize);
+  return true;
+}
+
+void BleManager::finishSync() {
+  uint8_t frame[ergo::kSyncDoneSize] = {0};
+  frame[0] = static_cast<uint8_t>(ergo::SyncFrameType::Done);
+  ergo::writeLe32(frame + 2, history_->nextSequence());
+  ergo::writeLe32(frame + 6, history_->oldestSequence());
+  if (!transport_->notify(ergo::BleChannel::Sync, frame, sizeof(frame))) {
+    return;
+  }
+  syncActive_ = false;
+  LOG_INFO(Ble, "BLE sync done: %lu rows in %lu ms, %lu resends",
+                static_cast<unsigned long>(syncRecordsSent_),
+                static_cast<unsigned long>(millis() - syncStartMs_),
+                static_cast<unsigned long>(syncResends_));
+}
+
+void BleManager::pumpFiles() {
+  const uint32_t nowMs = millis();
+  takeFileCommands(nowMs);
+  if (!fileOpen_) {
+    return;
+  }
+  if (!deviceConnected_ || transport_ == nullptr) {
+    // The central resumes with a new Read from the offset it has.
+    closeFile();
+    return;
+  }
+  if (!transport_->subscribed(ergo::BleChannel::File)) {
+    return;
+  }
+  lastBulkMs_ = nowMs;
+
+  const size_t fit = ergo::fileChunkSize(link().mtu);
+  const size_t limit = ergo::fileChunkSize(cfg::kBleMtu);
+  const size_t chunkSize = fit < limit ? fit : limit;
+  if (chunkSize == 0U) {
+    sendFileError(ergo::FileError::MtuTooSmall);
+    closeFile();
+    return;
+  }
+  fileSender_.checkTimeout(nowMs, cfg::kFileAckTimeoutMs);
+  fileEnd_ = recordings_->transferSize(fileActive_);
+
+  for (uint8_t frame = 0; frame < cfg::kFileMaxFramesPerPump; ++frame) {
+    if (!sendFileChunk(chunkSize)) {
+      break;
+    }
+  }
+  if (fileOpen_ && fileSender_.complete(fileEnd_)) {
+    finishFile();
+  }
+}
+
+void BleManager::takeFileCommands(uint32_t nowMs) {
+  portENTER_CRITICAL(&fileMux_);
+  const bool list = fileListPending_;
+  const bool read = fileReadPending_;
+  const bool ack = fileAckPending_;
+  const bool stop = fileStopPending_;
+  const uint32_t listSequence = fileListSequence_;
+  const ergo::FileCommand readCommand = fileRead_;
+  const uint32_t ackOffset = fileAckOffset_;
+  fileListPending_ = false;
+  fileReadPending_ = false;
+  fileAckPending_ = false;
+  fileStopPending_ = false;
+  portEXIT_CRITICAL(&fileMux_);
+
+  if (stop) {
+    closeFile();
+  }
+  if (list) {
+    sendFileList(listSequence);
+  }
+  if (read) {
+    const bool sameFile = fileOpen_ && fileSequence_ == readCommand.sequence &&
+                          fileErg_ == readCommand.erg;
+    if (!sameFile) {
+      closeFile();
+      if (recordings_ == nullptr || !recordings_->sdReady()) {
+        sendFileError(ergo::FileError::NoCard);
+        return;
+      }
+      if (!recordings_->openTransfer(readCommand.sequence, readCommand.erg)) {
+        sendFileError(ergo::FileError::NotFound);
+        return;
+      }
+      fileOpen_ = true;
+      fileSequence_ = readCommand.sequence;
+      fileErg_ = readCommand.erg;
+      fileBufferCount_ = 0;
+    }
+    // A repeated Read of the open file is a resume: only the window restarts.
+    fileSender_.start(readCommand.offset, readCommand.window, nowMs);
+    fileStartMs_ = nowMs;
+    fileStartOffset_ = readCommand.offset;
+    LOG_INFO(Ble, "BLE file REC%06lu%s from %lu window=%u",
+                  static_cast<unsigned long>(readCommand.sequence),
+                  readCommand.erg ? ".erg" : ".csv",
+                  static_cast<unsigned long>(readCommand.offset), readCommand.window);
+  }
+  if (ack && fileOpen_) {
+    fileSender_.ack(ackOffset, nowMs);
+  }
+}
+
+// Sends one page of whole sequences, so the central asks for the next page
+// from the sequence after the last one it got.
+void BleManager::sendFileList(uint32_t fromSequence) {
+  if (recordings_ == nullptr || !recordings_->sdReady()) {
+    sendFileError(ergo::FileError::NoCard);
+    return;
+  }
+  ergo::FileEntry entries[cfg::kFileListMaxEntries];
+  const size_t count =
+      recordings_->listRecordings(fromSequence, entries, cfg::kFileListMaxEntries);
+  // A full listing may have cut the last sequence's .erg off.
+  size_t usable = count;
+  if (count == cfg::kFileListMaxEntries) {
+    while (usable > 0U && entries[usable - 1U].sequence == entries[count - 1U].sequence) {
+      --usable;
+    }
+  }
+
+  const uint16_t mtu = link().mtu < cfg::kBleMtu ? link().mtu : cfg::kBleMtu;
+  const size_t capacity = mtu > ergo::kAttHeaderSize ? mtu - ergo::kAttHeaderSize : 0U;
+  uint8_t frame[cfg::kBleMtu - ergo::kAttHeaderSize];
+  size_t size = ergo::kFileListHeaderSize;
+  size_t included = 0;
+  while (included < usable) {
+    size_t end = included;
+    size_t groupSize = 0;
+    while (end < usable && entries[end].sequence == entries[included].sequence) {
+      groupSize += ergo::fileEntrySize(entries[end++]);
+    }
+    if (size + groupSize > capacity) {
+      break;
+    }
+    for (; included < end; ++included) {
+      size += ergo::serializeFileEntry(entries[included], frame + size);
+    }
+  }
+  if (included == 0U && usable > 0U) {
+    sendFileError(ergo::FileError::MtuTooSmall);
+    return;
+  }
+
+  frame[0] = static_cast<uint8_t>(ergo::FileFrameType::List);
+  frame[1] = included == count && count < cfg::kFileListMaxEntries ? ergo::kFileListLast
+                                                                    : 0U;
+  frame[2] = static_cast<uint8_t>(included);
+  sendFileFrame(frame, size);
+}
+
+bool BleManager::sendFileChunk(size_t chunkSize) {
+  uint32_t offset = 0;
+  size_t count = 0;
+  if (!fileSender_.nextChunk(fileEnd_, chunkSize, offset, count)) {
+    return false;
+  }
+  const uint8_t *bytes = fileBytes(offset, count);
+  if (bytes == nullptr) {
+    sendFileError(ergo::FileError::ReadFailed);
+    closeFile();
+    return false;
+  }
+  uint8_t frame[ergo::kFileDataHeaderSize + ergo::fileChunkSize(cfg::kBleMtu)];
+  const size_t size = ergo::serializeFileData(offset, bytes, count, frame);
+  if (!sendFileFrame(frame, size)) {
+    // Leave the sender alone; the next pump retries the same chunk.
+    return false;
+  }
+  fileSender_.sent(count);
+  rateWindowBytes_ += static_cast<uint32_t>(size);
+  return true;
+}
+
+// Chunks are served from fileBuffer_, refilled from the requested offset when
+// they fall outside it (first read, sequential progress or a go-back).
+const uint8_t *BleManager::fileBytes(uint32_t offset, size_t count) {
+  if (offset < fileBufferOffset_ ||
+      offset + count > fileBufferOffset_ + static_cast<uint32_t>(fileBufferCount_)) {
+    fileBufferOffset_ = offset;
+    fileBufferCount_ = recordings_->readTransfer(offset, fileBuffer_, sizeof(fileBuffer_));
+  }
+  if (offset + count > fileBufferOffset_ + static_cast<uint32_t>(fileBufferCount_)) {
+    fileBufferCount_ = 0;
+    return nullptr;
+  }
+  return fileBuffer_ + (offset - fileBufferOffset_);
+}
+
+bool BleManager::sendFileFrame(const uint8_t *frame, size_t size) {
+  return transport_->notify(ergo::BleChannel::File, frame, size);
+}
+
+void BleManager::sendFileError(ergo::FileError error) {
+  uint8_t frame[ergo::kFileErrorSize] = {
+      static_cast<uint8_t>(ergo::FileFrameType::Error), static_cast<uint8_t>(error)};
+  sendFileFrame(frame, sizeof(frame));
+}
+
+void BleManager::finishFile() {
+  uint8_t frame[ergo::kFileDoneSize];
+  frame[0] = static_cast<uint8_t>(ergo::FileFrameType::Done);
+  frame[1] = static_cast<uint8_t>((fileErg_ ? ergo::kFileFlagErg : 0U) |
+                                  (fileActive_ ? ergo::kFileFlagActive : 0U));
+  ergo::writeLe32(frame + 2, fileEnd_);
+  if (!sendFileFrame(frame, sizeof(frame))) {
+    return;
+  }
+  const uint32_t elapsedMs = millis() - fileStartMs_;
+  const uint32_t bytes = fileEnd_ - fileStartOffset_;
+  LOG_INFO(Ble, "BLE file done: %lu bytes in %lu ms (%lu B/s), %lu resends%s",
+                static_cast<unsigned long>(bytes), static_cast<unsigned long>(elapsedMs),
+                static_cast<unsigned long>(elapsedMs > 0U ? bytes * 1000ULL / elapsedMs : 0U),
+                static_cast<unsigned long>(fileSender_.resends()),
+                fileActive_ ? ", still recording" : "");
+  closeFile();
+}
+
+void BleManager::closeFile() {
+  if (!fileOpen_) {
+    return;
+  }
+  fileOpen_ = false;
+  fileBufferCount_ = 0;
+  if (recordings_ != nullptr) {
+    recordings_->closeTransfer();
+  }
+}
+
+namespace {
+
+const BleConnParams &connParamsFor(BleConnProfile profile, uint8_t attempt) {
+  if (profile == BleConnProfile::Fast) {
+    return attempt == 0U ? cfg::kBleConnFast : cfg::kBleConnFastFallback;
+  }
+  return attempt == 0U ? cfg::kBleConnLowPower : cfg::kBleConnLowPowerFallback;
+}
+
+}  // namespace
+
+void BleManager::pumpConnection() {
+  const uint32_t nowMs = millis();
+  const LinkState current = link();
+  if (!deviceConnected_ || g_server == nullptr) {
+    connRequestPending_ = false;
+    return;
+  }
+  if (current.session != connSession_) {
+    connSession_ = current.session;
+    connSeenUpdates_ = current.paramUpdates;
+    connTarget_ = BleConnProfile::Central;
+    connAttempt_ = 0;
+    connRequestPending_ = false;
+    portENTER_CRITICAL(&statsMux_);
+    stats_.connProfile = BleConnProfile::Central;
+    stats_.connRejects = 0;
+    portEXIT_CRITICAL(&statsMux_);
+  }
+  if (nowMs - current.connectedMs < cfg::kBleConnSettleMs) {
+    return;
+  }
+
+  if (connRequestPending_) {
+    if (current.paramUpdates != connSeenUpdates_) {
+      connSeenUpdates_ = current.paramUpdates;
+      const BleConnParams &wanted = connParamsFor(connTarget_, connAttempt_);
+      // A central may answer with its own values instead of a rejection.
+      if (current.lastUpdateOk && current.interval >= wanted.minInterval &&
+          current.interval <= wanted.maxInterval) {
+        connRequestPending_ = false;
+        portENTER_CRITICAL(&statsMux_);
+        stats_.connProfile = connTarget_;
+        portEXIT_CRITICAL(&statsMux_);
+      } else {
+        connParamsRejected(nowMs);
+      }
+    } else if (nowMs - connRequestMs_ >= cfg::kBleConnResponseTimeoutMs) {
+      connParamsRejected(nowMs);
+    }
+    if (connRequestPending_) {
+      return;
+    }
+  }
+  connSeenUpdates_ = current.paramUpdates;
+
+  if (streaming_) {
+    lastBulkMs_ = nowMs;
+  }
+  const BleConnProfile target = nowMs - lastBulkMs_ < cfg::kBleConnIdleHoldMs
+                                    ? BleConnProfile::Fast
+                                    : BleConnProfile::LowPower;
+  if (target != connTarget_) {
+    connTarget_ = target;
+    connAttempt_ = 0;
+    requestConnParams(nowMs);
+  }
+}
+
+void BleManager::requestConnParams(uint32_t nowMs) {
+  const BleConnParams &params = connParamsFor(connTarget_, connAttempt_);
+  // Non-const: updateConnParams() takes the address by pointer.
+  LinkState current = link();
+  g_server->updateConnParams(current.peer, params.minInterval, params.maxInterval,
+                             params.latency, params.timeout);
+  connRequestPending_ = true;
+  connRequestMs_ = nowMs;
+  LOG_INFO(Ble, "BLE requesting %s conn params%s: %u-%u latency=%u",
+                connTarget_ == BleConnProfile::Fast ? "fast" : "low-power",
+                connAttempt_ > 0U ? " (fallback)" : "", params.minInterval,
+                params.maxInterval, params.latency);
+}
+
+void BleManager::connParamsRejected(uint32_t nowMs) {
+  portENTER_CRITICAL(&statsMux_);
+  ++stats_.connRejects;
+  portEXIT_CRITICAL(&statsMux_);
+  ++connAttempt_;
+  if (connAttempt_ < 2U) {
+    requestConnParams(nowMs);
+    return;
+  }
+  // Keep whatever the central chose until the workload changes.
+  connRequestPending_ = false;
+  portENTER_CRITICAL(&statsMux_);
+  stats_.connProfile = BleConnProfile::Central;
+  portEXIT_CRITICAL(&statsMux_);
+}
+
+BleStreamStats BleManager::streamStats() const {
+  portENTER_CRITICAL(const_cast<portMUX_TYPE *>(&statsMux_));
+  BleStreamStats stats = stats_;
+  portEXIT_CRITICAL(const_cast<portMUX_TYPE *>(&statsMux_));
+  const LinkState current = link();
+  stats.mtu = current.mtu;
+  stats.txOctets = current.txOctets;
+  stats.phy = current.phy;
+  stats.connInterval = current.interval;
+  stats.connLatency = current.latency;
+  stats.connTimeout = current.timeout;
+  return stats;
+}
+
 bool BleManager::isConnected() const { return deviceConnected_; }
 
 const char *BleManager::deviceName() const { return deviceName_; }
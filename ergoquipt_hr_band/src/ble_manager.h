@@ -2,24 +2,203 @@
 
 #include <Arduino.h>
 
+#include <ble_transport.h>
+#include <file_transfer.h>
+#include <heart_rate_measurement.h>
+#include <stream_format.h>
+#include <vitals_payload.h>
+#include <vitals_sync.h>
+
 #include "config.h"
+#include "recording_manager.h"
+#include "sensor_manager.h"
+#include "vitals_history.h"
+
+enum class BleConnProfile : uint8_t {
+  // No request made yet or both requests rejected: central's choice.
+  Central = 0,
+  LowPower = 1,
+  Fast = 2,
+};
+
+struct BleStreamStats {
+  bool subscribed = false;
+  uint16_t mtu = ergo::kDefaultAttMtu;
+  // Link-layer payload after data length extension, 27 without it.
+  uint16_t txOctets = 27;
+  // 1 = LE 1M, 2 = LE 2M, 3 = LE Coded.
+  uint8_t phy = 1;
+  uint32_t framesSent = 0;
+  uint32_t samplesSent = 0;
+  // Samples the sensor ring overwrote before the stream read them.
+  uint32_t samplesDropped = 0;
+  // Notifications the stack refused; each shows up as a sequence gap.
+  uint32_t notifyErrors = 0;
+  // Stream, sync and file notification bytes.
+  uint32_t bytesPerSecond = 0;
+  uint32_t samplesPerSecond = 0;
+  // Current connection parameters, in spec units.
+  uint16_t connInterval = 0;
+  uint16_t connLatency = 0;
+  uint16_t connTimeout = 0;
+  // Profile whose parameters are in effect.
+  BleConnProfile connProfile = BleConnProfile::Central;
+  // Requests rejected or ignored on this connection.
+  uint32_t connRejects = 0;
+};
 
 class BleManager {
  public:
   void begin();
-  void publishLatest(const VitalData &data);
+  void setRawSampleSource(const RawSampleRing *source);
+  void setBeatSource(const BeatRing *source);
+  void setHistory(VitalsHistory *history);
+  void setRecordings(RecordingManager *recordings);
+  // Call on every kBlePublishPeriodMs tick (`scheduled`) and on sensor
+  // events. When cfg::kBlePublishMode says so, updates the custom payload and
+  // notifies a Heart Rate Measurement with every RR interval accepted since
+  // the previous one.
+  void publishLatest(const VitalData &data, bool sensorContact, bool scheduled);
+  // Sends the raw samples produced since the last call as stream frames.
+  void pumpStream();
+  // Applies sync commands from the central and sends history frames within
+  // the ack window.
+  void pumpSync();
+  // Answers file commands and sends recording chunks within the ack window.
+  void pumpFiles();
+  // Requests connection parameters that suit the current workload. Runs in
+  // the stream task, which owns the stream and sync state it looks at.
+  void pumpConnection();
   void setEnabled(bool enabled);
   bool isConnected() const;
   const char *deviceName() const;
+  BleStreamStats streamStats() const;
 
  private:
   void packPayload(const VitalData &data, uint8_t payload[cfg::kPayloadSize]);
+  void queueReading(const VitalData &data);
+  void sendReadings();
+  bool publishDue(const VitalData &data, bool sensorContact, bool scheduled,
+                  uint32_t nowMs) const;
+  void publishHeartRate(const VitalData &data, bool sensorContact);
+  void accumulateEnergy(uint16_t bpm, uint32_t nowMs);
+  bool streamSubscribed() const;
+  void sendStreamFrame(size_t count);
+  void updateStreamRates(uint32_t nowMs);
+  void takeSyncCommands(uint32_t nowMs);
+  bool sendSyncFrame(size_t perFrame);
+  void finishSync();
+  void takeFileCommands(uint32_t nowMs);
+  void sendFileList(uint32_t fromSequence);
+  bool sendFileChunk(size_t chunkSize);
+  const uint8_t *fileBytes(uint32_t offset, size_t count);
+  bool sendFileFrame(const uint8_t *frame, size_t size);
+  void sendFileError(ergo::FileError error);
+  void finishFile();
+  void closeFile();
+  void requestConnParams(uint32_t nowMs);
+  void connParamsRejected(uint32_t nowMs);
 
+  // Set by begin(); every notification goes through it.
+  ergo::BleTransport *transport_ = nullptr;
   bool deviceConnected_ = false;
   bool enabled_ = true;
   char deviceName_[24] = {0};
   uint8_t sequenceCounter_ = 0;
+  bool published_ = false;
+  VitalData lastPublished_{};
+  bool lastContact_ = false;
+  uint32_t lastPublishMs_ = 0;
+  uint32_t beatHead_ = 0;
+  // Set by a version characteristic write, back to the default on
+  // disconnect; publishLatest() reads it.
+  volatile uint8_t payloadVersion_ = cfg::kBlePayloadVersion;
+  uint8_t batchVersion_ = cfg::kBlePayloadVersion;
+  // v2 payload: consecutive 1 Hz readings not yet sent.
+  ergo::VitalsReading readings_[cfg::kBlePayloadMaxReadings];
+  ergo::VitalsBatcher batcher_{readings_, cfg::kBlePayloadMaxReadings};
+  uint32_t readingSequence_ = 0;
+
+  const RawSampleRing *rawSource_ = nullptr;
+  uint32_t streamCursor_ = 0;
+  bool streaming_ = false;
+  uint16_t streamSequence_ = 0;
+  RawSample pending_[ergo::streamSamplesPerFrame(cfg::kBleMtu)];
+  size_t pendingCount_ = 0;
+  // Sample index of pending_[0].
+  uint32_t pendingIndex_ = 0;
+  uint32_t rateWindowStartMs_ = 0;
+  uint32_t rateWindowBytes_ = 0;
+  uint32_t rateWindowSamples_ = 0;
+  portMUX_TYPE statsMux_ = portMUX_INITIALIZER_UNLOCKED;
+  BleStreamStats stats_{};
+
+  const BeatRing *beatSource_ = nullptr;
+  uint32_t beatCursor_ = 0;
+  bool hrsSubscribed_ = false;
+  uint32_t hrsMeasurements_ = 0;
+  uint32_t beatsDropped_ = 0;
+  ergo::RrIntervalConverter rrConverter_;
+  float energyKj_ = 0.0f;
+  uint32_t lastEnergyMs_ = 0;
+  // Set by a control point write, applied by publishLatest().
+  portMUX_TYPE hrsMux_ = portMUX_INITIALIZER_UNLOCKED;
+  bool energyResetPending_ = false;
+
+  // Owned by the stream task.
+  uint32_t connSession_ = 0;
+  uint32_t connSeenUpdates_ = 0;
+  BleConnProfile connTarget_ = BleConnProfile::Central;
+  // 0 = first choice, 1 = fallback, 2 = gave up on connTarget_.
+  uint8_t connAttempt_ = 0;
+  bool connRequestPending_ = false;
+  uint32_t connRequestMs_ = 0;
+  uint32_t lastBulkMs_ = 0;
+
+  VitalsHistory *history_ = nullptr;
+  // Written by the GATT write callback, consumed by pumpSync().
+  portMUX_TYPE syncMux_ = portMUX_INITIALIZER_UNLOCKED;
+  bool syncStartPending_ = false;
+  bool syncAckPending_ = false;
+  bool syncStopPending_ = false;
+  ergo::SyncCommand syncStart_{};
+  uint32_t syncAckSequence_ = 0;
+  // Owned by the stream task.
+  bool syncActive_ = false;
+  uint8_t syncWindow_ = 0;
+  uint32_t syncNext_ = 0;
+  uint32_t syncAcked_ = 0;
+  uint32_t syncLastAckMs_ = 0;
+  uint32_t syncStartMs_ = 0;
+  uint32_t syncRecordsSent_ = 0;
+  uint32_t syncResends_ = 0;
+
+  RecordingManager *recordings_ = nullptr;
+  // Written by the GATT write callback, consumed by pumpFiles().
+  portMUX_TYPE fileMux_ = portMUX_INITIALIZER_UNLOCKED;
+  bool fileListPending_ = false;
+  bool fileReadPending_ = false;
+  bool fileAckPending_ = false;
+  bool fileStopPending_ = false;
+  uint32_t fileListSequence_ = 0;
+  ergo::FileCommand fileRead_{};
+  uint32_t fileAckOffset_ = 0;
+  // Owned by the stream task.
+  bool fileOpen_ = false;
+  bool fileErg_ = false;
+  bool fileActive_ = false;
+  uint32_t fileSequence_ = 0;
+  uint32_t fileEnd_ = 0;
+  ergo::FileSender fileSender_;
+  uint32_t fileStartMs_ = 0;
+  uint32_t fileStartOffset_ = 0;
+  // SD reads go through this buffer so each chunk is not its own read.
+  uint8_t fileBuffer_[cfg::kFileReadBufferBytes];
+  uint32_t fileBufferOffset_ = 0;
+  size_t fileBufferCount_ = 0;
 
   class ServerCallbacks;
+  class CharacteristicCallbacks;
   ServerCallbacks *callbacks_ = nullptr;
+  CharacteristicCallbacks *characteristicCallbacks_ = nullptr;
 };
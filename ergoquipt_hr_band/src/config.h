@@ -14,6 +14,95 @@ struct VitalData {
   uint8_t status = 0;
 };
 
+// One MAX3010x FIFO sample with the IMU reading taken alongside it.
+struct RawSample {
+  uint32_t timestampMs = 0;
+  uint32_t ir = 0;
+  uint32_t red = 0;
+  int16_t accelXmg = 0;
+  int16_t accelYmg = 0;
+  int16_t accelZmg = 0;
+};
+
+// One accepted beat: the peak time and the RR interval that ended there.
+struct BeatEvent {
+  uint32_t timestampMs = 0;
+  uint16_t rriMs = 0;
+};
+
+// One point of the live PPG trace: filtered IR with its slow baseline
+// removed, and what the beat detector made of it.
+struct WaveformSample {
+  uint32_t timestampMs = 0;
+  int32_t ac = 0;
+  uint8_t flags = 0;
+};
+
+// LE connection parameters in spec units: intervals in 1.25 ms, supervision
+// timeout in 10 ms.
+struct BleConnParams {
+  uint16_t minInterval = 0;
+  uint16_t maxInterval = 0;
+  uint16_t latency = 0;
+  uint16_t timeout = 0;
+};
+
+enum class BlePublishMode : uint8_t {
+  // Notify every kBlePublishPeriodMs.
+  Periodic = 0,
+  // Notify on accepted beats, status changes and deadband crossings, with a
+  // kBleMaxPublishIntervalMs heartbeat.
+  BeatSync = 1,
+};
+
+// Log sources, each with its own level and drop counter.
+enum class LogModule : uint8_t {
+  System = 0,
+  Sensor = 1,
+  Ble = 2,
+  Recorder = 3,
+  Power = 4,
+  Rtc = 5,
+  History = 6,
+  Ui = 7,
+  Count = 8,
+};
+
+enum class LogLevel : uint8_t {
+  Off = 0,
+  Error = 1,
+  Warn = 2,
+  Info = 3,
+  Debug = 4,
+};
+
+// What changed, posted to ui_task (ui_events.h).
+enum class UiEvent : uint8_t {
+  // 1 Hz vitals tick: refresh all content and push trend points.
+  Vitals = 0,
+  // BLE connection opened or closed.
+  Ble = 1,
+  // Recorder state or status text.
+  Recording = 2,
+  // Button press or battery level.
+  Power = 3,
+  // FT3168 interrupt line.
+  Input = 4,
+  // A UI control queued a recording or filtering mode request.
+  Request = 5,
+};
+
+// Channels kept by the trend store.
+enum class TrendMetric : uint8_t {
+  Hr = 0,
+  Spo2 = 1,
+  Rri = 2,
+  Hrv = 3,
+  // Motion score x1000.
+  Motion = 4,
+  Count = 5,
+};
+
 enum class FilteringMode : uint8_t {
   M0NoImu = 0,
   M1MotionGating = 1,
@@ -42,6 +131,22 @@ namespace cfg {
 constexpr char kDeviceNamePrefix[] = "Ergoquipt-HR";
 constexpr char kServiceUuid[] = "e0020001-7cce-4c2a-9f0b-112233445566";
 constexpr char kCharacteristicUuid[] = "e0020002-7cce-4c2a-9f0b-112233445566";
+constexpr char kStreamCharacteristicUuid[] = "e0020003-7cce-4c2a-9f0b-112233445566";
+constexpr char kSyncCharacteristicUuid[] = "e0020004-7cce-4c2a-9f0b-112233445566";
+constexpr char kVersionCharacteristicUuid[] = "e0020005-7cce-4c2a-9f0b-112233445566";
+constexpr char kFileCharacteristicUuid[] = "e0020006-7cce-4c2a-9f0b-112233445566";
+// Attribute handles for the custom service: five characteristics, four with
+// a CCC descriptor, plus headroom.
+constexpr uint32_t kServiceHandles = 24;
+// Standard Heart Rate Service and its characteristics.
+constexpr uint16_t kHrsServiceUuid = 0x180D;
+constexpr uint16_t kHrsMeasurementUuid = 0x2A37;
+constexpr uint16_t kHrsBodySensorLocationUuid = 0x2A38;
+constexpr uint16_t kHrsControlPointUuid = 0x2A39;
+// 247 fills one 251-byte LE data-length-extended packet after the L2CAP
+// header, so a full stream frame goes out in a single link-layer PDU.
+constexpr uint16_t kBleMtu = 247;
+constexpr uint16_t kBleDataLength = 251;
 
 constexpr uint16_t kDisplayWidth = 368;
 constexpr uint16_t kDisplayHeight = 448;
@@ -75,6 +180,7 @@ constexpr uint8_t kExpanderSdEnablePin = 7;
 constexpr int kSdClkPin = 2;
 constexpr int kSdCmdPin = 1;
 constexpr int kSdDataPin = 3;
+constexpr const char *kSdMountPoint = "/sdcard";
 
 constexpr uint8_t kPayloadSize = 12;
 
@@ -86,9 +192,81 @@ constexpr uint8_t kStatusLowBattery = 1U << 4;
 
 constexpr uint32_t kSensorTaskPeriodMs = 10;
 constexpr uint32_t kBlePublishPeriodMs = 1000;
+constexpr BlePublishMode kBlePublishMode = BlePublishMode::BeatSync;
+constexpr uint32_t kBleMaxPublishIntervalMs = 5000;
+// Debounces finger on/off flicker; beats are always further apart.
+constexpr uint32_t kBleMinPublishIntervalMs = 150;
+// Vitals payload format (ergo::kVitalsPayloadV1 or V2, see vitals_payload.h)
+// each connection starts with. v1 is the documented fixed layout existing
+// centrals parse; a central opts in to v2, which batches the 1 Hz readings
+// until one changes or the batch fills, by writing 2 to the version
+// characteristic.
+constexpr uint8_t kBlePayloadVersion = 1;
+constexpr size_t kBlePayloadMaxReadings = kBleMaxPublishIntervalMs / kBlePublishPeriodMs;
+constexpr uint16_t kBleHrDeadbandBpm = 3;
+constexpr uint16_t kBleSpo2DeadbandX100 = 100;
+constexpr uint16_t kBleHrvDeadbandMs = 10;
+constexpr uint32_t kBleStreamPeriodMs = 20;
+// Requested per workload; each has a fallback for centrals that reject the
+// first request. All four stay within Apple's accessory design guidelines.
+// Vitals only: 150-200 ms, skipping up to 4 idle events.
+constexpr BleConnParams kBleConnLowPower = {120, 160, 4, 500};
+constexpr BleConnParams kBleConnLowPowerFallback = {80, 100, 2, 400};
+// Waveform stream, history sync or file download: 15-30 ms.
+constexpr BleConnParams kBleConnFast = {12, 24, 0, 200};
+constexpr BleConnParams kBleConnFastFallback = {24, 40, 0, 300};
+// Service discovery runs at the central's pace before the first request.
+constexpr uint32_t kBleConnSettleMs = 3000;
+// Stay fast this long after a transfer ends so back-to-back syncs don't flap.
+constexpr uint32_t kBleConnIdleHoldMs = 2000;
+constexpr uint32_t kBleConnResponseTimeoutMs = 5000;
+constexpr uint32_t kBleStreamMaxLatencyMs = 100;
 constexpr uint32_t kRecordPeriodMs = 1000;
-constexpr uint32_t kUiTaskPeriodMs = 33;
-constexpr uint32_t kUiRefreshPeriodMs = 1000;
+// Deferred logging: log_task drains the ring this often. A full ring drops
+// new entries rather than blocking the caller.
+constexpr size_t kLogRingEntries = 64;
+constexpr uint32_t kLogDrainPeriodMs = 20;
+constexpr LogLevel kLogDefaultLevel = LogLevel::Info;
+// USB CDC console and binary capture protocol (usb_protocol.h). usb_task
+// reads commands and sends capture frames every pump; the CDC TX buffer
+// rides out short host stalls, the sample ring longer ones.
+constexpr uint32_t kUsbPumpPeriodMs = 10;
+constexpr size_t kUsbTxBufferBytes = 4096;
+constexpr size_t kUsbCommandMaxBytes = 64;
+constexpr uint32_t kUsbCountersPeriodMs = 1000;
+// A host that stops reading this long is treated as gone.
+constexpr uint32_t kUsbHostTimeoutMs = 3000;
+// ui_task blocks on its event queue until an event or the next LVGL timer,
+// but wakes at least this often to refresh the RTC snapshot.
+constexpr size_t kUiEventQueueDepth = 16;
+constexpr uint32_t kUiIdleWakeMs = 1000;
+constexpr uint32_t kPowerPollPeriodMs = 50;
+// FT3168 points read after an interrupt and not yet taken by LVGL.
+constexpr size_t kTouchQueueDepth = 8;
+// While a finger is down the controller reports far faster than LVGL reads.
+constexpr uint32_t kTouchReadPeriodMs = 30;
+// A held touch with no interrupt for this long is read once more, in case
+// the controller's release report was missed.
+constexpr uint32_t kTouchReleaseCheckMs = 60;
+// With the display off the controller is never read; its interrupt only
+// wakes the display (and leaves soft sleep), and that touch never reaches
+// LVGL.
+constexpr bool kTouchWakesDisplay = true;
+// LVGL renders into one internal-RAM DMA buffer while the QSPI DMA sends
+// the other; one band must fit a single SPI transaction (32 KB).
+constexpr size_t kDisplayDrawBufferLines = 40;
+constexpr uint32_t kDisplayQspiHz = 40000000;
+constexpr uint8_t kDisplayBrightness = 220;
+constexpr uint32_t kDisplayStatsPeriodMs = 10000;
+// Keep the heart rate and metric numerals' glyph bitmaps in PSRAM.
+constexpr bool kUiGlyphCache = true;
+// Perf overlay and USB Perf frames: UI counters per window, and a ui_task
+// pass longer than the budget counts as a missed ~30 fps frame.
+constexpr uint32_t kPerfPeriodMs = 1000;
+constexpr uint32_t kUiFrameBudgetMs = 33;
+constexpr size_t kPerfMaxTasks = 10;
+// configMAX_TASK_NAME_LEN.
+constexpr size_t kPerfTaskNameBytes = 16;
 
 constexpr size_t kRriBufferSize = 20;
 constexpr size_t kSignalWindowSize = 8;
@@ -104,6 +282,61 @@ constexpr uint8_t kMockBatteryStartPct = 92;
 constexpr uint32_t kBatteryPollPeriodMs = 5000;
 constexpr uint32_t kRtcPollPeriodMs = 1000;
 constexpr uint32_t kSoftSleepLongPressMs = 3000;
-constexpr size_t kTrendBufferSize = 48;
+constexpr size_t kTrendChartPoints = 48;
+// Trend store tiers in PSRAM: 1 s for an hour, 1 min for a day, 1 h for a
+// week. A tier that doesn't fit in PSRAM gets kTrendFallbackBuckets of
+// internal RAM.
+constexpr uint32_t kTrendSecondBuckets = 3600;
+constexpr uint32_t kTrendMinuteBuckets = 1440;
+constexpr uint32_t kTrendHourBuckets = 168;
+constexpr uint32_t kTrendFallbackBuckets = 120;
+constexpr size_t kRawSampleRingSize = 512;
+// About 20 s of beats at 180 bpm between 1 Hz notifications.
+constexpr size_t kBeatRingSize = 64;
+constexpr size_t kWaveformRingSize = 256;
+constexpr uint8_t kWaveformPeak = 1U << 0;
+constexpr uint8_t kWaveformBeat = 1U << 1;
+constexpr uint8_t kWaveformFinger = 1U << 2;
+// The wave page draws one column per 100 Hz sample / N, so 1..4 gives a
+// 100..25 Hz trace; a sweep is kWaveformColumns of those.
+constexpr uint8_t kWaveformDecimation = 1;
+constexpr uint16_t kWaveformColumns = 300;
+constexpr uint16_t kWaveformHeight = 220;
+// Frame period while the wave page is on screen (~30 fps).
+constexpr uint32_t kWaveformFrameMs = 33;
+// Energy expended goes out in every 10th measurement, as the HRS spec
+// suggests at 1 Hz. The estimate (Keytel et al. 2005) assumes this profile.
+constexpr uint8_t kHrsEnergyEveryN = 10;
+constexpr float kEnergyWeightKg = 70.0f;
+constexpr float kEnergyAgeYears = 35.0f;
+constexpr uint16_t kRawBlockFrames = 100;
+constexpr uint32_t kIndexIntervalMs = 60000;
+constexpr uint32_t kCsvPreallocBytes = 64UL * 1024UL;
+constexpr uint32_t kErgPreallocBytes = 512UL * 1024UL;
+constexpr uint32_t kPrefillBudgetBytes = 8UL * 1024UL;
+constexpr uint32_t kRotateBytes = 32UL * 1024UL * 1024UL;
+constexpr uint32_t kRotateIntervalMs = 60UL * 60UL * 1000UL;
+constexpr size_t kMaxIndexEntries = kRotateIntervalMs / kIndexIntervalMs + 1U;
+constexpr uint64_t kMinFreeBytes = 64ULL * 1024ULL * 1024ULL;
+// Oldest files one directory scan collects for reclaiming.
+constexpr size_t kReclaimBatch = 8;
+constexpr uint32_t kAppendLatencyBudgetUs = 50000;
+constexpr const char *kJournalPath = "/REC.jnl";
+constexpr uint32_t kCommitIntervalMs = 5000;
+constexpr uint32_t kRecoveryScanBytes = 64UL * 1024UL;
+// Vitals history: about 6 h of 64-row pages in PSRAM (16 pages without
+// PSRAM) and about 7 days in the SD spill file.
+constexpr uint32_t kHistoryRamPages = 340;
+constexpr uint32_t kHistoryFallbackPages = 16;
+constexpr uint32_t kHistorySpillPages = 9450;
+constexpr const char *kHistoryPath = "/VITALS.hst";
+constexpr uint32_t kSyncAckTimeoutMs = 1000;
+constexpr uint8_t kSyncMaxFramesPerPump = 8;
+// Recording download: list pages are built from this many directory entries,
+// SD reads come in buffer-sized pieces.
+constexpr size_t kFileListMaxEntries = 12;
+constexpr size_t kFileReadBufferBytes = 4096;
+constexpr uint32_t kFileAckTimeoutMs = 1000;
+constexpr uint8_t kFileMaxFramesPerPump = 12;
 
 }  // namespace cfg
@@ -0,0 +1,262 @@
+#include "display_panel.h"
+
+#include <driver/spi_master.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "logger.h"
+
+namespace {
+
+// SH8601 QSPI framing: one opcode byte, the command in the middle byte of a
+// 24-bit address, then parameters on one line or pixels on four.
+constexpr uint32_t kOpcodeWriteCommand = 0x02;
+constexpr uint32_t kOpcodeWritePixels = 0x32;
+constexpr uint8_t kCmdSleepOut = 0x11;
+constexpr uint8_t kCmdDisplayOn = 0x29;
+constexpr uint8_t kCmdColumnAddress = 0x2A;
+constexpr uint8_t kCmdRowAddress = 0x2B;
+constexpr uint8_t kCmdMemoryWrite = 0x2C;
+constexpr uint8_t kCmdTearingEffectOn = 0x35;
+constexpr uint8_t kCmdPixelFormat = 0x3A;
+constexpr uint8_t kCmdTearingScanline = 0x44;
+constexpr uint8_t kCmdBrightness = 0x51;
+constexpr uint8_t kCmdControlDisplay = 0x53;
+constexpr int kPixelWrite =
+    static_cast<int>((kOpcodeWritePixels << 24U) | (uint32_t{kCmdMemoryWrite} << 8U));
+
+constexpr spi_host_device_t kSpiHost = SPI2_HOST;
+constexpr size_t kTransferQueueDepth = 10;
+constexpr size_t kMinDrawBufferLines = 10;
+constexpr uint32_t kTransferTimeoutMs = 100;
+// One SPI transaction moves at most 2^18 bits.
+constexpr size_t kMaxTransferBytes = 32768;
+static_assert(cfg::kDisplayWidth * cfg::kDisplayDrawBufferLines * sizeof(lv_color_t) <=
+                  kMaxTransferBytes,
+              "a draw buffer band must fit one SPI transaction");
+
+struct InitCommand {
+  uint8_t command;
+  uint8_t data[4];
+  uint8_t size;
+  uint16_t delayMs;
+};
+
+// Brightness stays at 0 until the first frame is on the glass.
+const InitCommand kInitCommands[] = {
+    {kCmdSleepOut, {}, 0, 120},
+    {kCmdTearingScanline, {0x01, 0xD1}, 2, 0},
+    {kCmdTearingEffectOn, {0x00}, 1, 0},
+    {kCmdControlDisplay, {0x20}, 1, 10},
+    {kCmdPixelFormat, {0x55}, 1, 0},
+    {kCmdBrightness, {0x00}, 1, 10},
+    {kCmdDisplayOn, {}, 0, 10},
+};
+
+lv_color_t *allocDrawBuffer(size_t lines) {
+  return static_cast<lv_color_t *>(heap_caps_malloc(
+      cfg::kDisplayWidth * lines * sizeof(lv_color_t), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL));
+}
+
+}  // namespace
+
+bool DisplayPanel::begin() {
+  doneSemaphore_ = xSemaphoreCreateBinary();
+  if (doneSemaphore_ == nullptr) {
+    return false;
+  }
+
+  spi_bus_config_t bus = {};
+  bus.sclk_io_num = cfg::kDisplaySckPin;
+  bus.data0_io_num = cfg::kDisplayD0Pin;
+  bus.data1_io_num = cfg::kDisplayD1Pin;
+  bus.data2_io_num = cfg::kDisplayD2Pin;
+  bus.data3_io_num = cfg::kDisplayD3Pin;
+  bus.data4_io_num = -1;
+  bus.data5_io_num = -1;
+  bus.data6_io_num = -1;
+  bus.data7_io_num = -1;
+  bus.max_transfer_sz = cfg::kDisplayWidth * cfg::kDisplayDrawBufferLines * sizeof(lv_color_t);
+  bus.flags = SPICOMMON_BUSFLAG_MASTER | SPICOMMON_BUSFLAG_QUAD;
+  if (spi_bus_initialize(kSpiHost, &bus, SPI_DMA_CH_AUTO) != ESP_OK) {
+    return false;
+  }
+
+  esp_lcd_panel_io_spi_config_t io = {};
+  io.cs_gpio_num = cfg::kDisplayCsPin;
+  io.dc_gpio_num = -1;
+  io.spi_mode = 0;
+  io.pclk_hz = cfg::kDisplayQspiHz;
+  io.trans_queue_depth = kTransferQueueDepth;
+  io.on_color_trans_done = onTransferDone;
+  io.user_ctx = this;
+  io.lcd_cmd_bits = 32;
+  io.lcd_param_bits = 8;
+  io.flags.quad_mode = 1;
+  if (esp_lcd_new_panel_io_spi((esp_lcd_spi_bus_handle_t)kSpiHost, &io, &io_) != ESP_OK) {
+    return false;
+  }
+
+  for (const InitCommand &init : kInitCommands) {
+    if (!sendCommand(init.command, init.size > 0U ? init.data : nullptr, init.size)) {
+      return false;
+    }
+    if (init.delayMs > 0U) {
+      delay(init.delayMs);
+    }
+  }
+  return true;
+}
+
+bool DisplayPanel::attach(lv_disp_drv_t &driver, lv_disp_draw_buf_t &drawBuffer) {
+  for (size_t lines = cfg::kDisplayDrawBufferLines; lines >= kMinDrawBufferLines;
+       lines /= 2U) {
+    buffers_[0] = allocDrawBuffer(lines);
+    buffers_[1] = allocDrawBuffer(lines);
+    if (buffers_[0] != nullptr && buffers_[1] != nullptr) {
+      bufferLines_ = lines;
+      break;
+    }
+    heap_caps_free(buffers_[0]);
+    heap_caps_free(buffers_[1]);
+    buffers_[0] = nullptr;
+    buffers_[1] = nullptr;
+  }
+  if (bufferLines_ == 0U) {
+    return false;
+  }
+  if (bufferLines_ < cfg::kDisplayDrawBufferLines) {
+    LOG_WARN(Ui, "Display: short on DMA RAM, %u-line draw buffers",
+             static_cast<unsigned>(bufferLines_));
+  }
+
+  clear(buffers_[0], bufferLines_);
+
+  lv_disp_draw_buf_init(&drawBuffer, buffers_[0], buffers_[1],
+                        cfg::kDisplayWidth * bufferLines_);
+  driver.flush_cb = flush;
+  driver.rounder_cb = round;
+  driver.wait_cb = wait;
+  driver.draw_buf = &drawBuffer;
+  driver.user_data = this;
+  driver_ = &driver;
+  lv_disp_drv_register(&driver);
+  return true;
+}
+
+void DisplayPanel::setBrightness(uint8_t level) { sendCommand(kCmdBrightness, &level, 1); }
+
+DisplayStats DisplayPanel::takeStats() {
+  portENTER_CRITICAL(&statsMux_);
+  const DisplayStats stats = stats_;
+  stats_ = DisplayStats{};
+  portEXIT_CRITICAL(&statsMux_);
+  return stats;
+}
+
+uint32_t DisplayPanel::submits() const { return submits_; }
+
+bool DisplayPanel::sendCommand(uint8_t command, const uint8_t *data, size_t size) {
+  const int lcdCommand = static_cast<int>((kOpcodeWriteCommand << 24U) |
+                                          (static_cast<uint32_t>(command) << 8U));
+  return esp_lcd_panel_io_tx_param(io_, lcdCommand, data, size) == ESP_OK;
+}
+
+bool DisplayPanel::setWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+  const uint8_t columns[] = {static_cast<uint8_t>(x1 >> 8U), static_cast<uint8_t>(x1),
+                             static_cast<uint8_t>(x2 >> 8U), static_cast<uint8_t>(x2)};
+  const uint8_t rows[] = {static_cast<uint8_t>(y1 >> 8U), static_cast<uint8_t>(y1),
+                          static_cast<uint8_t>(y2 >> 8U), static_cast<uint8_t>(y2)};
+  return sendCommand(kCmdColumnAddress, columns, sizeof(columns)) &&
+         sendCommand(kCmdRowAddress, rows, sizeof(rows));
+}
+
+// Panel RAM holds noise after power-up; blank it before the backlight
+// comes up. Runs before LVGL owns the buffers.
+void DisplayPanel::clear(lv_color_t *buffer, size_t lines) {
+  const size_t bytes = cfg::kDisplayWidth * lines * sizeof(lv_color_t);
+  memset(buffer, 0, bytes);
+  for (uint16_t y = 0; y < cfg::kDisplayHeight; y += lines) {
+    const uint16_t y2 = static_cast<uint16_t>(
+        std::min<size_t>(y + lines, cfg::kDisplayHeight) - 1U);
+    if (!setWindow(0, y, cfg::kDisplayWidth - 1U, y2) ||
+        esp_lcd_panel_io_tx_color(io_, kPixelWrite, buffer,
+                                  cfg::kDisplayWidth * (y2 - y + 1U) * sizeof(lv_color_t)) !=
+            ESP_OK) {
+      return;
+    }
+    xSemaphoreTake(doneSemaphore_, pdMS_TO_TICKS(kTransferTimeoutMs));
+  }
+}
+
+void DisplayPanel::flush(lv_disp_drv_t *driver, const lv_area_t *area, lv_color_t *pixels) {
+  auto *panel = static_cast<DisplayPanel *>(driver->user_data);
+  const int64_t startUs = esp_timer_get_time();
+  const size_t bytes = lv_area_get_size(area) * sizeof(lv_color_t);
+
+  portENTER_CRITICAL(&panel->statsMux_);
+  panel->flushStartUs_ = startUs;
+  panel->flushBytesPending_ = bytes;
+  portEXIT_CRITICAL(&panel->statsMux_);
+
+  // setWindow waits for the previous transfer; the pixels are only queued.
+  if (!panel->setWindow(area->x1, area->y1, area->x2, area->y2) ||
+      esp_lcd_panel_io_tx_color(panel->io_, kPixelWrite, pixels, bytes) != ESP_OK) {
+    // Nothing in flight: hand the buffer straight back.
+    lv_disp_flush_ready(driver);
+    return;
+  }
+  ++panel->submits_;
+
+  const uint32_t submitUs = static_cast<uint32_t>(esp_timer_get_time() - startUs);
+  portENTER_CRITICAL(&panel->statsMux_);
+  panel->stats_.submitUsTotal += submitUs;
+  portEXIT_CRITICAL(&panel->statsMux_);
+}
+
+// The SH8601 only takes windows that start and end on even pixel pairs.
+void DisplayPanel::round(lv_disp_drv_t *driver, lv_area_t *area) {
+  (void)driver;
+  area->x1 &= ~1;
+  area->y1 &= ~1;
+  area->x2 |= 1;
+  area->y2 |= 1;
+}
+
+// LVGL calls this in a loop until the buffer it needs is flushed; block on
+// the transfer instead of spinning on the UI core.
+void DisplayPanel::wait(lv_disp_drv_t *driver) {
+  auto *panel = static_cast<DisplayPanel *>(driver->user_data);
+  const int64_t startUs = esp_timer_get_time();
+  xSemaphoreTake(panel->doneSemaphore_, pdMS_TO_TICKS(kTransferTimeoutMs));
+  const uint32_t waitedUs = static_cast<uint32_t>(esp_timer_get_time() - startUs);
+  portENTER_CRITICAL(&panel->statsMux_);
+  panel->stats_.waitUsTotal += waitedUs;
+  portEXIT_CRITICAL(&panel->statsMux_);
+}
+
+bool DisplayPanel::onTransferDone(esp_lcd_panel_io_handle_t io,
+                                  esp_lcd_panel_io_event_data_t *event, void *context) {
+  (void)io;
+  (void)event;
+  auto *panel = static_cast<DisplayPanel *>(context);
+  if (panel->driver_ != nullptr) {
+    const int64_t nowUs = esp_timer_get_time();
+    portENTER_CRITICAL_ISR(&panel->statsMux_);
+    const uint32_t flushUs = static_cast<uint32_t>(nowUs - panel->flushStartUs_);
+    ++panel->stats_.flushes;
+    panel->stats_.flushBytes += panel->flushBytesPending_;
+    panel->stats_.flushUsTotal += flushUs;
+    if (flushUs > panel->stats_.flushUsMax) {
+      panel->stats_.flushUsMax = flushUs;
+    }
+    portEXIT_CRITICAL_ISR(&panel->statsMux_);
+    lv_disp_flush_ready(panel->driver_);
+  }
+  BaseType_t woken = pdFALSE;
+  xSemaphoreGiveFromISR(panel->doneSemaphore_, &woken);
+  return woken == pdTRUE;
+}
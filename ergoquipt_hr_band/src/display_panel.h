@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Arduino.h>
+#include <esp_lcd_panel_io.h>
+#include <lvgl.h>
+
+#include "config.h"
+
+struct DisplayStats {
+  uint32_t flushes = 0;
+  uint32_t flushBytes = 0;
+  // Flush start to DMA transfer complete.
+  uint32_t flushUsTotal = 0;
+  uint32_t flushUsMax = 0;
+  // Time the UI task spent inside the flush callback.
+  uint32_t submitUsTotal = 0;
+  // Time LVGL blocked waiting for a buffer to come back from the DMA.
+  uint32_t waitUsTotal = 0;
+};
+
+// SH8601 AMOLED on QSPI through esp_lcd. Flushes queue a DMA transfer
+// straight from LVGL's draw buffer and return; lv_disp_flush_ready is
+// signalled from the transfer-complete interrupt, so LVGL renders the next
+// band into the other buffer while this one is on the wire. Both draw
+// buffers therefore live in DMA-capable internal RAM.
+class DisplayPanel {
+ public:
+  bool begin();
+  // Allocates the draw buffers and registers the LVGL display driver.
+  bool attach(lv_disp_drv_t &driver, lv_disp_draw_buf_t &drawBuffer);
+  void setBrightness(uint8_t level);
+  // Returns the stats gathered since the previous call.
+  DisplayStats takeStats();
+  // Flushes handed to the DMA since boot.
+  uint32_t submits() const;
+
+ private:
+  bool sendCommand(uint8_t command, const uint8_t *data = nullptr, size_t size = 0);
+  bool setWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+  void clear(lv_color_t *buffer, size_t lines);
+  static void flush(lv_disp_drv_t *driver, const lv_area_t *area, lv_color_t *pixels);
+  static void round(lv_disp_drv_t *driver, lv_area_t *area);
+  static void wait(lv_disp_drv_t *driver);
+  static bool onTransferDone(esp_lcd_panel_io_handle_t io,
+                             esp_lcd_panel_io_event_data_t *event, void *context);
+
+  esp_lcd_panel_io_handle_t io_ = nullptr;
+  SemaphoreHandle_t doneSemaphore_ = nullptr;
+  lv_disp_drv_t *driver_ = nullptr;
+  uint32_t submits_ = 0;
+  lv_color_t *buffers_[2] = {nullptr, nullptr};
+  size_t bufferLines_ = 0;
+  // Written by the UI task and the transfer-complete ISR.
+  portMUX_TYPE statsMux_ = portMUX_INITIALIZER_UNLOCKED;
+  int64_t flushStartUs_ = 0;
+  uint32_t flushBytesPending_ = 0;
+  DisplayStats stats_;
+};
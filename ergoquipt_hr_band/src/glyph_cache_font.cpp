@@ -0,0 +1,82 @@
+#include "glyph_cache_font.h"
+
+#include <cstring>
+
+namespace {
+
+// Packed size of one glyph bitmap; LVGL unpacks 3 bpp glyphs to 4 bpp.
+size_t bitmapBytes(const lv_font_glyph_dsc_t &dsc) {
+  const size_t bpp = dsc.bpp == 3U ? 4U : dsc.bpp;
+  return ((static_cast<size_t>(dsc.box_w) * dsc.box_h * bpp) + 7U) / 8U;
+}
+
+}  // namespace
+
+void GlyphCacheFont::begin(const lv_font_t *base, const char *glyphs) {
+  base_ = base;
+  cached_ = false;
+  cachedBytes_ = 0;
+
+  size_t total = 0;
+  for (const char *glyph = glyphs; *glyph != '\0'; ++glyph) {
+    lv_font_glyph_dsc_t dsc{};
+    if (base->get_glyph_dsc(base, &dsc, static_cast<uint8_t>(*glyph), 0)) {
+      total += bitmapBytes(dsc);
+    }
+  }
+  if (total == 0U) {
+    return;
+  }
+  auto *storage = static_cast<uint8_t *>(ps_malloc(total));
+  if (storage == nullptr) {
+    storage = static_cast<uint8_t *>(malloc(total));
+  }
+  if (storage == nullptr) {
+    return;
+  }
+
+  // The base font may hand out one shared decompression buffer, so each
+  // bitmap is copied before the next is asked for.
+  for (const char *glyph = glyphs; *glyph != '\0'; ++glyph) {
+    const uint32_t letter = static_cast<uint8_t>(*glyph);
+    lv_font_glyph_dsc_t dsc{};
+    if (letter < kFirstGlyph || letter >= kFirstGlyph + kGlyphCount ||
+        bitmaps_[letter - kFirstGlyph] != nullptr ||
+        !base->get_glyph_dsc(base, &dsc, letter, 0)) {
+      continue;
+    }
+    const size_t size = bitmapBytes(dsc);
+    const uint8_t *bitmap = base->get_glyph_bitmap(base, letter);
+    if (size == 0U || bitmap == nullptr) {
+      continue;
+    }
+    memcpy(storage + cachedBytes_, bitmap, size);
+    bitmaps_[letter - kFirstGlyph] = storage + cachedBytes_;
+    cachedBytes_ += size;
+  }
+
+  font_ = *base;
+  font_.get_glyph_dsc = getGlyphDsc;
+  font_.get_glyph_bitmap = getGlyphBitmap;
+  font_.user_data = this;
+  cached_ = true;
+}
+
+const lv_font_t *GlyphCacheFont::font() const { return cached_ ? &font_ : base_; }
+
+size_t GlyphCacheFont::cachedBytes() const { return cachedBytes_; }
+
+bool GlyphCacheFont::getGlyphDsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc,
+                                 uint32_t letter, uint32_t next) {
+  const auto *self = static_cast<const GlyphCacheFont *>(font->user_data);
+  return self->base_->get_glyph_dsc(self->base_, dsc, letter, next);
+}
+
+const uint8_t *GlyphCacheFont::getGlyphBitmap(const lv_font_t *font, uint32_t letter) {
+  const auto *self = static_cast<const GlyphCacheFont *>(font->user_data);
+  if (letter >= kFirstGlyph && letter < kFirstGlyph + kGlyphCount &&
+      self->bitmaps_[letter - kFirstGlyph] != nullptr) {
+    return self->bitmaps_[letter - kFirstGlyph];
+  }
+  return self->base_->get_glyph_bitmap(self->base_, letter);
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// Wraps an LVGL font and keeps the bitmaps of a few ASCII glyphs in RAM.
+// Compressed fonts (the generated subsets) otherwise decompress every glyph
+// on every draw; the big numerals that change each second skip that, and
+// with the full fonts they at least come from PSRAM instead of flash.
+// Other glyphs, metrics and kerning go straight to the wrapped font.
+class GlyphCacheFont {
+ public:
+  // Copies the bitmaps of `glyphs` out of `base`. Without memory the
+  // wrapper is skipped and font() returns `base`.
+  void begin(const lv_font_t *base, const char *glyphs);
+  const lv_font_t *font() const;
+  // Bytes held by the cached bitmaps.
+  size_t cachedBytes() const;
+
+ private:
+  static constexpr uint32_t kFirstGlyph = 0x20;
+  static constexpr uint32_t kGlyphCount = 0x7F - kFirstGlyph;
+
+  static bool getGlyphDsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t letter,
+                          uint32_t next);
+  static const uint8_t *getGlyphBitmap(const lv_font_t *font, uint32_t letter);
+
+  const lv_font_t *base_ = nullptr;
+  lv_font_t font_{};
+  bool cached_ = false;
+  size_t cachedBytes_ = 0;
+  const uint8_t *bitmaps_[kGlyphCount] = {};
+};
@@ -0,0 +1,95 @@
+#include "image_asset.h"
+
+#include <esp_timer.h>
+
+#include <cstring>
+
+#include "logger.h"
+
+namespace {
+
+// A control byte below this starts a literal run, at or above it a repeat.
+constexpr uint8_t kRepeatFlag = 0x80;
+constexpr size_t kCachedImages = 4;
+
+struct CachedImage {
+  const CompressedImage *source = nullptr;
+  lv_img_dsc_t decoded{};
+};
+
+CachedImage g_cache[kCachedImages];
+
+bool decode(const CompressedImage &image, uint8_t *out, size_t outSize) {
+  const size_t pixelBytes = image.pixelBytes;
+  size_t in = 0;
+  size_t written = 0;
+  while (in < image.size) {
+    const uint8_t control = image.data[in++];
+    if (control < kRepeatFlag) {
+      const size_t bytes = (control + 1U) * pixelBytes;
+      if (in + bytes > image.size || written + bytes > outSize) {
+        return false;
+      }
+      memcpy(out + written, image.data + in, bytes);
+      in += bytes;
+      written += bytes;
+    } else {
+      const size_t count = control - (kRepeatFlag - 2U);
+      if (in + pixelBytes > image.size || written + (count * pixelBytes) > outSize) {
+        return false;
+      }
+      for (size_t i = 0; i < count; ++i) {
+        memcpy(out + written, image.data + in, pixelBytes);
+        written += pixelBytes;
+      }
+      in += pixelBytes;
+    }
+  }
+  return written == outSize;
+}
+
+}  // namespace
+
+const lv_img_dsc_t *imageAsset(const CompressedImage &image) {
+  CachedImage *slot = nullptr;
+  for (CachedImage &cached : g_cache) {
+    if (cached.source == &image) {
+      return &cached.decoded;
+    }
+    if (cached.source == nullptr && slot == nullptr) {
+      slot = &cached;
+    }
+  }
+  if (slot == nullptr) {
+    LOG_ERROR(Ui, "Image: asset cache full");
+    return nullptr;
+  }
+
+  const int64_t startUs = esp_timer_get_time();
+  const size_t size = static_cast<size_t>(image.width) * image.height * image.pixelBytes;
+  auto *pixels = static_cast<uint8_t *>(ps_malloc(size));
+  if (pixels == nullptr) {
+    pixels = static_cast<uint8_t *>(malloc(size));
+  }
+  if (pixels == nullptr) {
+    LOG_ERROR(Ui, "Image: no memory for %ux%u", image.width, image.height);
+    return nullptr;
+  }
+  if (!decode(image, pixels, size)) {
+    free(pixels);
+    LOG_ERROR(Ui, "Image: corrupt %ux%u asset", image.width, image.height);
+    return nullptr;
+  }
+
+  slot->decoded.header.cf = image.colorFormat;
+  slot->decoded.header.always_zero = 0;
+  slot->decoded.header.w = image.width;
+  slot->decoded.header.h = image.height;
+  slot->decoded.data_size = static_cast<uint32_t>(size);
+  slot->decoded.data = pixels;
+  slot->source = &image;
+  LOG_INFO(Ui, "Image: %ux%u decoded %lu -> %lu B in %lu us", image.width, image.height,
+           static_cast<unsigned long>(image.size), static_cast<unsigned long>(size),
+           static_cast<unsigned long>(esp_timer_get_time() - startUs));
+  return &slot->decoded;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// A true-colour LVGL image kept RLE-compressed in flash, as written by
+// tools/assets/build_assets.py.
+struct CompressedImage {
+  uint16_t width;
+  uint16_t height;
+  uint8_t colorFormat;
+  // 2 for RGB565, 3 with alpha.
+  uint8_t pixelBytes;
+  const uint8_t *data;
+  uint32_t size;
+};
+
+// Decodes the image into PSRAM on first use and returns the cached
+// descriptor from then on; nullptr if memory ran out or the data is corrupt.
+// UI task only.
+const lv_img_dsc_t *imageAsset(const CompressedImage &image);
@@ -0,0 +1,503 @@
+#include "logger.h"
+
+#include <atomic>
+#include <cstring>
+
+namespace {
+
+static_assert((cfg::kLogRingEntries & (cfg::kLogRingEntries - 1U)) == 0U,
+              "kLogRingEntries must be a power of two");
+
+constexpr size_t kModuleCount = static_cast<size_t>(LogModule::Count);
+constexpr size_t kLineBytes = 256;
+
+const char *const kModuleNames[kModuleCount] = {"system", "sensor", "ble", "recorder",
+                                                "power", "rtc", "history", "ui"};
+const char *const kLevelNames[] = {"off", "error", "warn", "info", "debug"};
+
+// Bounded multi-producer ring: a slot's sequence equals the enqueue position
+// that may claim it, position + 1 once its record is ready, and position +
+// kLogRingEntries once log_task has rendered it.
+LogRecord g_records[cfg::kLogRingEntries];
+std::atomic<uint32_t> g_sequences[cfg::kLogRingEntries];
+std::atomic<uint32_t> g_enqueuePosition{0};
+uint32_t g_dequeuePosition = 0;
+bool g_ringReady = false;
+
+std::atomic<uint8_t> g_levels[kModuleCount];
+std::atomic<uint32_t> g_dropped[kModuleCount];
+uint32_t g_droppedReported[kModuleCount] = {};
+
+SemaphoreHandle_t g_drainMutex = nullptr;
+char g_line[kLineBytes];
+LogSink g_sink = nullptr;
+void *g_sinkContext = nullptr;
+
+size_t moduleIndex(LogModule module) {
+  const size_t index = static_cast<size_t>(module);
+  return index < kModuleCount ? index : 0U;
+}
+
+void initRing() {
+  if (g_ringReady) {
+    return;
+  }
+  for (size_t i = 0; i < cfg::kLogRingEntries; ++i) {
+    g_sequences[i].store(static_cast<uint32_t>(i), std::memory_order_relaxed);
+  }
+  for (size_t i = 0; i < kModuleCount; ++i) {
+    g_levels[i].store(static_cast<uint8_t>(cfg::kLogDefaultLevel), std::memory_order_relaxed);
+    g_dropped[i].store(0, std::memory_order_relaxed);
+  }
+  g_ringReady = true;
+}
+
+// Static constructors run before any task, so the ring is usable from the
+// first log call on.
+struct RingInit {
+  RingInit() { initRing(); }
+} g_ringInit;
+
+bool takeRecord(LogRecord *&record) {
+  const uint32_t position = g_dequeuePosition;
+  const size_t index = position & (cfg::kLogRingEntries - 1U);
+  if (g_sequences[index].load(std::memory_order_acquire) != position + 1U) {
+    return false;
+  }
+  record = &g_records[index];
+  return true;
+}
+
+void releaseRecord() {
+  const uint32_t position = g_dequeuePosition++;
+  const size_t index = position & (cfg::kLogRingEntries - 1U);
+  g_sequences[index].store(position + static_cast<uint32_t>(cfg::kLogRingEntries),
+                           std::memory_order_release);
+}
+
+class LineWriter {
+ public:
+  void append(const char *text, size_t size) {
+    if (size > kLineBytes - 2U - length_) {
+      size = kLineBytes - 2U - length_;
+    }
+    memcpy(g_line + length_, text, size);
+    length_ += size;
+  }
+
+  void append(const char *text) { append(text, strlen(text)); }
+
+  // snprintf into the remaining space, clipped at the end of the line.
+  template <typename T>
+  void format(const char *spec, T value) {
+    const size_t room = kLineBytes - 2U - length_;
+    const int written = snprintf(g_line + length_, room + 1U, spec, value);
+    if (written > 0) {
+      length_ += static_cast<size_t>(written) < room ? static_cast<size_t>(written) : room;
+    }
+  }
+
+  void finish() {
+    g_line[length_++] = '\r';
+    g_line[length_++] = '\n';
+  }
+
+  size_t length() const { return length_; }
+
+ private:
+  size_t length_ = 0;
+};
+
+class ArgReader {
+ public:
+  explicit ArgReader(const LogRecord &record) : record_(record) {}
+
+  bool next(LogArgType &type, const uint8_t *&value, size_t &size) {
+    if (index_ >= record_.argCount) {
+      return false;
+    }
+    type = static_cast<LogArgType>(record_.types[index_++]);
+    value = record_.args + offset_;
+    if (type == LogArgType::String) {
+      size = value[0];
+      value += 1;
+      offset_ += 1U + size;
+    } else {
+      size = type == LogArgType::Int64 || type == LogArgType::Unsigned64 ||
+                     type == LogArgType::Double
+                 ? 8U
+                 : 4U;
+      offset_ += size;
+    }
+    return true;
+  }
+
+ private:
+  const LogRecord &record_;
+  size_t index_ = 0;
+  size_t offset_ = 0;
+};
+
+template <typename T>
+T readArg(const uint8_t *value) {
+  T result;
+  memcpy(&result, value, sizeof(result));
+  return result;
+}
+
+long long signedArg(LogArgType type, const uint8_t *value) {
+  switch (type) {
+    case LogArgType::Int:
+      return readArg<int32_t>(value);
+    case LogArgType::Unsigned:
+      return readArg<uint32_t>(value);
+    case LogArgType::Int64:
+    case LogArgType::Unsigned64:
+      return readArg<long long>(value);
+    case LogArgType::Double:
+      return static_cast<long long>(readArg<double>(value));
+    default:
+      return 0;
+  }
+}
+
+// Formats one conversion. `spec` holds the flags, width and precision from
+// the format without a length modifier; the stored type decides the width.
+void renderArg(LineWriter &line, char *spec, size_t specLength, char conversion,
+               LogArgType type, const uint8_t *value, size_t size) {
+  const bool wide = type == LogArgType::Int64 || type == LogArgType::Unsigned64;
+  if (wide && strchr("diuxXoc", conversion) != nullptr) {
+    spec[specLength++] = 'l';
+    spec[specLength++] = 'l';
+  }
+  spec[specLength++] = conversion;
+  spec[specLength] = '\0';
+
+  switch (conversion) {
+    case 'd':
+    case 'i':
+      if (wide) {
+        line.format(spec, signedArg(type, value));
+      } else {
+        line.format(spec, static_cast<int>(signedArg(type, value)));
+      }
+      break;
+    case 'u':
+    case 'x':
+    case 'X':
+    case 'o':
+    case 'c':
+      if (wide) {
+        line.format(spec, static_cast<unsigned long long>(signedArg(type, value)));
+      } else {
+        line.format(spec, static_cast<unsigned>(signedArg(type, value)));
+      }
+      break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+      line.format(spec, type == LogArgType::Double
+                            ? readArg<double>(value)
+                            : static_cast<double>(signedArg(type, value)));
+      break;
+    case 's': {
+      if (type != LogArgType::String) {
+        line.append("?");
+        break;
+      }
+      char text[kLogMaxStringBytes + 1];
+      memcpy(text, value, size);
+      text[size] = '\0';
+      line.format(spec, static_cast<const char *>(text));
+      break;
+    }
+    case 'p':
+      line.format(spec, type == LogArgType::Pointer ? readArg<void *>(value) : nullptr);
+      break;
+    default:
+      line.append("?");
+      break;
+  }
+}
+
+void renderFormat(LineWriter &line, const LogRecord &record) {
+  ArgReader args(record);
+  const char *cursor = record.format;
+  while (*cursor != '\0') {
+    const char *percent = strchr(cursor, '%');
+    if (percent == nullptr) {
+      line.append(cursor);
+      break;
+    }
+    line.append(cursor, static_cast<size_t>(percent - cursor));
+    cursor = percent + 1;
+    if (*cursor == '%') {
+      line.append("%");
+      ++cursor;
+      continue;
+    }
+
+    char spec[24] = "%";
+    size_t specLength = 1;
+    while (*cursor != '\0' && strchr("-+ #0123456789.", *cursor) != nullptr) {
+      if (specLength < sizeof(spec) - 4U) {
+        spec[specLength++] = *cursor;
+      }
+      ++cursor;
+    }
+    while (*cursor != '\0' && strchr("hlLqjzt", *cursor) != nullptr) {
+      ++cursor;
+    }
+    if (*cursor == '\0') {
+      break;
+    }
+    const char conversion = *cursor++;
+
+    LogArgType type = LogArgType::Int;
+    const uint8_t *value = nullptr;
+    size_t size = 0;
+    if (!args.next(type, value, size)) {
+      line.append("?");
+      continue;
+    }
+    renderArg(line, spec, specLength, conversion, type, value, size);
+  }
+  if (record.truncated) {
+    line.append(" [truncated]");
+  }
+}
+
+void emitLine(size_t length) {
+  if (g_sink != nullptr) {
+    g_sink(reinterpret_cast<const uint8_t *>(g_line), length, g_sinkContext);
+  } else {
+    Serial.write(reinterpret_cast<const uint8_t *>(g_line), length);
+  }
+}
+
+void writeRecord(const LogRecord &record) {
+  LineWriter line;
+  line.format("%lu.", static_cast<unsigned long>(record.timeMs / 1000U));
+  line.format("%03lu ", static_cast<unsigned long>(record.timeMs % 1000U));
+  if (record.level == LogLevel::Error) {
+    line.append("E ");
+  } else if (record.level == LogLevel::Warn) {
+    line.append("W ");
+  }
+  renderFormat(line, record);
+  line.finish();
+  emitLine(line.length());
+}
+
+void reportDrops() {
+  for (size_t i = 0; i < kModuleCount; ++i) {
+    const uint32_t dropped = g_dropped[i].load(std::memory_order_relaxed);
+    if (dropped == g_droppedReported[i]) {
+      continue;
+    }
+    LineWriter line;
+    line.append("Log: dropped ");
+    line.format("%lu", static_cast<unsigned long>(dropped - g_droppedReported[i]));
+    line.append(" ");
+    line.append(kModuleNames[i]);
+    line.format(" entries (%lu total)", static_cast<unsigned long>(dropped));
+    line.finish();
+    emitLine(line.length());
+    g_droppedReported[i] = dropped;
+  }
+}
+
+void drain() {
+  LogRecord *record = nullptr;
+  while (takeRecord(record)) {
+    writeRecord(*record);
+    releaseRecord();
+  }
+  reportDrops();
+}
+
+void logTask(void *) {
+  for (;;) {
+    logFlush();
+    vTaskDelay(pdMS_TO_TICKS(cfg::kLogDrainPeriodMs));
+  }
+}
+
+bool parseModule(const char *text, size_t length, int &module) {
+  if (length == 3U && strncmp(text, "all", 3) == 0) {
+    module = -1;
+    return true;
+  }
+  for (size_t i = 0; i < kModuleCount; ++i) {
+    if (strlen(kModuleNames[i]) == length && strncmp(text, kModuleNames[i], length) == 0) {
+      module = static_cast<int>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool parseLevel(const char *text, LogLevel &level) {
+  for (size_t i = 0; i < sizeof(kLevelNames) / sizeof(kLevelNames[0]); ++i) {
+    if (strcmp(text, kLevelNames[i]) == 0) {
+      level = static_cast<LogLevel>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+void LogRecord::put(const char *value) {
+  if (value == nullptr) {
+    value = "(null)";
+  }
+  const size_t length = strnlen(value, kLogMaxStringBytes);
+  if (argCount >= kLogMaxArgs || kLogArgBytes - argBytes < 1U + length) {
+    truncated = true;
+    return;
+  }
+  types[argCount++] = static_cast<uint8_t>(LogArgType::String);
+  args[argBytes] = static_cast<uint8_t>(length);
+  memcpy(args + argBytes + 1U, value, length);
+  argBytes = static_cast<uint8_t>(argBytes + 1U + length);
+}
+
+void LogRecord::putWide(long long value, size_t size) {
+  if (size <= 4U) {
+    const int32_t narrow = static_cast<int32_t>(value);
+    putRaw(LogArgType::Int, &narrow, sizeof(narrow));
+  } else {
+    putRaw(LogArgType::Int64, &value, sizeof(value));
+  }
+}
+
+void LogRecord::putWide(unsigned long long value, size_t size) {
+  if (size <= 4U) {
+    const uint32_t narrow = static_cast<uint32_t>(value);
+    putRaw(LogArgType::Unsigned, &narrow, sizeof(narrow));
+  } else {
+    putRaw(LogArgType::Unsigned64, &value, sizeof(value));
+  }
+}
+
+void LogRecord::putRaw(LogArgType type, const void *value, size_t size) {
+  if (argCount >= kLogMaxArgs || kLogArgBytes - argBytes < size) {
+    truncated = true;
+    return;
+  }
+  types[argCount++] = static_cast<uint8_t>(type);
+  memcpy(args + argBytes, value, size);
+  argBytes = static_cast<uint8_t>(argBytes + size);
+}
+
+bool logEnabled(LogModule module, LogLevel level) {
+  return level != LogLevel::Off &&
+         static_cast<uint8_t>(level) <=
+             g_levels[moduleIndex(module)].load(std::memory_order_relaxed);
+}
+
+LogRecord *logReserve(LogModule module, LogLevel level, const char *format) {
+  uint32_t position = g_enqueuePosition.load(std::memory_order_relaxed);
+  for (;;) {
+    const size_t index = position & (cfg::kLogRingEntries - 1U);
+    const uint32_t sequence = g_sequences[index].load(std::memory_order_acquire);
+    const int32_t difference = static_cast<int32_t>(sequence - position);
+    if (difference == 0) {
+      if (g_enqueuePosition.compare_exchange_weak(position, position + 1U,
+                                                  std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (difference < 0) {
+      g_dropped[moduleIndex(module)].fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    } else {
+      position = g_enqueuePosition.load(std::memory_order_relaxed);
+    }
+  }
+
+  LogRecord &record = g_records[position & (cfg::kLogRingEntries - 1U)];
+  record.format = format;
+  record.timeMs = millis();
+  record.position = position;
+  record.module = module;
+  record.level = level;
+  record.argCount = 0;
+  record.argBytes = 0;
+  record.truncated = false;
+  return &record;
+}
+
+void logCommit(LogRecord *record) {
+  const size_t index = record->position & (cfg::kLogRingEntries - 1U);
+  g_sequences[index].store(record->position + 1U, std::memory_order_release);
+}
+
+void logBegin() {
+  if (g_drainMutex != nullptr) {
+    return;
+  }
+  g_drainMutex = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCore(logTask, "log_task", 4096, nullptr, 1, nullptr, PRO_CPU_NUM);
+}
+
+void logFlush() {
+  if (g_drainMutex != nullptr) {
+    xSemaphoreTake(g_drainMutex, portMAX_DELAY);
+  }
+  drain();
+  if (g_drainMutex != nullptr) {
+    xSemaphoreGive(g_drainMutex);
+  }
+}
+
+void logSetSink(LogSink sink, void *context) {
+  if (g_drainMutex != nullptr) {
+    xSemaphoreTake(g_drainMutex, portMAX_DELAY);
+  }
+  g_sink = sink;
+  g_sinkContext = context;
+  if (g_drainMutex != nullptr) {
+    xSemaphoreGive(g_drainMutex);
+  }
+}
+
+void logSetLevel(LogModule module, LogLevel level) {
+  g_levels[moduleIndex(module)].store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+}
+
+LogLevel logLevel(LogModule module) {
+  return static_cast<LogLevel>(g_levels[moduleIndex(module)].load(std::memory_order_relaxed));
+}
+
+uint32_t logDropped(LogModule module) {
+  return g_dropped[moduleIndex(module)].load(std::memory_order_relaxed);
+}
+
+bool logCommand(const char *line) {
+  if (strncmp(line, "LOG=", 4) != 0) {
+    return false;
+  }
+  const char *name = line + 4;
+  const char *colon = strchr(name, ':');
+  int module = 0;
+  LogLevel level = LogLevel::Info;
+  if (colon == nullptr || !parseModule(name, static_cast<size_t>(colon - name), module) ||
+      !parseLevel(colon + 1, level)) {
+    LOG_WARN(System, "Log: use LOG=<all|system|sensor|ble|recorder|power|rtc|history|ui>:"
+                     "<off|error|warn|info|debug>");
+    return true;
+  }
+  for (size_t i = 0; i < kModuleCount; ++i) {
+    if (module < 0 || static_cast<size_t>(module) == i) {
+      logSetLevel(static_cast<LogModule>(i), level);
+    }
+  }
+  LOG_INFO(System, "Log: %s level %s", module < 0 ? "all" : kModuleNames[module],
+           kLevelNames[static_cast<size_t>(level)]);
+  return true;
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "config.h"
+
+// Deferred logging. LOG_* copies the format pointer and the raw arguments
+// into a lock-free ring and returns; log_task formats the entries and writes
+// them to Serial (or the sink set with logSetSink), so only that task ever
+// waits on USB CDC. When the ring is
+// full the entry is dropped and counted against its module. Formats must be
+// string literals: the pointer is kept until log_task renders the entry.
+// String arguments are copied (up to kLogMaxStringBytes).
+
+constexpr size_t kLogMaxArgs = 20;
+constexpr size_t kLogArgBytes = 128;
+constexpr size_t kLogMaxStringBytes = 47;
+
+enum class LogArgType : uint8_t {
+  Int = 0,
+  Unsigned = 1,
+  Int64 = 2,
+  Unsigned64 = 3,
+  Double = 4,
+  String = 5,
+  Pointer = 6,
+};
+
+struct LogRecord {
+  const char *format = nullptr;
+  uint32_t timeMs = 0;
+  uint32_t position = 0;
+  LogModule module = LogModule::System;
+  LogLevel level = LogLevel::Info;
+  uint8_t argCount = 0;
+  uint8_t argBytes = 0;
+  bool truncated = false;
+  uint8_t types[kLogMaxArgs] = {};
+  uint8_t args[kLogArgBytes] = {};
+
+  void put(int value) { putRaw(LogArgType::Int, &value, sizeof(value)); }
+  void put(unsigned value) { putRaw(LogArgType::Unsigned, &value, sizeof(value)); }
+  void put(long value) { putWide(static_cast<long long>(value), sizeof(value)); }
+  void put(unsigned long value) {
+    putWide(static_cast<unsigned long long>(value), sizeof(value));
+  }
+  void put(long long value) { putRaw(LogArgType::Int64, &value, sizeof(value)); }
+  void put(unsigned long long value) {
+    putRaw(LogArgType::Unsigned64, &value, sizeof(value));
+  }
+  void put(double value) { putRaw(LogArgType::Double, &value, sizeof(value)); }
+  void put(const char *value);
+  void put(const void *value) { putRaw(LogArgType::Pointer, &value, sizeof(value)); }
+
+ private:
+  void putWide(long long value, size_t size);
+  void putWide(unsigned long long value, size_t size);
+  void putRaw(LogArgType type, const void *value, size_t size);
+};
+
+// Never called; lets the compiler check LOG_* formats against their
+// arguments.
+inline void logFormatCheck(const char *format, ...) __attribute__((format(printf, 1, 2)));
+inline void logFormatCheck(const char *, ...) {}
+
+bool logEnabled(LogModule module, LogLevel level);
+// Claims a ring slot, or returns nullptr and counts a drop.
+LogRecord *logReserve(LogModule module, LogLevel level, const char *format);
+void logCommit(LogRecord *record);
+
+template <typename... Args>
+void logWrite(LogModule module, LogLevel level, const char *format, Args... args) {
+  LogRecord *record = logReserve(module, level, format);
+  if (record == nullptr) {
+    return;
+  }
+  const int expand[] = {0, (record->put(args), 0)...};
+  (void)expand;
+  logCommit(record);
+}
+
+// Starts log_task. Entries logged earlier are kept in the ring until then.
+void logBegin();
+// Renders everything queued so far from the calling task, e.g. before a
+// restart.
+void logFlush();
+// Where log_task writes rendered lines (with their "\r\n"); nullptr restores
+// Serial. Switches between two lines, never in the middle of one.
+using LogSink = void (*)(const uint8_t *line, size_t length, void *context);
+void logSetSink(LogSink sink, void *context);
+void logSetLevel(LogModule module, LogLevel level);
+LogLevel logLevel(LogModule module);
+uint32_t logDropped(LogModule module);
+// Handles a "LOG=<module|all>:<level>" serial line; false if the line is
+// not a log command.
+bool logCommand(const char *line);
+
+#define ERGO_LOG(module, level, ...)                      \
+  do {                                                    \
+    if (false) {                                          \
+      logFormatCheck(__VA_ARGS__);                        \
+    }                                                     \
+    if (logEnabled(module, level)) {                      \
+      logWrite(module, level, __VA_ARGS__);               \
+    }                                                     \
+  } while (0)
+
+#define LOG_ERROR(module, ...) ERGO_LOG(LogModule::module, LogLevel::Error, __VA_ARGS__)
+#define LOG_WARN(module, ...) ERGO_LOG(LogModule::module, LogLevel::Warn, __VA_ARGS__)
+#define LOG_INFO(module, ...) ERGO_LOG(LogModule::module, LogLevel::Info, __VA_ARGS__)
+#define LOG_DEBUG(module, ...) ERGO_LOG(LogModule::module, LogLevel::Debug, __VA_ARGS__)
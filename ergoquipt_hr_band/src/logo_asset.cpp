@@ -1,440 +1,309 @@
+// Generated by tools/assets/build_assets.py from tools/assets/ergo_logo.png.
+// Do not edit; change the PNG and rebuild.
 #include "logo_asset.h"
 
+// 112x23 RGB565 (bytes swapped) + alpha, RLE: 7728 -> 5338 bytes.
 static const uint8_t ergo_logo_data[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7B, 0x02,
-  0x00, 0x00, 0x00, 0x1C, 0x2D, 0x3F, 0x5D, 0x35, 0xAA, 0x1C, 0x2D, 0x6F, 0x3D, 0x2D, 0x29, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x5F, 0x05, 0x03, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0x07, 0x01, 0xFF, 0x07, 0x01, 0xFF, 0x07, 0x01,
-  0xFF, 0x07, 0x01, 0xFF, 0x07, 0x01, 0xFF, 0x07, 0x01, 0xFF, 0x07, 0x01, 0xFF, 0x07, 0x01, 0xFF, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0xFF, 0x07, 0x01,
-  0xFF, 0x07, 0x01, 0xFF, 0x07, 0x01, 0xFF, 0x07, 0x01, 0xFF, 0x07, 0x01, 0x1F, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x03, 0x02, 0x5F, 0x05, 0x03, 0xF7, 0x03, 0x04, 0xF7, 0x03, 0x04, 0x5F, 0x05, 0x03, 0xFF, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x03, 0x02, 0x5F, 0x05, 0x03, 0xF7, 0x03, 0x04, 0xF7, 0x03, 0x04, 0x5F, 0x05, 0x03, 0xFF, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x55, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x2D, 0x5F,
-  0xBF, 0x35, 0xFF, 0x3D, 0x2D, 0xFF, 0x3D, 0x2D, 0xEF, 0x3D, 0x2D, 0xAB, 0x1C, 0x2D, 0x37, 0x00, 0x00, 0x00,
-  0x1F, 0x00, 0x01, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x5F, 0x05, 0x03, 0xFF, 0x03, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x05, 0x03, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x55, 0x05, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x05, 0x03, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x55, 0x05, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x5F, 0x55, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x2D, 0x47, 0x5D, 0x2D, 0xE7, 0x3D, 0x2D, 0xFF,
-  0x7E, 0x35, 0xFF, 0x7E, 0x35, 0xFF, 0x3D, 0x2D, 0xFB, 0x1C, 0x2D, 0x85, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00,
-  0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0xFB, 0x04, 0x08,
-  0xBF, 0x05, 0x07, 0xBF, 0x05, 0x07, 0xBF, 0x05, 0x07, 0xBF, 0x05, 0x07, 0xBF, 0x05, 0x07, 0xBF, 0x05, 0x07,
-  0xBF, 0x05, 0x07, 0xFB, 0x04, 0x08, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01,
-  0xFB, 0x04, 0x08, 0xBF, 0x05, 0x07, 0xBF, 0x05, 0x07, 0xBF, 0x05, 0x07, 0xBF, 0x05, 0x07, 0xBF, 0x05, 0x07,
-  0x7F, 0x06, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0xFF, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x15, 0x1B, 0x3D, 0x0D, 0x3E, 0x1D, 0x0D, 0x53, 0x1D, 0x0D, 0x51,
-  0x3D, 0x0D, 0x3B, 0x3D, 0x0D, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x1F, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x15, 0x1E, 0x3D, 0x0D, 0x41, 0x1D, 0x0D, 0x54, 0x1D, 0x0D, 0x51,
-  0x1D, 0x0D, 0x3A, 0x5E, 0x0D, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x1F, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x5F, 0x55, 0x03, 0xF7, 0x3B, 0x04,
-  0x55, 0x05, 0x03, 0x5F, 0x05, 0x03, 0xFB, 0x2C, 0x18, 0x3C, 0x2D, 0x4C, 0x1D, 0x2D, 0xA8, 0x3D, 0x2D, 0xFD,
-  0x3D, 0x2D, 0xFF, 0x7E, 0x35, 0xFF, 0x1D, 0x2D, 0xA8, 0xDF, 0x34, 0x05, 0xFF, 0x03, 0x02, 0xFF, 0x07, 0x01,
-  0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x3D, 0x0D, 0xA0, 0x5E, 0x0D, 0xE1, 0x1D, 0x0D, 0xDD, 0x1D, 0x0D, 0xDF,
-  0x1D, 0x0D, 0xDF, 0x1D, 0x0D, 0xDF, 0x1D, 0x0D, 0xDF, 0x1D, 0x0D, 0xDF, 0x1D, 0x0D, 0xDC, 0x7F, 0x0D, 0xE1,
-  0x3D, 0x0D, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x8B, 0x7F, 0x0D, 0xE1, 0x1D, 0x0D, 0xDC,
-  0x1D, 0x0D, 0xDF, 0x1D, 0x0D, 0xDF, 0x1D, 0x0D, 0xDF, 0x1D, 0x0D, 0xDF, 0x1D, 0x0D, 0xDB, 0x3D, 0x0D, 0xC4,
-  0x3D, 0x0D, 0x90, 0x1D, 0x15, 0x2F, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x51, 0x3D, 0x0D, 0xB8,
-  0x3D, 0x0D, 0xF0, 0x3E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF, 0x3D, 0x0D, 0xEC,
-  0x3D, 0x0D, 0xAF, 0x3D, 0x0D, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xEF, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0D, 0x5A, 0x3D, 0x0D, 0xBE,
-  0x3D, 0x0D, 0xF2, 0x3E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x3D, 0x0D, 0xEA,
-  0x3E, 0x0D, 0xAC, 0x3D, 0x0D, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x2D, 0x47, 0x3D, 0x2D, 0xDE, 0x3D, 0x2D, 0xFF,
-  0x7E, 0x35, 0xFF, 0x1C, 0x2D, 0x9B, 0x00, 0x00, 0x00, 0x5F, 0x55, 0x03, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00,
-  0x1D, 0x0D, 0xC9, 0x9F, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF,
-  0x3E, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x9F, 0x0D, 0xFF, 0x1D, 0x0D, 0xA4, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1D, 0x0D, 0xB0, 0x9F, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF,
-  0x3E, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x7F, 0x0D, 0xFF, 0x5E, 0x0D, 0xF9,
-  0x1C, 0x0D, 0x6C, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00,
-  0xDB, 0x14, 0x0F, 0x3D, 0x0D, 0xAA, 0x7F, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFF, 0x1D, 0x0D, 0xFD,
-  0x1D, 0x0D, 0xFF, 0x1D, 0x0D, 0xFF, 0x1D, 0x0D, 0xFC, 0x1D, 0x0D, 0xFF, 0x7F, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF,
-  0x1D, 0x0D, 0x97, 0xBF, 0x05, 0x07, 0xFF, 0x07, 0x01, 0x1F, 0x00, 0x01, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00,
-  0x1C, 0x0D, 0x16, 0x3D, 0x0D, 0xB5, 0x7F, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFE, 0x1D, 0x0D, 0xFD,
-  0x1D, 0x0D, 0xFF, 0x1D, 0x0D, 0xFF, 0x1D, 0x0D, 0xFC, 0x3D, 0x0D, 0xFF, 0x7F, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF,
-  0x1D, 0x0D, 0x93, 0xFF, 0x03, 0x04, 0xFF, 0x07, 0x01, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0x9B, 0x24, 0x07,
-  0x3D, 0x2D, 0x51, 0x1C, 0x2D, 0x94, 0x1C, 0x2D, 0xAC, 0x3C, 0x2D, 0x9B, 0x3C, 0x2D, 0x60, 0xFB, 0x24, 0x15,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x24, 0x20, 0x3D, 0x2D, 0xD8, 0x3D, 0x2D, 0xFF, 0x5E, 0x35, 0xFF,
-  0x1C, 0x2D, 0x5C, 0x00, 0x00, 0x00, 0xFF, 0x3D, 0x04, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xC0, 0x5E, 0x0D, 0xFD,
-  0x1D, 0x0D, 0xFA, 0x1D, 0x0D, 0xFE, 0x3E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF,
-  0x3D, 0x0D, 0xFF, 0x9F, 0x0D, 0xFF, 0x1D, 0x0D, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xA9,
-  0x7F, 0x0D, 0xFD, 0x1D, 0x0D, 0xFA, 0x1D, 0x0D, 0xFE, 0x3E, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF,
-  0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFA, 0x3D, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0x39,
-  0x00, 0x00, 0x00, 0xF7, 0x03, 0x04, 0xFF, 0x03, 0x02, 0x5C, 0x1D, 0x09, 0x1D, 0x0D, 0xC0, 0x9F, 0x0D, 0xFF,
-  0x1D, 0x0D, 0xFB, 0x1D, 0x0D, 0xFC, 0x7F, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF, 0x1D, 0x0D, 0xF3, 0x1D, 0x0D, 0xF4,
-  0x5E, 0x0D, 0xFF, 0x7E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFB, 0x1D, 0x0D, 0xF8, 0xDF, 0x15, 0xFF, 0x1D, 0x0D, 0xAB,
-  0x00, 0x00, 0x00, 0x5F, 0x05, 0x03, 0xFF, 0x03, 0x02, 0xFD, 0x0C, 0x10, 0x3D, 0x0D, 0xCE, 0x7F, 0x0D, 0xFF,
-  0x1D, 0x0D, 0xFA, 0x1D, 0x0D, 0xFD, 0x7F, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x1D, 0x0D, 0xF2, 0x1D, 0x0D, 0xF5,
-  0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFA, 0x1D, 0x0D, 0xFC, 0x9F, 0x0D, 0xFF, 0x1D, 0x0D, 0xA4,
-  0x1F, 0x00, 0x01, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0xFC, 0x2C, 0x3D, 0x3D, 0x2D, 0xD1, 0x5E, 0x35, 0xFF, 0x7E, 0x35, 0xFF,
-  0x7E, 0x35, 0xFF, 0x7E, 0x35, 0xFF, 0x7E, 0x35, 0xFF, 0x3D, 0x2D, 0xE1, 0x1C, 0x2D, 0x57, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1C, 0x2D, 0x2E, 0x3D, 0x2D, 0xF1, 0x5E, 0x35, 0xFD, 0x1C, 0x2D, 0xDE, 0x5B, 0x35, 0x0F,
-  0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xC2, 0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFE, 0x1D, 0x0D, 0xE8,
-  0x1D, 0x0D, 0x4D, 0x1D, 0x0D, 0x44, 0x3D, 0x0D, 0x45, 0x3D, 0x0D, 0x44, 0x1D, 0x0D, 0x44, 0x5E, 0x0D, 0x46,
-  0x3D, 0x0D, 0x22, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xAA, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xFD,
-  0x1D, 0x0D, 0xF7, 0x1D, 0x0D, 0x5B, 0x1D, 0x0D, 0x43, 0x1D, 0x0D, 0x48, 0x1D, 0x0D, 0x5F, 0x1D, 0x0D, 0xC6,
-  0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xF9, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0x9E, 0x00, 0x00, 0x00, 0x5F, 0x05, 0x06,
-  0x00, 0x00, 0x00, 0x1D, 0x0D, 0x89, 0x9F, 0x0D, 0xFF, 0x1D, 0x0D, 0xF8, 0x3D, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF,
-  0x3D, 0x0D, 0x9B, 0x1D, 0x0D, 0x40, 0x1D, 0x0D, 0x1E, 0x1C, 0x0D, 0x21, 0x3D, 0x0D, 0x47, 0x1D, 0x0D, 0xA8,
-  0x5E, 0x0D, 0xFF, 0x7F, 0x0D, 0xFF, 0x3E, 0x0D, 0xD4, 0x1D, 0x0D, 0x4B, 0xFF, 0x07, 0x01, 0xF7, 0x03, 0x04,
-  0x00, 0x00, 0x00, 0x1D, 0x0D, 0x9D, 0x9F, 0x0D, 0xFF, 0x1D, 0x0D, 0xF8, 0x3D, 0x0D, 0xFF, 0x3D, 0x0D, 0xFB,
-  0x3D, 0x0D, 0x92, 0x1D, 0x0D, 0x3C, 0x3D, 0x0D, 0x1D, 0x1D, 0x0D, 0x21, 0x3D, 0x0D, 0x49, 0x1D, 0x0D, 0xAD,
-  0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFD, 0x1D, 0x0D, 0xF9, 0x9F, 0x0D, 0xFF, 0x1D, 0x0D, 0x67, 0x00, 0x00, 0x00,
-  0x5F, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x2D, 0x3E,
-  0x3D, 0x2D, 0xF6, 0x5E, 0x35, 0xFF, 0x1C, 0x2D, 0xFC, 0x1C, 0x2D, 0xFB, 0x1C, 0x2D, 0xFB, 0x1C, 0x2D, 0xFB,
-  0x1C, 0x2D, 0xFB, 0x3D, 0x2D, 0xFF, 0x5E, 0x35, 0xFF, 0x1C, 0x2D, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1C, 0x2D, 0x80, 0x5E, 0x35, 0xFF, 0x5E, 0x35, 0xFF, 0x1C, 0x2D, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1D, 0x0D, 0xC2, 0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x1D, 0x0D, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x05, 0x03,
-  0x00, 0x00, 0x00, 0x1D, 0x0D, 0xAA, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xFE, 0x1D, 0x0D, 0xF3, 0x7E, 0x0D, 0x13,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0D, 0x14, 0x3D, 0x0D, 0xEB, 0x3D, 0x0D, 0xFE,
-  0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xC9, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x3D, 0x15, 0x1F, 0x3D, 0x0D, 0xF5,
-  0x3D, 0x0D, 0xFC, 0x1D, 0x0D, 0xFC, 0x3E, 0x0D, 0xFB, 0x1D, 0x0D, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x6A, 0x3E, 0x0D, 0x94,
-  0x9B, 0x14, 0x0E, 0x00, 0x00, 0x00, 0x5F, 0x05, 0x03, 0x00, 0x00, 0x00, 0x1D, 0x15, 0x2C, 0x3D, 0x0D, 0xFC,
-  0x1D, 0x0D, 0xFC, 0x3D, 0x0D, 0xFD, 0x3E, 0x0D, 0xF6, 0x1D, 0x0D, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0D, 0x76, 0x5E, 0x0D, 0xFF,
-  0x1D, 0x0D, 0xFB, 0x3E, 0x0D, 0xFE, 0x1D, 0x0D, 0xE3, 0xFD, 0x14, 0x0D, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x35, 0x0F, 0x1C, 0x2D, 0xDA, 0x5E, 0x35, 0xFF, 0x1C, 0x2D, 0xF9,
-  0x1C, 0x2D, 0xFD, 0x1C, 0x2D, 0xFF, 0x1C, 0x2D, 0xFE, 0x1C, 0x2D, 0xFE, 0x1C, 0x2D, 0xFE, 0x1C, 0x2D, 0xFB,
-  0x3D, 0x2D, 0xFD, 0x3D, 0x2D, 0xF3, 0x1C, 0x2D, 0x27, 0xFF, 0x07, 0x01, 0x3D, 0x2D, 0x1D, 0x1C, 0x2D, 0xEE,
-  0x7E, 0x35, 0xFE, 0x1C, 0x2D, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xC2, 0x5E, 0x0D, 0xFF,
-  0x3D, 0x0D, 0xFF, 0x1D, 0x0D, 0xE1, 0x3E, 0x0D, 0x11, 0x5A, 0x05, 0x06, 0xBB, 0x05, 0x07, 0x5A, 0x05, 0x06,
-  0x5A, 0x05, 0x06, 0xDF, 0x04, 0x05, 0xEF, 0x03, 0x02, 0x5F, 0x05, 0x03, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xAA,
-  0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xFE, 0x1D, 0x0D, 0xF4, 0x3D, 0x0D, 0x25, 0x5F, 0x05, 0x06, 0xFF, 0x04, 0x08,
-  0xBF, 0x05, 0x07, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xD0, 0x5E, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF, 0x1D, 0x0D, 0xD2,
-  0x7F, 0x06, 0x05, 0x00, 0x00, 0x00, 0x3D, 0x0D, 0x6E, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xF8, 0x7F, 0x0D, 0xFF,
-  0x1D, 0x0D, 0x94, 0x00, 0x00, 0x00, 0xDF, 0x04, 0x05, 0x5F, 0x05, 0x03, 0xFF, 0x03, 0x02, 0xFF, 0x05, 0x04,
-  0x5A, 0x05, 0x06, 0xD9, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x04, 0x05,
-  0xF7, 0x03, 0x04, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x80, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xF8, 0x7F, 0x0D, 0xFF,
-  0x1D, 0x0D, 0x81, 0x00, 0x00, 0x00, 0x5A, 0x05, 0x06, 0x55, 0x05, 0x03, 0xEF, 0x03, 0x02, 0xFF, 0x03, 0x02,
-  0x5F, 0x05, 0x03, 0xF7, 0x03, 0x04, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xB4, 0x7E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFA,
-  0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0x4D, 0x00, 0x00, 0x00, 0x5F, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1C, 0x2D, 0x6C, 0x5E, 0x35, 0xFF, 0x1C, 0x2D, 0xFC, 0x5D, 0x2D, 0xFF, 0x5D, 0x2D, 0xFF, 0x3D, 0x2D, 0xFF,
-  0x3D, 0x2D, 0xFF, 0x3D, 0x2D, 0xFF, 0x3D, 0x2D, 0xFF, 0x3D, 0x2D, 0xFF, 0x1C, 0x2D, 0xFF, 0x9F, 0x35, 0xFF,
-  0x1C, 0x2D, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x2D, 0xB8, 0x9F, 0x35, 0xFF, 0x1C, 0x2D, 0xE1,
-  0x5D, 0x2D, 0x0C, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xC3, 0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x1D, 0x0D, 0xDF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x5F, 0x05, 0x03, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xAA, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xFE,
-  0x1D, 0x0D, 0xF3, 0x5E, 0x0D, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x27,
-  0x3D, 0x0D, 0xF2, 0x3D, 0x0D, 0xFD, 0x5E, 0x0D, 0xFE, 0x1D, 0x0D, 0xC4, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00,
-  0x1D, 0x0D, 0xA5, 0x7F, 0x0D, 0xFE, 0x1D, 0x0D, 0xFB, 0x3D, 0x0D, 0xFC, 0x3D, 0x0D, 0x30, 0xFF, 0x03, 0x02,
-  0x55, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00,
-  0x1D, 0x0D, 0xB7, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFD, 0x3D, 0x0D, 0xF7, 0x1D, 0x0D, 0x21, 0xFF, 0x03, 0x02,
-  0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x03, 0x04,
-  0xFF, 0x07, 0x01, 0x1D, 0x0D, 0x4E, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xF8, 0x7F, 0x0D, 0xFE, 0x1D, 0x0D, 0x85,
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x2D, 0xA5, 0x5D, 0x35, 0xFE,
-  0x3D, 0x2D, 0xFE, 0x1C, 0x2D, 0xD2, 0x1C, 0x2D, 0x4B, 0x1C, 0x2D, 0x3D, 0x1C, 0x2D, 0x3F, 0x1C, 0x2D, 0x3E,
-  0x1C, 0x2D, 0x3E, 0x1C, 0x2D, 0x3E, 0x1C, 0x2D, 0x3D, 0x1C, 0x2D, 0x40, 0x1D, 0x2D, 0x2F, 0xDF, 0x34, 0x05,
-  0x5F, 0x55, 0x03, 0x1C, 0x2D, 0x8B, 0x9F, 0x35, 0xFF, 0x1C, 0x2D, 0xEC, 0x1C, 0x2D, 0x1B, 0x00, 0x00, 0x00,
-  0x1D, 0x0D, 0xC3, 0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFE, 0x1D, 0x0D, 0xE7, 0x3D, 0x0D, 0x44, 0x3D, 0x0D, 0x3B,
-  0x1D, 0x0D, 0x3D, 0x3D, 0x0D, 0x3B, 0x3E, 0x15, 0x3D, 0x1D, 0x0D, 0x26, 0x00, 0x00, 0x00, 0xF7, 0x03, 0x04,
-  0x00, 0x00, 0x00, 0x1D, 0x0D, 0xAA, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xFD, 0x1D, 0x0D, 0xF8, 0x1D, 0x0D, 0x6B,
-  0x1D, 0x0D, 0x54, 0x1D, 0x0D, 0x58, 0x1D, 0x0D, 0x76, 0x1D, 0x0D, 0xDD, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xF9,
-  0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xC0, 0x5E, 0x0D, 0xFF,
-  0x3D, 0x0D, 0xFF, 0x1D, 0x0D, 0xE8, 0x3E, 0x0D, 0x11, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00,
-  0xFF, 0x07, 0x01, 0x1D, 0x0D, 0x31, 0x3D, 0x15, 0x3D, 0x3D, 0x0D, 0x3B, 0x1D, 0x0D, 0x3C, 0x3D, 0x0D, 0x3B,
-  0x1D, 0x0D, 0x3D, 0x3D, 0x0D, 0x33, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xCF, 0x5E, 0x0D, 0xFF,
-  0x3E, 0x0D, 0xFF, 0x1D, 0x0D, 0xDB, 0x5A, 0x05, 0x06, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x26,
-  0x1D, 0x0D, 0xFB, 0x1D, 0x0D, 0xFD, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xA0, 0x00, 0x00, 0x00, 0x5F, 0x05, 0x03,
-  0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x2D, 0xAF, 0x3D, 0x2D, 0xFF, 0x7E, 0x35, 0xFF, 0x1C, 0x2D, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x2D, 0x77,
-  0x9F, 0x35, 0xFF, 0x1C, 0x2D, 0xEE, 0x3D, 0x2D, 0x1D, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xC3, 0x5E, 0x0D, 0xFF,
-  0x1D, 0x0D, 0xFC, 0x1D, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF,
-  0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x04, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xAA,
-  0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xFC, 0x1D, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF,
-  0x7F, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFD, 0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFA, 0x3D, 0x0D, 0x2B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xC3, 0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x1D, 0x0D, 0xE3,
-  0x1F, 0x15, 0x0E, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x02, 0x00, 0x00, 0x00, 0x3E, 0x0D, 0x11, 0x1D, 0x0D, 0xEA,
-  0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xF5,
-  0x3E, 0x0D, 0x14, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xD2, 0x5E, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF, 0x1D, 0x0D, 0xD7,
-  0x5F, 0x05, 0x03, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0x3D, 0x0D, 0x22, 0x1D, 0x0D, 0xF9, 0x1D, 0x0D, 0xFE,
-  0x7F, 0x0D, 0xFF, 0x3D, 0x0D, 0xA3, 0x00, 0x00, 0x00, 0x33, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x8A, 0xFF, 0xFF, 0xF0,
-  0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x14, 0xFF, 0xFF, 0xB6, 0xFF, 0xFF, 0x46, 0x00, 0x00, 0x00,
-  0x1C, 0x2D, 0xA5, 0x5D, 0x35, 0xFE, 0x3D, 0x2D, 0xFE, 0x1C, 0x2D, 0xD5, 0x1C, 0x2D, 0x55, 0x1C, 0x2D, 0x46,
-  0x1C, 0x2D, 0x49, 0x1C, 0x2D, 0x48, 0x1C, 0x2D, 0x48, 0x1C, 0x2D, 0x48, 0x1C, 0x2D, 0x48, 0x1C, 0x2D, 0x48,
-  0x1C, 0x2D, 0x47, 0x1C, 0x2D, 0x48, 0x3C, 0x2D, 0x41, 0x1C, 0x2D, 0xA8, 0x7E, 0x35, 0xFF, 0x1C, 0x2D, 0xED,
-  0x1C, 0x2D, 0x1B, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xC3, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFC, 0x3D, 0x0D, 0xFF,
-  0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x9F, 0x15, 0xFF, 0x1D, 0x0D, 0xCB,
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x04, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xAA, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xFC,
-  0x1D, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x1D, 0x0D, 0xFB, 0x1D, 0x0D, 0xFD,
-  0x3D, 0x0D, 0xFD, 0x5E, 0x0D, 0xEE, 0x1D, 0x0D, 0x5E, 0x00, 0x00, 0x00, 0xFF, 0x05, 0x04, 0x00, 0x00, 0x00,
-  0x1D, 0x0D, 0xB0, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xFE, 0x1D, 0x0D, 0xF7, 0x3D, 0x0D, 0x20, 0xFF, 0x07, 0x01,
-  0x5F, 0x05, 0x03, 0x00, 0x00, 0x00, 0xFE, 0x0C, 0x15, 0x1D, 0x0D, 0xF6, 0x7F, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF,
-  0x3E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFD, 0x3D, 0x0D, 0xFE, 0x1D, 0x0D, 0xF1, 0x1D, 0x0D, 0x19, 0x00, 0x00, 0x00,
-  0x1D, 0x0D, 0xC2, 0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x1D, 0x0D, 0xEE, 0xFC, 0x0C, 0x15, 0xFF, 0x07, 0x01,
-  0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x05, 0x03,
-  0xFF, 0x03, 0x02, 0x1D, 0x0D, 0x3C, 0x3E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFA, 0x7F, 0x0D, 0xFE, 0x1D, 0x0D, 0x90,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x05, 0x7B, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x2D, 0x1C, 0x3F, 0x35, 0x5D, 0xAA, 0x2D,
+  0x1C, 0x6F, 0x2D, 0x3D, 0x29, 0x80, 0x00, 0x00, 0x00, 0x01, 0x05, 0x5F, 0x03, 0xFF, 0xFF, 0x01, 0x83, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x87, 0x07, 0xFF, 0x01, 0x82, 0x00, 0x00, 0x00, 0x84, 0x07, 0xFF, 0x01,
+  0x00, 0x00, 0x1F, 0x01, 0x8B, 0x00, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x02, 0x05, 0x5F, 0x03, 0x80, 0x03, 0xF7,
+  0x04, 0x01, 0x05, 0x5F, 0x03, 0x07, 0xFF, 0x01, 0x8A, 0x00, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x02, 0x05, 0x5F,
+  0x03, 0x80, 0x03, 0xF7, 0x04, 0x01, 0x05, 0x5F, 0x03, 0x07, 0xFF, 0x01, 0xA5, 0x00, 0x00, 0x00, 0x0A, 0x55,
+  0x5F, 0x03, 0x00, 0x00, 0x00, 0x2D, 0x1C, 0x5F, 0x35, 0xBF, 0xFF, 0x2D, 0x3D, 0xFF, 0x2D, 0x3D, 0xEF, 0x2D,
+  0x3D, 0xAB, 0x2D, 0x1C, 0x37, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x01, 0x07, 0xFF, 0x01, 0x97, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x1F, 0x01, 0x05, 0x5F, 0x03, 0x03, 0xFF, 0x02, 0x86, 0x00, 0x00, 0x00, 0x01, 0x05, 0x5F, 0x03,
+  0x07, 0xFF, 0x01, 0x84, 0x00, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x02, 0x05, 0x55, 0x03, 0x86, 0x00, 0x00, 0x00,
+  0x01, 0x05, 0x5F, 0x03, 0x07, 0xFF, 0x01, 0x84, 0x00, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x02, 0x05, 0x55, 0x03,
+  0xA3, 0x00, 0x00, 0x00, 0x04, 0x55, 0x5F, 0x03, 0x00, 0x00, 0x00, 0x2D, 0x1C, 0x47, 0x2D, 0x5D, 0xE7, 0x2D,
+  0x3D, 0xFF, 0x80, 0x35, 0x7E, 0xFF, 0x04, 0x2D, 0x3D, 0xFB, 0x2D, 0x1C, 0x85, 0x07, 0xFF, 0x01, 0x00, 0x00,
+  0x00, 0x07, 0xFF, 0x01, 0x81, 0x00, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x02, 0x04, 0xFB, 0x08, 0x85, 0x05, 0xBF,
+  0x07, 0x01, 0x04, 0xFB, 0x08, 0x07, 0xFF, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0x07, 0xFF, 0x01, 0x04, 0xFB,
+  0x08, 0x83, 0x05, 0xBF, 0x07, 0x00, 0x06, 0x7F, 0x05, 0x81, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x02, 0x83,
+  0x00, 0x00, 0x00, 0x80, 0x07, 0xFF, 0x01, 0x80, 0x00, 0x00, 0x00, 0x05, 0x15, 0x1D, 0x1B, 0x0D, 0x3D, 0x3E,
+  0x0D, 0x1D, 0x53, 0x0D, 0x1D, 0x51, 0x0D, 0x3D, 0x3B, 0x0D, 0x3D, 0x17, 0x80, 0x00, 0x00, 0x00, 0x01, 0x03,
+  0xFF, 0x02, 0x00, 0x1F, 0x01, 0x82, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x01, 0x81, 0x00, 0x00, 0x00, 0x05,
+  0x15, 0x1D, 0x1E, 0x0D, 0x3D, 0x41, 0x0D, 0x1D, 0x54, 0x0D, 0x1D, 0x51, 0x0D, 0x1D, 0x3A, 0x0D, 0x5E, 0x15,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x02, 0x00, 0x1F, 0x01, 0x9F, 0x00, 0x00, 0x00, 0x0D, 0x07, 0xFF,
+  0x01, 0x55, 0x5F, 0x03, 0x3B, 0xF7, 0x04, 0x05, 0x55, 0x03, 0x05, 0x5F, 0x03, 0x2C, 0xFB, 0x18, 0x2D, 0x3C,
+  0x4C, 0x2D, 0x1D, 0xA8, 0x2D, 0x3D, 0xFD, 0x2D, 0x3D, 0xFF, 0x35, 0x7E, 0xFF, 0x2D, 0x1D, 0xA8, 0x34, 0xDF,
+  0x05, 0x03, 0xFF, 0x02, 0x80, 0x07, 0xFF, 0x01, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x3D, 0xA0, 0x0D, 0x5E, 0xE1,
+  0x0D, 0x1D, 0xDD, 0x83, 0x0D, 0x1D, 0xDF, 0x02, 0x0D, 0x1D, 0xDC, 0x0D, 0x7F, 0xE1, 0x0D, 0x3D, 0x81, 0x80,
+  0x00, 0x00, 0x00, 0x02, 0x0D, 0x1D, 0x8B, 0x0D, 0x7F, 0xE1, 0x0D, 0x1D, 0xDC, 0x82, 0x0D, 0x1D, 0xDF, 0x05,
+  0x0D, 0x1D, 0xDB, 0x0D, 0x3D, 0xC4, 0x0D, 0x3D, 0x90, 0x15, 0x1D, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x02,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x01, 0x80, 0x00, 0x00, 0x00, 0x03, 0x0D, 0x1D, 0x51, 0x0D, 0x3D,
+  0xB8, 0x0D, 0x3D, 0xF0, 0x0D, 0x3E, 0xFF, 0x80, 0x0D, 0x5E, 0xFF, 0x03, 0x0D, 0x3E, 0xFF, 0x0D, 0x3D, 0xEC,
+  0x0D, 0x3D, 0xAF, 0x0D, 0x3D, 0x44, 0x83, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0x02, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x0D, 0x3D, 0x5A, 0x0D, 0x3D, 0xBE, 0x0D, 0x3D, 0xF2, 0x0D, 0x3E, 0xFF, 0x80, 0x0D, 0x5E, 0xFF, 0x03,
+  0x0D, 0x3D, 0xFF, 0x0D, 0x3D, 0xEA, 0x0D, 0x3E, 0xAC, 0x0D, 0x3D, 0x41, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0x01, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x02, 0x86, 0x00, 0x00, 0x00, 0x0C, 0x2D, 0x1C, 0x47,
+  0x2D, 0x3D, 0xDE, 0x2D, 0x3D, 0xFF, 0x35, 0x7E, 0xFF, 0x2D, 0x1C, 0x9B, 0x00, 0x00, 0x00, 0x55, 0x5F, 0x03,
+  0x07, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xC9, 0x0D, 0x9F, 0xFF, 0x0D, 0x3D, 0xFF, 0x0D, 0x5E, 0xFF,
+  0x82, 0x0D, 0x3E, 0xFF, 0x02, 0x0D, 0x3D, 0xFF, 0x0D, 0x9F, 0xFF, 0x0D, 0x1D, 0xA4, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0x0D, 0x1D, 0xB0, 0x0D, 0x9F, 0xFF, 0x0D, 0x3D, 0xFF, 0x0D, 0x5E, 0xFF, 0x81, 0x0D, 0x3E, 0xFF, 0x0F,
+  0x0D, 0x3D, 0xFF, 0x0D, 0x5E, 0xFF, 0x0D, 0x7F, 0xFF, 0x0D, 0x5E, 0xF9, 0x0D, 0x1C, 0x6C, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x14, 0xDB, 0x0F, 0x0D, 0x3D, 0xAA,
+  0x0D, 0x7F, 0xFF, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0xFF, 0x0D, 0x1D, 0xFD, 0x80, 0x0D, 0x1D, 0xFF, 0x0F, 0x0D,
+  0x1D, 0xFC, 0x0D, 0x1D, 0xFF, 0x0D, 0x7F, 0xFF, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0x97, 0x05, 0xBF, 0x07, 0x07,
+  0xFF, 0x01, 0x00, 0x1F, 0x01, 0x07, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x0D, 0x1C, 0x16, 0x0D, 0x3D, 0xB5, 0x0D,
+  0x7F, 0xFF, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0xFE, 0x0D, 0x1D, 0xFD, 0x80, 0x0D, 0x1D, 0xFF, 0x05, 0x0D, 0x1D,
+  0xFC, 0x0D, 0x3D, 0xFF, 0x0D, 0x7F, 0xFF, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0x93, 0x03, 0xFF, 0x04, 0x80, 0x07,
+  0xFF, 0x01, 0x9B, 0x00, 0x00, 0x00, 0x08, 0x03, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x24, 0x9B, 0x07, 0x2D, 0x3D,
+  0x51, 0x2D, 0x1C, 0x94, 0x2D, 0x1C, 0xAC, 0x2D, 0x3C, 0x9B, 0x2D, 0x3C, 0x60, 0x24, 0xFB, 0x15, 0x80, 0x00,
+  0x00, 0x00, 0x0C, 0x24, 0xFB, 0x20, 0x2D, 0x3D, 0xD8, 0x2D, 0x3D, 0xFF, 0x35, 0x5E, 0xFF, 0x2D, 0x1C, 0x5C,
+  0x00, 0x00, 0x00, 0x3D, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xC0, 0x0D, 0x5E, 0xFD, 0x0D, 0x1D, 0xFA,
+  0x0D, 0x1D, 0xFE, 0x0D, 0x3E, 0xFF, 0x81, 0x0D, 0x5E, 0xFF, 0x02, 0x0D, 0x3D, 0xFF, 0x0D, 0x9F, 0xFF, 0x0D,
+  0x1D, 0x9E, 0x80, 0x00, 0x00, 0x00, 0x03, 0x0D, 0x1D, 0xA9, 0x0D, 0x7F, 0xFD, 0x0D, 0x1D, 0xFA, 0x0D, 0x1D,
+  0xFE, 0x80, 0x0D, 0x3E, 0xFF, 0x81, 0x0D, 0x5E, 0xFF, 0x21, 0x0D, 0x1D, 0xFA, 0x0D, 0x3D, 0xFF, 0x0D, 0x5E,
+  0xFF, 0x0D, 0x3D, 0x39, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x04, 0x03, 0xFF, 0x02, 0x1D, 0x5C, 0x09, 0x0D, 0x1D,
+  0xC0, 0x0D, 0x9F, 0xFF, 0x0D, 0x1D, 0xFB, 0x0D, 0x1D, 0xFC, 0x0D, 0x7F, 0xFF, 0x0D, 0x3E, 0xFF, 0x0D, 0x1D,
+  0xF3, 0x0D, 0x1D, 0xF4, 0x0D, 0x5E, 0xFF, 0x0D, 0x7E, 0xFF, 0x0D, 0x1D, 0xFB, 0x0D, 0x1D, 0xF8, 0x15, 0xDF,
+  0xFF, 0x0D, 0x1D, 0xAB, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x03, 0x03, 0xFF, 0x02, 0x0C, 0xFD, 0x10, 0x0D, 0x3D,
+  0xCE, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xFA, 0x0D, 0x1D, 0xFD, 0x0D, 0x7F, 0xFF, 0x0D, 0x3D, 0xFF, 0x0D, 0x1D,
+  0xF2, 0x0D, 0x1D, 0xF5, 0x80, 0x0D, 0x5E, 0xFF, 0x05, 0x0D, 0x1D, 0xFA, 0x0D, 0x1D, 0xFC, 0x0D, 0x9F, 0xFF,
+  0x0D, 0x1D, 0xA4, 0x00, 0x1F, 0x01, 0x03, 0xFF, 0x02, 0x9A, 0x00, 0x00, 0x00, 0x04, 0x03, 0xFF, 0x02, 0x00,
+  0x00, 0x00, 0x2C, 0xFC, 0x3D, 0x2D, 0x3D, 0xD1, 0x35, 0x5E, 0xFF, 0x82, 0x35, 0x7E, 0xFF, 0x01, 0x2D, 0x3D,
+  0xE1, 0x2D, 0x1C, 0x57, 0x80, 0x00, 0x00, 0x00, 0x26, 0x2D, 0x1C, 0x2E, 0x2D, 0x3D, 0xF1, 0x35, 0x5E, 0xFD,
+  0x2D, 0x1C, 0xDE, 0x35, 0x5B, 0x0F, 0x07, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xC2, 0x0D, 0x5E, 0xFF,
+  0x0D, 0x3D, 0xFE, 0x0D, 0x1D, 0xE8, 0x0D, 0x1D, 0x4D, 0x0D, 0x1D, 0x44, 0x0D, 0x3D, 0x45, 0x0D, 0x3D, 0x44,
+  0x0D, 0x1D, 0x44, 0x0D, 0x5E, 0x46, 0x0D, 0x3D, 0x22, 0x03, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xAA,
+  0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xFD, 0x0D, 0x1D, 0xF7, 0x0D, 0x1D, 0x5B, 0x0D, 0x1D, 0x43, 0x0D, 0x1D, 0x48,
+  0x0D, 0x1D, 0x5F, 0x0D, 0x1D, 0xC6, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0xF9, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0x9E,
+  0x00, 0x00, 0x00, 0x05, 0x5F, 0x06, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0x89, 0x0D, 0x9F, 0xFF, 0x0D, 0x1D, 0xF8,
+  0x80, 0x0D, 0x3D, 0xFF, 0x1E, 0x0D, 0x3D, 0x9B, 0x0D, 0x1D, 0x40, 0x0D, 0x1D, 0x1E, 0x0D, 0x1C, 0x21, 0x0D,
+  0x3D, 0x47, 0x0D, 0x1D, 0xA8, 0x0D, 0x5E, 0xFF, 0x0D, 0x7F, 0xFF, 0x0D, 0x3E, 0xD4, 0x0D, 0x1D, 0x4B, 0x07,
+  0xFF, 0x01, 0x03, 0xF7, 0x04, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0x9D, 0x0D, 0x9F, 0xFF, 0x0D, 0x1D, 0xF8, 0x0D,
+  0x3D, 0xFF, 0x0D, 0x3D, 0xFB, 0x0D, 0x3D, 0x92, 0x0D, 0x1D, 0x3C, 0x0D, 0x3D, 0x1D, 0x0D, 0x1D, 0x21, 0x0D,
+  0x3D, 0x49, 0x0D, 0x1D, 0xAD, 0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xFD, 0x0D, 0x1D, 0xF9, 0x0D, 0x9F, 0xFF, 0x0D,
+  0x1D, 0x67, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x03, 0x9A, 0x00, 0x00, 0x00, 0x03, 0x2D, 0x3C, 0x3E, 0x2D, 0x3D,
+  0xF6, 0x35, 0x5E, 0xFF, 0x2D, 0x1C, 0xFC, 0x82, 0x2D, 0x1C, 0xFB, 0x02, 0x2D, 0x3D, 0xFF, 0x35, 0x5E, 0xFF,
+  0x2D, 0x1C, 0x61, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x1C, 0x80, 0x80, 0x35, 0x5E, 0xFF, 0x00, 0x2D, 0x1C,
+  0x62, 0x80, 0x00, 0x00, 0x00, 0x03, 0x0D, 0x1D, 0xC2, 0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xFF, 0x0D, 0x1D, 0xDE,
+  0x85, 0x00, 0x00, 0x00, 0x06, 0x05, 0x5F, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xAA, 0x0D, 0x7F, 0xFF, 0x0D,
+  0x1D, 0xFE, 0x0D, 0x1D, 0xF3, 0x0D, 0x7E, 0x13, 0x81, 0x00, 0x00, 0x00, 0x0C, 0x0D, 0x3E, 0x14, 0x0D, 0x3D,
+  0xEB, 0x0D, 0x3D, 0xFE, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0xC9, 0x07, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x15, 0x3D,
+  0x1F, 0x0D, 0x3D, 0xF5, 0x0D, 0x3D, 0xFC, 0x0D, 0x1D, 0xFC, 0x0D, 0x3E, 0xFB, 0x0D, 0x1D, 0x59, 0x84, 0x00,
+  0x00, 0x00, 0x0B, 0x0D, 0x1D, 0x6A, 0x0D, 0x3E, 0x94, 0x14, 0x9B, 0x0E, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x03,
+  0x00, 0x00, 0x00, 0x15, 0x1D, 0x2C, 0x0D, 0x3D, 0xFC, 0x0D, 0x1D, 0xFC, 0x0D, 0x3D, 0xFD, 0x0D, 0x3E, 0xF6,
+  0x0D, 0x1D, 0x4B, 0x84, 0x00, 0x00, 0x00, 0x07, 0x0D, 0x3D, 0x76, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0xFB, 0x0D,
+  0x3E, 0xFE, 0x0D, 0x1D, 0xE3, 0x14, 0xFD, 0x0D, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x01, 0x98, 0x00, 0x00, 0x00,
+  0x05, 0x35, 0x5D, 0x0F, 0x2D, 0x1C, 0xDA, 0x35, 0x5E, 0xFF, 0x2D, 0x1C, 0xF9, 0x2D, 0x1C, 0xFD, 0x2D, 0x1C,
+  0xFF, 0x81, 0x2D, 0x1C, 0xFE, 0x08, 0x2D, 0x1C, 0xFB, 0x2D, 0x3D, 0xFD, 0x2D, 0x3D, 0xF3, 0x2D, 0x1C, 0x27,
+  0x07, 0xFF, 0x01, 0x2D, 0x3D, 0x1D, 0x2D, 0x1C, 0xEE, 0x35, 0x7E, 0xFE, 0x2D, 0x1C, 0xB0, 0x80, 0x00, 0x00,
+  0x00, 0x06, 0x0D, 0x1D, 0xC2, 0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xFF, 0x0D, 0x1D, 0xE1, 0x0D, 0x3E, 0x11, 0x05,
+  0x5A, 0x06, 0x05, 0xBB, 0x07, 0x80, 0x05, 0x5A, 0x06, 0x1E, 0x04, 0xDF, 0x05, 0x03, 0xEF, 0x02, 0x05, 0x5F,
+  0x03, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xAA, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xFE, 0x0D, 0x1D, 0xF4, 0x0D, 0x3D,
+  0x25, 0x05, 0x5F, 0x06, 0x04, 0xFF, 0x08, 0x05, 0xBF, 0x07, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xD0, 0x0D, 0x5E,
+  0xFF, 0x0D, 0x3E, 0xFF, 0x0D, 0x1D, 0xD2, 0x06, 0x7F, 0x05, 0x00, 0x00, 0x00, 0x0D, 0x3D, 0x6E, 0x0D, 0x7F,
+  0xFF, 0x0D, 0x1D, 0xF8, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0x94, 0x00, 0x00, 0x00, 0x04, 0xDF, 0x05, 0x05, 0x5F,
+  0x03, 0x03, 0xFF, 0x02, 0x05, 0xFF, 0x04, 0x05, 0x5A, 0x06, 0x04, 0xD9, 0x05, 0x81, 0x00, 0x00, 0x00, 0x16,
+  0x04, 0xDF, 0x05, 0x03, 0xF7, 0x04, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0x80, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xF8,
+  0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0x81, 0x00, 0x00, 0x00, 0x05, 0x5A, 0x06, 0x05, 0x55, 0x03, 0x03, 0xEF, 0x02,
+  0x03, 0xFF, 0x02, 0x05, 0x5F, 0x03, 0x03, 0xF7, 0x04, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xB4, 0x0D, 0x7E, 0xFF,
+  0x0D, 0x1D, 0xFA, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0x4D, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x03, 0x8A, 0x00, 0x00,
+  0x00, 0x80, 0xFF, 0xFF, 0x01, 0x8A, 0x00, 0x00, 0x00, 0x02, 0x2D, 0x1C, 0x6C, 0x35, 0x5E, 0xFF, 0x2D, 0x1C,
+  0xFC, 0x80, 0x2D, 0x5D, 0xFF, 0x83, 0x2D, 0x3D, 0xFF, 0x02, 0x2D, 0x1C, 0xFF, 0x35, 0x9F, 0xFF, 0x2D, 0x1C,
+  0x8E, 0x80, 0x00, 0x00, 0x00, 0x08, 0x2D, 0x1C, 0xB8, 0x35, 0x9F, 0xFF, 0x2D, 0x1C, 0xE1, 0x2D, 0x5D, 0x0C,
+  0x00, 0x00, 0x00, 0x0D, 0x1D, 0xC3, 0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xFF, 0x0D, 0x1D, 0xDF, 0x85, 0x00, 0x00,
+  0x00, 0x06, 0x05, 0x5F, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xAA, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xFE, 0x0D,
+  0x1D, 0xF3, 0x0D, 0x5E, 0x12, 0x81, 0x00, 0x00, 0x00, 0x0D, 0x0D, 0x1D, 0x27, 0x0D, 0x3D, 0xF2, 0x0D, 0x3D,
+  0xFD, 0x0D, 0x5E, 0xFE, 0x0D, 0x1D, 0xC4, 0x07, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xA5, 0x0D, 0x7F,
+  0xFE, 0x0D, 0x1D, 0xFB, 0x0D, 0x3D, 0xFC, 0x0D, 0x3D, 0x30, 0x03, 0xFF, 0x02, 0x05, 0x55, 0x03, 0x87, 0x00,
+  0x00, 0x00, 0x06, 0x03, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xB7, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0xFD,
+  0x0D, 0x3D, 0xF7, 0x0D, 0x1D, 0x21, 0x80, 0x03, 0xFF, 0x02, 0x82, 0x00, 0x00, 0x00, 0x08, 0x03, 0xF7, 0x04,
+  0x07, 0xFF, 0x01, 0x0D, 0x1D, 0x4E, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0xF8, 0x0D, 0x7F, 0xFE, 0x0D, 0x1D, 0x85,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0x04, 0x95, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x01, 0x00,
+  0x00, 0x00, 0x2D, 0x1C, 0xA5, 0x35, 0x5D, 0xFE, 0x2D, 0x3D, 0xFE, 0x2D, 0x1C, 0xD2, 0x2D, 0x1C, 0x4B, 0x2D,
+  0x1C, 0x3D, 0x2D, 0x1C, 0x3F, 0x81, 0x2D, 0x1C, 0x3E, 0x23, 0x2D, 0x1C, 0x3D, 0x2D, 0x1C, 0x40, 0x2D, 0x1D,
+  0x2F, 0x34, 0xDF, 0x05, 0x55, 0x5F, 0x03, 0x2D, 0x1C, 0x8B, 0x35, 0x9F, 0xFF, 0x2D, 0x1C, 0xEC, 0x2D, 0x1C,
+  0x1B, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xC3, 0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xFE, 0x0D, 0x1D, 0xE7, 0x0D, 0x3D,
+  0x44, 0x0D, 0x3D, 0x3B, 0x0D, 0x1D, 0x3D, 0x0D, 0x3D, 0x3B, 0x15, 0x3E, 0x3D, 0x0D, 0x1D, 0x26, 0x00, 0x00,
+  0x00, 0x03, 0xF7, 0x04, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xAA, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xFD, 0x0D, 0x1D,
+  0xF8, 0x0D, 0x1D, 0x6B, 0x0D, 0x1D, 0x54, 0x0D, 0x1D, 0x58, 0x0D, 0x1D, 0x76, 0x0D, 0x1D, 0xDD, 0x0D, 0x5E,
+  0xFF, 0x0D, 0x1D, 0xF9, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0x90, 0x80, 0x00, 0x00, 0x00, 0x18, 0x0D, 0x1D, 0xC0,
+  0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xFF, 0x0D, 0x1D, 0xE8, 0x0D, 0x3E, 0x11, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x01,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0x01, 0x0D, 0x1D, 0x31, 0x15, 0x3D, 0x3D, 0x0D, 0x3D, 0x3B, 0x0D, 0x1D, 0x3C,
+  0x0D, 0x3D, 0x3B, 0x0D, 0x1D, 0x3D, 0x0D, 0x3D, 0x33, 0x03, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xCF,
+  0x0D, 0x5E, 0xFF, 0x0D, 0x3E, 0xFF, 0x0D, 0x1D, 0xDB, 0x05, 0x5A, 0x06, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x01,
+  0x82, 0x00, 0x00, 0x00, 0x0E, 0x03, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0x26, 0x0D, 0x1D, 0xFB, 0x0D,
+  0x1D, 0xFD, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xA0, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x03, 0xFF, 0xFF, 0x01, 0xFF,
+  0xFF, 0x02, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01,
+  0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x0E, 0x00,
+  0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x02, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x01, 0x84, 0x00,
+  0x00, 0x00, 0x03, 0x2D, 0x1C, 0xAF, 0x2D, 0x3D, 0xFF, 0x35, 0x7E, 0xFF, 0x2D, 0x1C, 0x71, 0x89, 0x00, 0x00,
+  0x00, 0x08, 0x2D, 0x1C, 0x77, 0x35, 0x9F, 0xFF, 0x2D, 0x1C, 0xEE, 0x2D, 0x3D, 0x1D, 0x00, 0x00, 0x00, 0x0D,
+  0x1D, 0xC3, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0xFC, 0x0D, 0x1D, 0xFF, 0x82, 0x0D, 0x3D, 0xFF, 0x08, 0x0D, 0x7F,
+  0xFF, 0x0D, 0x1D, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xAA, 0x0D, 0x7F,
+  0xFF, 0x0D, 0x1D, 0xFC, 0x0D, 0x1D, 0xFF, 0x81, 0x0D, 0x5E, 0xFF, 0x05, 0x0D, 0x7F, 0xFF, 0x0D, 0x3E, 0xFF,
+  0x0D, 0x1D, 0xFD, 0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xFA, 0x0D, 0x3D, 0x2B, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x0D,
+  0x1D, 0xC3, 0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xFF, 0x0D, 0x1D, 0xE3, 0x15, 0x1F, 0x0E, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0x02, 0x00, 0x00, 0x00, 0x0D, 0x3E, 0x11, 0x0D, 0x1D, 0xEA, 0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xFF, 0x80,
+  0x0D, 0x3E, 0xFF, 0x0A, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0xF5, 0x0D, 0x3E, 0x14, 0x00, 0x00, 0x00, 0x0D, 0x1D,
+  0xD2, 0x0D, 0x5E, 0xFF, 0x0D, 0x3E, 0xFF, 0x0D, 0x1D, 0xD7, 0x05, 0x5F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0x01, 0x82, 0x00, 0x00, 0x00, 0x08, 0x03, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x0D, 0x3D, 0x22, 0x0D, 0x1D, 0xF9,
+  0x0D, 0x1D, 0xFE, 0x0D, 0x7F, 0xFF, 0x0D, 0x3D, 0xA3, 0x00, 0x00, 0x00, 0x03, 0x33, 0x05, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x01, 0x86, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x8A, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+  0x10, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x04, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x14, 0xFF, 0xFF, 0xB6, 0xFF, 0xFF, 0x46, 0x00, 0x00, 0x00, 0x2D, 0x1C, 0xA5, 0x35, 0x5D,
+  0xFE, 0x2D, 0x3D, 0xFE, 0x2D, 0x1C, 0xD5, 0x2D, 0x1C, 0x55, 0x2D, 0x1C, 0x46, 0x2D, 0x1C, 0x49, 0x83, 0x2D,
+  0x1C, 0x48, 0x0B, 0x2D, 0x1C, 0x47, 0x2D, 0x1C, 0x48, 0x2D, 0x3C, 0x41, 0x2D, 0x1C, 0xA8, 0x35, 0x7E, 0xFF,
+  0x2D, 0x1C, 0xED, 0x2D, 0x1C, 0x1B, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xC3, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0xFC,
+  0x0D, 0x3D, 0xFF, 0x82, 0x0D, 0x5E, 0xFF, 0x2A, 0x15, 0x9F, 0xFF, 0x0D, 0x1D, 0xCB, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0x04, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xAA, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xFC, 0x0D, 0x1D, 0xFF, 0x0D,
+  0x3E, 0xFF, 0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xFF, 0x0D, 0x1D, 0xFB, 0x0D, 0x1D, 0xFD, 0x0D, 0x3D, 0xFD, 0x0D,
+  0x5E, 0xEE, 0x0D, 0x1D, 0x5E, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xB0, 0x0D,
+  0x7F, 0xFF, 0x0D, 0x1D, 0xFE, 0x0D, 0x1D, 0xF7, 0x0D, 0x3D, 0x20, 0x07, 0xFF, 0x01, 0x05, 0x5F, 0x03, 0x00,
+  0x00, 0x00, 0x0C, 0xFE, 0x15, 0x0D, 0x1D, 0xF6, 0x0D, 0x7F, 0xFF, 0x0D, 0x5E, 0xFF, 0x0D, 0x3E, 0xFF, 0x0D,
+  0x1D, 0xFD, 0x0D, 0x3D, 0xFE, 0x0D, 0x1D, 0xF1, 0x0D, 0x1D, 0x19, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xC2, 0x0D,
+  0x5E, 0xFF, 0x0D, 0x3D, 0xFF, 0x0D, 0x1D, 0xEE, 0x0C, 0xFC, 0x15, 0x80, 0x07, 0xFF, 0x01, 0x82, 0x00, 0x00,
+  0x00, 0x06, 0x05, 0x5F, 0x03, 0x03, 0xFF, 0x02, 0x0D, 0x1D, 0x3C, 0x0D, 0x3E, 0xFF, 0x0D, 0x1D, 0xFA, 0x0D,
+  0x7F, 0xFE, 0x0D, 0x1D, 0x90, 0x81, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x1A,
   0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0C, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x06,
   0xFF, 0xFF, 0x11, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x56, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x0A,
   0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x1A, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01,
-  0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0xFF, 0xFF, 0x05, 0x1C, 0x2D, 0x69, 0x5E, 0x35, 0xFF,
-  0x1C, 0x2D, 0xFC, 0x3D, 0x2D, 0xFF, 0x5E, 0x35, 0xFF, 0x5D, 0x2D, 0xFF, 0x5D, 0x2D, 0xFF, 0x5D, 0x2D, 0xFF,
-  0x5D, 0x2D, 0xFF, 0x5D, 0x2D, 0xFF, 0x5D, 0x2D, 0xFF, 0x3D, 0x2D, 0xFF, 0x3D, 0x2D, 0xFF, 0x3D, 0x2D, 0xFF,
-  0x5D, 0x2D, 0xFF, 0x3D, 0x2D, 0xFF, 0x3D, 0x2D, 0xFF, 0x1C, 0x2D, 0xE3, 0xBA, 0x2C, 0x0C, 0x00, 0x00, 0x00,
-  0x1D, 0x0D, 0xC3, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFD, 0x1D, 0x0D, 0xF8, 0x1D, 0x0D, 0xC6, 0x1D, 0x0D, 0xC2,
-  0x1D, 0x0D, 0xC3, 0x1D, 0x0D, 0xC1, 0x5E, 0x0D, 0xC6, 0x1D, 0x0D, 0x8A, 0x00, 0x00, 0x00, 0xFF, 0x05, 0x04,
-  0x00, 0x00, 0x00, 0x1D, 0x0D, 0xAA, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xFC, 0x1D, 0x0D, 0xFD, 0x1D, 0x0D, 0xD7,
-  0x3D, 0x0D, 0xCD, 0x1D, 0x0D, 0xE6, 0x3D, 0x0D, 0xFF, 0x1D, 0x0D, 0xFB, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0x7A,
-  0x00, 0x00, 0x00, 0xFF, 0x05, 0x04, 0xFF, 0x03, 0x04, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x83, 0x7F, 0x0D, 0xFF,
-  0x1D, 0x0D, 0xF8, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0x64, 0x00, 0x00, 0x00, 0x9B, 0x04, 0x07, 0x00, 0x00, 0x00,
-  0x9F, 0x1D, 0x0A, 0x1D, 0x0D, 0xAB, 0x3D, 0x0D, 0xC6, 0x1D, 0x0D, 0xC1, 0x1D, 0x0D, 0xD9, 0x3D, 0x0D, 0xFE,
-  0x3D, 0x0D, 0xFF, 0x1D, 0x0D, 0xF1, 0x3D, 0x0D, 0x1A, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x97, 0x7F, 0x0D, 0xFE,
-  0x1D, 0x0D, 0xF8, 0x7E, 0x0D, 0xFF, 0x1D, 0x0D, 0x5A, 0x00, 0x00, 0x00, 0x5F, 0x05, 0x06, 0x1F, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x5A, 0x05, 0x06, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x8F,
-  0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xF8, 0x7F, 0x0D, 0xFF, 0xFC, 0x0C, 0x64, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x33,
-  0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xAD, 0xFF, 0xFF, 0xAB, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x6E, 0xFF, 0xFF, 0xE6, 0xFF, 0xFF, 0x05,
-  0xFF, 0xFF, 0x6C, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBC,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0x54, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAB, 0xFF, 0xFF, 0xFC,
-  0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0x7E, 0x1B, 0x25, 0x0E, 0x1C, 0x2D, 0xD7, 0x5E, 0x35, 0xFF, 0x1C, 0x2D, 0xF9,
-  0x1C, 0x2D, 0xFD, 0x1C, 0x2D, 0xFD, 0x1C, 0x2D, 0xFD, 0x1C, 0x2D, 0xFD, 0x1C, 0x2D, 0xFD, 0x1C, 0x2D, 0xFB,
-  0x1C, 0x2D, 0xFD, 0x5E, 0x35, 0xFF, 0x5D, 0x35, 0xFF, 0x5E, 0x35, 0xFF, 0x1C, 0x2D, 0xFF, 0x1C, 0x2D, 0xFB,
-  0x7E, 0x35, 0xFE, 0x1C, 0x2D, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xC2, 0x5E, 0x0D, 0xFF,
-  0x3D, 0x0D, 0xFF, 0x1D, 0x0D, 0xDF, 0xFF, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x05, 0x03, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xAA,
-  0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xFE, 0x1D, 0x0D, 0xF4, 0x3E, 0x0D, 0x22, 0x00, 0x00, 0x00, 0x3D, 0x0D, 0x2D,
-  0x3D, 0x0D, 0xF7, 0x3D, 0x0D, 0xFC, 0x3E, 0x0D, 0xFF, 0x1D, 0x0D, 0xD8, 0x1D, 0x15, 0x0E, 0xFF, 0x03, 0x02,
-  0xF7, 0x03, 0x04, 0x00, 0x00, 0x00, 0x1C, 0x0D, 0x37, 0x3E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFB, 0x3E, 0x0D, 0xFE,
-  0x3D, 0x0D, 0xDD, 0x3C, 0x0D, 0x14, 0x00, 0x00, 0x00, 0x5F, 0x05, 0x03, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x59, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xFF, 0x1D, 0x0D, 0xF0,
-  0xFD, 0x0C, 0x1A, 0x00, 0x00, 0x00, 0x3D, 0x0D, 0x49, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFA, 0x3E, 0x0D, 0xFE,
-  0x3D, 0x0D, 0xDD, 0x1D, 0x15, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0xFF, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x3A, 0x3E, 0x0D, 0xF5, 0x3D, 0x0D, 0xFD, 0x3D, 0x0D, 0xFD,
-  0x1D, 0x0D, 0xF5, 0x3D, 0x15, 0x1D, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xD9, 0xFF, 0xFF, 0xED, 0xFF, 0xFF, 0x53,
-  0xFF, 0xFF, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xC0,
-  0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x8A, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0xCE,
-  0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x14, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0x20,
-  0x00, 0x00, 0x00, 0xFC, 0x2C, 0x3B, 0x3D, 0x2D, 0xF3, 0x5E, 0x35, 0xFF, 0x1C, 0x2D, 0xFC, 0x1C, 0x2D, 0xFB,
-  0x1C, 0x2D, 0xFB, 0x1C, 0x2D, 0xFB, 0x1C, 0x2D, 0xFB, 0x5D, 0x35, 0xFF, 0x3D, 0x2D, 0xFF, 0x1C, 0x2D, 0x7A,
-  0x1C, 0x2D, 0x50, 0x1C, 0x2D, 0x49, 0x1C, 0x2D, 0xB7, 0x3D, 0x2D, 0xFE, 0x5E, 0x35, 0xFF, 0x1C, 0x2D, 0x60,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xC2, 0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x1D, 0x0D, 0xE1,
-  0xDD, 0x0C, 0x17, 0x1F, 0x15, 0x0B, 0x9D, 0x15, 0x0D, 0x5D, 0x15, 0x0C, 0x5D, 0x15, 0x0C, 0xFD, 0x14, 0x0D,
-  0xFF, 0x03, 0x02, 0x5F, 0x05, 0x03, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xAA, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xFE,
-  0x1D, 0x0D, 0xF4, 0x3D, 0x15, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x9A, 0x7F, 0x0D, 0xFF,
-  0x1D, 0x0D, 0xF9, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0x75, 0x00, 0x00, 0x00, 0xF7, 0x03, 0x04, 0xFF, 0x03, 0x02,
-  0x00, 0x00, 0x00, 0x1D, 0x0D, 0xB8, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xF9, 0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xCB,
-  0x1D, 0x0D, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0D, 0x3E,
-  0x3D, 0x0D, 0xD4, 0x3E, 0x0D, 0xFE, 0x1D, 0x0D, 0xFD, 0x1D, 0x0D, 0xF5, 0x1D, 0x0D, 0x19, 0x00, 0x00, 0x00,
-  0xD9, 0x04, 0x05, 0x1D, 0x0D, 0xC9, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xF9, 0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xD6,
-  0x3D, 0x0D, 0x49, 0xBF, 0x05, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x15, 0x0F, 0x3D, 0x0D, 0x63,
-  0x3D, 0x0D, 0xEE, 0x3E, 0x0D, 0xFF, 0x1D, 0x0D, 0xF9, 0x9F, 0x0D, 0xFF, 0x1C, 0x0D, 0x98, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x22, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xCA,
-  0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xB6, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x75,
-  0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x8A,
-  0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x45,
-  0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00,
-  0x1C, 0x2D, 0x39, 0x3D, 0x2D, 0xCB, 0x5E, 0x35, 0xFF, 0x7E, 0x35, 0xFF, 0x7E, 0x35, 0xFF, 0x7E, 0x35, 0xFF,
-  0x7E, 0x35, 0xFF, 0x3D, 0x2D, 0xDB, 0x1C, 0x2D, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x2D, 0x23,
-  0x3D, 0x2D, 0xE9, 0x5E, 0x35, 0xFE, 0x1C, 0x2D, 0xDC, 0x1B, 0x25, 0x0E, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00,
-  0x1D, 0x0D, 0xC2, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFC, 0x1D, 0x0D, 0xFB, 0x1D, 0x0D, 0xE3, 0x1D, 0x0D, 0xE2,
-  0x1D, 0x0D, 0xE2, 0x1D, 0x0D, 0xE2, 0x1D, 0x0D, 0xDF, 0x7F, 0x0D, 0xE4, 0x1D, 0x0D, 0x83, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1D, 0x0D, 0xAA, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xFE, 0x1D, 0x0D, 0xF4, 0x3D, 0x15, 0x1F,
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x3E, 0x0D, 0x22, 0x3D, 0x0D, 0xF5, 0x3D, 0x0D, 0xFC, 0x3E, 0x0D, 0xFD,
-  0x1D, 0x0D, 0xEA, 0x5C, 0x0D, 0x15, 0xFF, 0x07, 0x01, 0xFF, 0x03, 0x04, 0x1F, 0x00, 0x01, 0x3D, 0x0D, 0x25,
-  0x3D, 0x0D, 0xED, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xF8, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFB, 0x1D, 0x0D, 0xBD,
-  0x1D, 0x0D, 0x94, 0x1D, 0x0D, 0x96, 0x3D, 0x0D, 0xC2, 0x3D, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xF9,
-  0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xD9, 0x1C, 0x15, 0x0B, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x32,
-  0x3E, 0x0D, 0xF5, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xF9, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xD9,
-  0x1D, 0x0D, 0xB8, 0x1D, 0x0D, 0xBD, 0x1D, 0x0D, 0xE4, 0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x1D, 0x0D, 0xF9,
-  0x7F, 0x0D, 0xFF, 0x3D, 0x0D, 0xD9, 0xDC, 0x0C, 0x14, 0xEF, 0x03, 0x02, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF3,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x14, 0xFF, 0xFF, 0x34, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x14, 0xFF, 0xFF, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
-  0xFF, 0xFF, 0x86, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x57,
-  0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x26, 0xFF, 0xFF, 0x1A, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0xF7, 0x03, 0x04,
-  0x3D, 0x2D, 0x50, 0x1D, 0x2D, 0x8C, 0x3C, 0x2D, 0xA0, 0x1C, 0x2D, 0x93, 0x3D, 0x2D, 0x5E, 0xBA, 0x2C, 0x11,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x2D, 0x27, 0x3D, 0x2D, 0xDF, 0x5D, 0x2D, 0xFF, 0x5E, 0x35, 0xFF,
-  0x1C, 0x2D, 0x58, 0x00, 0x00, 0x00, 0xF7, 0x3D, 0x04, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xC2, 0x5E, 0x0D, 0xFD,
-  0x1D, 0x0D, 0xFA, 0x1D, 0x0D, 0xFE, 0x3D, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF, 0x3E, 0x0D, 0xFF,
-  0x3D, 0x0D, 0xFF, 0x9F, 0x0D, 0xFF, 0x1D, 0x0D, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xAA,
-  0x7E, 0x0D, 0xFD, 0x1D, 0x0D, 0xFC, 0x1D, 0x0D, 0xF3, 0xFD, 0x0C, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x05, 0x04,
-  0x00, 0x00, 0x00, 0x1D, 0x0D, 0x94, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xF7, 0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0x89,
-  0x00, 0x00, 0x00, 0x5F, 0x05, 0x03, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x3A, 0x3E, 0x0D, 0xE4,
-  0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xFF, 0x1D, 0x0D, 0xFD, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF,
-  0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFC, 0x1D, 0x0D, 0xFF, 0x9F, 0x0D, 0xFF, 0x3E, 0x0D, 0xDA, 0x3D, 0x0D, 0x2D,
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0xFC, 0x0C, 0x47, 0x3E, 0x0D, 0xEC,
-  0x7F, 0x0D, 0xFF, 0x1D, 0x0D, 0xFF, 0x1D, 0x0D, 0xFB, 0x3D, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF,
-  0x3D, 0x0D, 0xFF, 0x1D, 0x0D, 0xFA, 0x3D, 0x0D, 0xFF, 0x9F, 0x0D, 0xFF, 0x3E, 0x0D, 0xD3, 0xFC, 0x0C, 0x25,
-  0x00, 0x00, 0x00, 0xEF, 0x01, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
-  0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x93, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x85, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0E, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x87,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x2D, 0x4C,
-  0x3D, 0x2D, 0xE1, 0x3D, 0x2D, 0xFF, 0x7E, 0x35, 0xFF, 0x1C, 0x2D, 0x97, 0x00, 0x00, 0x00, 0x5F, 0x55, 0x03,
-  0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xC3, 0x9F, 0x15, 0xFF, 0x3E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF,
-  0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x3D, 0x0D, 0xFF, 0x9F, 0x0D, 0xFF,
-  0x1D, 0x0D, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0xAA, 0x9F, 0x15, 0xFF, 0x5E, 0x0D, 0xFF,
-  0x1D, 0x0D, 0xF9, 0xFD, 0x14, 0x1D, 0x00, 0x00, 0x00, 0xF7, 0x03, 0x04, 0xFF, 0x07, 0x01, 0x3D, 0x15, 0x1F,
-  0x3D, 0x0D, 0xF1, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x1D, 0x0D, 0xFC, 0x3E, 0x0D, 0x22, 0x00, 0x00, 0x00,
-  0xFF, 0x03, 0x02, 0xFF, 0x07, 0x02, 0x00, 0x00, 0x00, 0xDC, 0x0C, 0x1C, 0x3E, 0x0D, 0x9B, 0x3D, 0x0D, 0xF1,
-  0x7F, 0x0D, 0xFF, 0x7F, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x7F, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF,
-  0x3D, 0x0D, 0xED, 0x3D, 0x0D, 0x92, 0xFB, 0x0C, 0x15, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x55, 0x05, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x0D, 0x24, 0x3E, 0x0D, 0xA4, 0x3D, 0x0D, 0xF4,
-  0x7F, 0x0D, 0xFF, 0x7F, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF, 0x7F, 0x0D, 0xFF, 0x5E, 0x0D, 0xFF,
-  0x3D, 0x0D, 0xE9, 0x3E, 0x0D, 0x89, 0xDB, 0x14, 0x0F, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x63, 0xFF, 0xFF, 0x31, 0xFF, 0xFF, 0xCB,
-  0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x2E, 0xFF, 0xFF, 0x63, 0xFF, 0xFF, 0x3F,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x26, 0xFF, 0xFF, 0x48, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x8B,
-  0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x32, 0xFF, 0xFF, 0x60, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x16, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x5F, 0x55, 0x03, 0xF7, 0x3B, 0x04, 0x5F, 0x55, 0x03, 0xD9, 0x34, 0x05,
-  0x3C, 0x25, 0x1A, 0x3C, 0x2D, 0x4F, 0x1C, 0x2D, 0xB0, 0x1C, 0x2D, 0xFE, 0x5D, 0x2D, 0xFF, 0x7E, 0x35, 0xFF,
-  0x3C, 0x2D, 0xA3, 0xFF, 0x3B, 0x04, 0xFF, 0x03, 0x02, 0xFF, 0x07, 0x01, 0x1F, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x1E, 0x0D, 0x27, 0x3E, 0x0D, 0x40, 0x3D, 0x0D, 0x3D, 0x3D, 0x0D, 0x3E, 0x3D, 0x0D, 0x3E, 0x3D, 0x0D, 0x3E,
-  0x3D, 0x0D, 0x3E, 0x3D, 0x0D, 0x3E, 0x3D, 0x0D, 0x3D, 0x5E, 0x0D, 0x40, 0x3C, 0x15, 0x1F, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x5D, 0x0D, 0x21, 0x5E, 0x15, 0x3F, 0x3D, 0x0D, 0x3F, 0x3D, 0x0D, 0x36, 0x55, 0x05, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0C, 0x2A, 0x5E, 0x0D, 0x40,
-  0x1D, 0x0D, 0x3D, 0x3D, 0x0D, 0x40, 0x3C, 0x0D, 0x11, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xFF, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x15, 0x1E, 0x3D, 0x0D, 0x5C, 0x1D, 0x0D, 0x89,
-  0x1D, 0x0D, 0x9F, 0x1D, 0x0D, 0x9E, 0x3D, 0x0D, 0x86, 0x3D, 0x0D, 0x58, 0x3D, 0x0D, 0x1A, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x55, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0D, 0x23, 0x3D, 0x0D, 0x60, 0x1D, 0x0D, 0x8C,
-  0x3D, 0x0D, 0xA0, 0x3D, 0x0D, 0x9D, 0x3D, 0x0D, 0x84, 0x1D, 0x0D, 0x54, 0x1C, 0x0D, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0xFC, 0x2C, 0x22, 0x1C, 0x2D, 0xE2, 0x5D, 0x2D, 0xFF,
-  0x7E, 0x35, 0xFF, 0x7E, 0x35, 0xFF, 0x3D, 0x2D, 0xF8, 0x3D, 0x2D, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01,
-  0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01,
-  0x5F, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x05, 0x03, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02,
-  0xFF, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x05, 0x03, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x04,
-  0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x58, 0xFF, 0xFF, 0x52, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x02,
-  0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x05,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x3A, 0xFF, 0xFF, 0x69, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02,
-  0x00, 0x00, 0x00, 0x1C, 0x2D, 0x2B, 0x5D, 0x35, 0xFF, 0x5E, 0x35, 0xFF, 0x3D, 0x2D, 0xEC, 0x3D, 0x2D, 0xA6,
-  0x1C, 0x2D, 0x32, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x5F, 0x05, 0x03, 0x5F, 0x05, 0x03, 0x5F, 0x05, 0x03,
-  0x5F, 0x05, 0x03, 0x5F, 0x05, 0x03, 0x5F, 0x05, 0x03, 0x5F, 0x05, 0x03, 0x5F, 0x05, 0x03, 0x5F, 0x05, 0x03,
-  0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x03, 0x02, 0x5F, 0x05, 0x03, 0x5F, 0x05, 0x03,
-  0x55, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x03, 0x02, 0x5F, 0x05, 0x03, 0x5F, 0x05, 0x03, 0x5F, 0x05, 0x03, 0x1F, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x03, 0x02,
-  0x5F, 0x05, 0x03, 0xF7, 0x03, 0x04, 0x5F, 0x05, 0x03, 0x5F, 0x05, 0x03, 0xF7, 0x03, 0x04, 0x5F, 0x05, 0x03,
-  0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02,
-  0xF7, 0x03, 0x04, 0xF7, 0x03, 0x04, 0x5F, 0x05, 0x03, 0x5F, 0x05, 0x03, 0xF7, 0x03, 0x04, 0x5F, 0x05, 0x03,
-  0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x3D, 0x35, 0x1A,
-  0x1C, 0x2D, 0x95, 0x3D, 0x2D, 0x6F, 0x3D, 0x2D, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x05, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0xFF, 0xFF, 0x05, 0x2D, 0x1C, 0x69, 0x35, 0x5E, 0xFF,
+  0x2D, 0x1C, 0xFC, 0x2D, 0x3D, 0xFF, 0x35, 0x5E, 0xFF, 0x84, 0x2D, 0x5D, 0xFF, 0x81, 0x2D, 0x3D, 0xFF, 0x00,
+  0x2D, 0x5D, 0xFF, 0x80, 0x2D, 0x3D, 0xFF, 0x38, 0x2D, 0x1C, 0xE3, 0x2C, 0xBA, 0x0C, 0x00, 0x00, 0x00, 0x0D,
+  0x1D, 0xC3, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0xFD, 0x0D, 0x1D, 0xF8, 0x0D, 0x1D, 0xC6, 0x0D, 0x1D, 0xC2, 0x0D,
+  0x1D, 0xC3, 0x0D, 0x1D, 0xC1, 0x0D, 0x5E, 0xC6, 0x0D, 0x1D, 0x8A, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x04, 0x00,
+  0x00, 0x00, 0x0D, 0x1D, 0xAA, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xFC, 0x0D, 0x1D, 0xFD, 0x0D, 0x1D, 0xD7, 0x0D,
+  0x3D, 0xCD, 0x0D, 0x1D, 0xE6, 0x0D, 0x3D, 0xFF, 0x0D, 0x1D, 0xFB, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0x7A, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0x04, 0x03, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0x83, 0x0D, 0x7F, 0xFF, 0x0D,
+  0x1D, 0xF8, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0x64, 0x00, 0x00, 0x00, 0x04, 0x9B, 0x07, 0x00, 0x00, 0x00, 0x1D,
+  0x9F, 0x0A, 0x0D, 0x1D, 0xAB, 0x0D, 0x3D, 0xC6, 0x0D, 0x1D, 0xC1, 0x0D, 0x1D, 0xD9, 0x0D, 0x3D, 0xFE, 0x0D,
+  0x3D, 0xFF, 0x0D, 0x1D, 0xF1, 0x0D, 0x3D, 0x1A, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0x97, 0x0D, 0x7F, 0xFE, 0x0D,
+  0x1D, 0xF8, 0x0D, 0x7E, 0xFF, 0x0D, 0x1D, 0x5A, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x06, 0x00, 0x1F, 0x01, 0x80,
+  0x00, 0x00, 0x00, 0x27, 0x07, 0xFF, 0x01, 0x05, 0x5A, 0x06, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0x8F, 0x0D, 0x7F,
+  0xFF, 0x0D, 0x1D, 0xF8, 0x0D, 0x7F, 0xFF, 0x0C, 0xFC, 0x64, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x33, 0xFF, 0xFF,
+  0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xAD, 0xFF, 0xFF, 0xAB, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0xC6, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x6E, 0xFF, 0xFF, 0xE6, 0xFF, 0xFF, 0x05, 0xFF, 0xFF,
+  0x6C, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBC, 0xFF, 0xFF,
+  0xFE, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0x54, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAB, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xF4, 0xFF, 0xFF, 0x7E, 0x25, 0x1B, 0x0E, 0x2D, 0x1C, 0xD7, 0x35, 0x5E, 0xFF, 0x2D, 0x1C, 0xF9, 0x83, 0x2D,
+  0x1C, 0xFD, 0x08, 0x2D, 0x1C, 0xFB, 0x2D, 0x1C, 0xFD, 0x35, 0x5E, 0xFF, 0x35, 0x5D, 0xFF, 0x35, 0x5E, 0xFF,
+  0x2D, 0x1C, 0xFF, 0x2D, 0x1C, 0xFB, 0x35, 0x7E, 0xFE, 0x2D, 0x1C, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x04, 0x0D,
+  0x1D, 0xC2, 0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xFF, 0x0D, 0x1D, 0xDF, 0x03, 0xFF, 0x04, 0x84, 0x00, 0x00, 0x00,
+  0x28, 0x05, 0x5F, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xAA, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xFE, 0x0D, 0x1D,
+  0xF4, 0x0D, 0x3E, 0x22, 0x00, 0x00, 0x00, 0x0D, 0x3D, 0x2D, 0x0D, 0x3D, 0xF7, 0x0D, 0x3D, 0xFC, 0x0D, 0x3E,
+  0xFF, 0x0D, 0x1D, 0xD8, 0x15, 0x1D, 0x0E, 0x03, 0xFF, 0x02, 0x03, 0xF7, 0x04, 0x00, 0x00, 0x00, 0x0D, 0x1C,
+  0x37, 0x0D, 0x3E, 0xFF, 0x0D, 0x1D, 0xFB, 0x0D, 0x3E, 0xFE, 0x0D, 0x3D, 0xDD, 0x0D, 0x3C, 0x14, 0x00, 0x00,
+  0x00, 0x05, 0x5F, 0x03, 0x03, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x0D, 0x1D,
+  0x59, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xFF, 0x0D, 0x1D, 0xF0, 0x0C, 0xFD, 0x1A, 0x00, 0x00, 0x00, 0x0D, 0x3D,
+  0x49, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0xFA, 0x0D, 0x3E, 0xFE, 0x0D, 0x3D, 0xDD, 0x15, 0x1D, 0x19, 0x80, 0x00,
+  0x00, 0x00, 0x01, 0x03, 0xFF, 0x02, 0x07, 0xFF, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0x0D, 0x1D, 0x3A, 0x0D,
+  0x3E, 0xF5, 0x80, 0x0D, 0x3D, 0xFD, 0x22, 0x0D, 0x1D, 0xF5, 0x15, 0x3D, 0x1D, 0xFF, 0xFF, 0x04, 0xFF, 0xFF,
+  0xD9, 0xFF, 0xFF, 0xED, 0xFF, 0xFF, 0x53, 0xFF, 0xFF, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x07, 0xFF, 0xFF, 0x8A, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x9E, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0xCE, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x14, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x2C, 0xFC, 0x3B, 0x2D, 0x3D, 0xF3, 0x35, 0x5E,
+  0xFF, 0x2D, 0x1C, 0xFC, 0x82, 0x2D, 0x1C, 0xFB, 0x08, 0x35, 0x5D, 0xFF, 0x2D, 0x3D, 0xFF, 0x2D, 0x1C, 0x7A,
+  0x2D, 0x1C, 0x50, 0x2D, 0x1C, 0x49, 0x2D, 0x1C, 0xB7, 0x2D, 0x3D, 0xFE, 0x35, 0x5E, 0xFF, 0x2D, 0x1C, 0x60,
+  0x80, 0x00, 0x00, 0x00, 0x06, 0x0D, 0x1D, 0xC2, 0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xFF, 0x0D, 0x1D, 0xE1, 0x0C,
+  0xDD, 0x17, 0x15, 0x1F, 0x0B, 0x15, 0x9D, 0x0D, 0x80, 0x15, 0x5D, 0x0C, 0x08, 0x14, 0xFD, 0x0D, 0x03, 0xFF,
+  0x02, 0x05, 0x5F, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xAA, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xFE, 0x0D, 0x1D,
+  0xF4, 0x15, 0x3D, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x0E, 0x0D, 0x1D, 0x9A, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xF9,
+  0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0x75, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x04, 0x03, 0xFF, 0x02, 0x00, 0x00, 0x00,
+  0x0D, 0x1D, 0xB8, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xF9, 0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xCB, 0x0D, 0x1D, 0x32,
+  0x82, 0x00, 0x00, 0x00, 0x0E, 0x0D, 0x3D, 0x3E, 0x0D, 0x3D, 0xD4, 0x0D, 0x3E, 0xFE, 0x0D, 0x1D, 0xFD, 0x0D,
+  0x1D, 0xF5, 0x0D, 0x1D, 0x19, 0x00, 0x00, 0x00, 0x04, 0xD9, 0x05, 0x0D, 0x1D, 0xC9, 0x0D, 0x7F, 0xFF, 0x0D,
+  0x1D, 0xF9, 0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xD6, 0x0D, 0x3D, 0x49, 0x05, 0xBF, 0x07, 0x80, 0x00, 0x00, 0x00,
+  0x0A, 0x15, 0x5D, 0x0F, 0x0D, 0x3D, 0x63, 0x0D, 0x3D, 0xEE, 0x0D, 0x3E, 0xFF, 0x0D, 0x1D, 0xF9, 0x0D, 0x9F,
+  0xFF, 0x0D, 0x1C, 0x98, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x22, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x80, 0x00,
+  0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xCA, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xB6,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x75, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0xFD,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x8A, 0xFF, 0xFF, 0xF5, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x34, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x45, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0x02, 0x00, 0x00, 0x00, 0x2D, 0x1C, 0x39, 0x2D, 0x3D, 0xCB, 0x35, 0x5E, 0xFF, 0x82, 0x35, 0x7E, 0xFF,
+  0x01, 0x2D, 0x3D, 0xDB, 0x2D, 0x1C, 0x53, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x2D, 0x1C, 0x23, 0x2D, 0x3D, 0xE9,
+  0x35, 0x5E, 0xFE, 0x2D, 0x1C, 0xDC, 0x25, 0x1B, 0x0E, 0x07, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xC2,
+  0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0xFC, 0x0D, 0x1D, 0xFB, 0x0D, 0x1D, 0xE3, 0x81, 0x0D, 0x1D, 0xE2, 0x02, 0x0D,
+  0x1D, 0xDF, 0x0D, 0x7F, 0xE4, 0x0D, 0x1D, 0x83, 0x80, 0x00, 0x00, 0x00, 0x25, 0x0D, 0x1D, 0xAA, 0x0D, 0x7F,
+  0xFF, 0x0D, 0x1D, 0xFE, 0x0D, 0x1D, 0xF4, 0x15, 0x3D, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x01, 0x0D, 0x3E,
+  0x22, 0x0D, 0x3D, 0xF5, 0x0D, 0x3D, 0xFC, 0x0D, 0x3E, 0xFD, 0x0D, 0x1D, 0xEA, 0x0D, 0x5C, 0x15, 0x07, 0xFF,
+  0x01, 0x03, 0xFF, 0x04, 0x00, 0x1F, 0x01, 0x0D, 0x3D, 0x25, 0x0D, 0x3D, 0xED, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D,
+  0xF8, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0xFB, 0x0D, 0x1D, 0xBD, 0x0D, 0x1D, 0x94, 0x0D, 0x1D, 0x96, 0x0D, 0x3D,
+  0xC2, 0x0D, 0x3D, 0xFF, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D, 0xF9, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xD9, 0x15, 0x1C,
+  0x0B, 0x07, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0x32, 0x0D, 0x3E, 0xF5, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D,
+  0xF9, 0x80, 0x0D, 0x5E, 0xFF, 0x25, 0x0D, 0x1D, 0xD9, 0x0D, 0x1D, 0xB8, 0x0D, 0x1D, 0xBD, 0x0D, 0x1D, 0xE4,
+  0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xFF, 0x0D, 0x1D, 0xF9, 0x0D, 0x7F, 0xFF, 0x0D, 0x3D, 0xD9, 0x0C, 0xDC, 0x14,
+  0x03, 0xEF, 0x02, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x14, 0xFF, 0xFF, 0x34,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x14,
+  0xFF, 0xFF, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x86, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x57, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x26, 0xFF, 0xFF, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x08, 0x03,
+  0xFF, 0x02, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x04, 0x2D, 0x3D, 0x50, 0x2D, 0x1D, 0x8C, 0x2D, 0x3C, 0xA0, 0x2D,
+  0x1C, 0x93, 0x2D, 0x3D, 0x5E, 0x2C, 0xBA, 0x11, 0x80, 0x00, 0x00, 0x00, 0x0C, 0x2D, 0x1C, 0x27, 0x2D, 0x3D,
+  0xDF, 0x2D, 0x5D, 0xFF, 0x35, 0x5E, 0xFF, 0x2D, 0x1C, 0x58, 0x00, 0x00, 0x00, 0x3D, 0xF7, 0x04, 0x00, 0x00,
+  0x00, 0x0D, 0x1D, 0xC2, 0x0D, 0x5E, 0xFD, 0x0D, 0x1D, 0xFA, 0x0D, 0x1D, 0xFE, 0x0D, 0x3D, 0xFF, 0x81, 0x0D,
+  0x3E, 0xFF, 0x02, 0x0D, 0x3D, 0xFF, 0x0D, 0x9F, 0xFF, 0x0D, 0x1D, 0xA4, 0x80, 0x00, 0x00, 0x00, 0x15, 0x0D,
+  0x1D, 0xAA, 0x0D, 0x7E, 0xFD, 0x0D, 0x1D, 0xFC, 0x0D, 0x1D, 0xF3, 0x0C, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0x04, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0x94, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xF7, 0x0D, 0x7F, 0xFF, 0x0D,
+  0x1D, 0x89, 0x00, 0x00, 0x00, 0x05, 0x5F, 0x03, 0x03, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0x3A, 0x0D,
+  0x3E, 0xE4, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xFF, 0x0D, 0x1D, 0xFD, 0x82, 0x0D, 0x5E, 0xFF, 0x05, 0x0D, 0x1D,
+  0xFC, 0x0D, 0x1D, 0xFF, 0x0D, 0x9F, 0xFF, 0x0D, 0x3E, 0xDA, 0x0D, 0x3D, 0x2D, 0x00, 0x00, 0x00, 0x80, 0x03,
+  0xFF, 0x02, 0x06, 0x00, 0x00, 0x00, 0x0C, 0xFC, 0x47, 0x0D, 0x3E, 0xEC, 0x0D, 0x7F, 0xFF, 0x0D, 0x1D, 0xFF,
+  0x0D, 0x1D, 0xFB, 0x0D, 0x3D, 0xFF, 0x80, 0x0D, 0x5E, 0xFF, 0x23, 0x0D, 0x3D, 0xFF, 0x0D, 0x1D, 0xFA, 0x0D,
+  0x3D, 0xFF, 0x0D, 0x9F, 0xFF, 0x0D, 0x3E, 0xD3, 0x0C, 0xFC, 0x25, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x04, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFB, 0xFF,
+  0xFF, 0xBC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x93, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x85, 0xFF,
+  0xFF, 0xFD, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0x0E, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x87, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+  0x02, 0x86, 0x00, 0x00, 0x00, 0x0B, 0x2D, 0x3C, 0x4C, 0x2D, 0x3D, 0xE1, 0x2D, 0x3D, 0xFF, 0x35, 0x7E, 0xFF,
+  0x2D, 0x1C, 0x97, 0x00, 0x00, 0x00, 0x55, 0x5F, 0x03, 0x03, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xC3,
+  0x15, 0x9F, 0xFF, 0x0D, 0x3E, 0xFF, 0x83, 0x0D, 0x5E, 0xFF, 0x02, 0x0D, 0x3D, 0xFF, 0x0D, 0x9F, 0xFF, 0x0D,
+  0x1D, 0x9D, 0x80, 0x00, 0x00, 0x00, 0x09, 0x0D, 0x1D, 0xAA, 0x15, 0x9F, 0xFF, 0x0D, 0x5E, 0xFF, 0x0D, 0x1D,
+  0xF9, 0x14, 0xFD, 0x1D, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x04, 0x07, 0xFF, 0x01, 0x15, 0x3D, 0x1F, 0x0D, 0x3D,
+  0xF1, 0x80, 0x0D, 0x5E, 0xFF, 0x08, 0x0D, 0x1D, 0xFC, 0x0D, 0x3E, 0x22, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x02,
+  0x07, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x0C, 0xDC, 0x1C, 0x0D, 0x3E, 0x9B, 0x0D, 0x3D, 0xF1, 0x80, 0x0D, 0x7F,
+  0xFF, 0x80, 0x0D, 0x5E, 0xFF, 0x06, 0x0D, 0x7F, 0xFF, 0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xED, 0x0D, 0x3D, 0x92,
+  0x0C, 0xFB, 0x15, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x01, 0x80, 0x00, 0x00, 0x00, 0x04, 0x05, 0x55, 0x03, 0x00,
+  0x00, 0x00, 0x0D, 0x1C, 0x24, 0x0D, 0x3E, 0xA4, 0x0D, 0x3D, 0xF4, 0x80, 0x0D, 0x7F, 0xFF, 0x80, 0x0D, 0x5E,
+  0xFF, 0x0E, 0x0D, 0x7F, 0xFF, 0x0D, 0x5E, 0xFF, 0x0D, 0x3D, 0xE9, 0x0D, 0x3E, 0x89, 0x14, 0xDB, 0x0F, 0x00,
+  0x00, 0x00, 0x03, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x2C, 0xFF,
+  0xFF, 0x63, 0xFF, 0xFF, 0x31, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xC2, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+  0x2E, 0xFF, 0xFF, 0x63, 0xFF, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x26, 0xFF, 0xFF, 0x48,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x32, 0xFF, 0xFF, 0x60, 0xFF, 0xFF, 0x3D,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x16, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x43,
+  0x81, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1F, 0x01, 0x55, 0x5F, 0x03, 0x3B, 0xF7, 0x04, 0x55, 0x5F, 0x03, 0x34,
+  0xD9, 0x05, 0x25, 0x3C, 0x1A, 0x2D, 0x3C, 0x4F, 0x2D, 0x1C, 0xB0, 0x2D, 0x1C, 0xFE, 0x2D, 0x5D, 0xFF, 0x35,
+  0x7E, 0xFF, 0x2D, 0x3C, 0xA3, 0x3B, 0xFF, 0x04, 0x03, 0xFF, 0x02, 0x07, 0xFF, 0x01, 0x00, 0x1F, 0x01, 0x00,
+  0x00, 0x00, 0x0D, 0x1E, 0x27, 0x0D, 0x3E, 0x40, 0x0D, 0x3D, 0x3D, 0x83, 0x0D, 0x3D, 0x3E, 0x02, 0x0D, 0x3D,
+  0x3D, 0x0D, 0x5E, 0x40, 0x15, 0x3C, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x04, 0x0D, 0x5D, 0x21, 0x15, 0x5E, 0x3F,
+  0x0D, 0x3D, 0x3F, 0x0D, 0x3D, 0x36, 0x05, 0x55, 0x03, 0x82, 0x00, 0x00, 0x00, 0x08, 0x0C, 0xFC, 0x2A, 0x0D,
+  0x5E, 0x40, 0x0D, 0x1D, 0x3D, 0x0D, 0x3D, 0x40, 0x0D, 0x3C, 0x11, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x01, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0x02, 0x80, 0x00, 0x00, 0x00, 0x07, 0x15, 0x1D, 0x1E, 0x0D, 0x3D, 0x5C, 0x0D, 0x1D,
+  0x89, 0x0D, 0x1D, 0x9F, 0x0D, 0x1D, 0x9E, 0x0D, 0x3D, 0x86, 0x0D, 0x3D, 0x58, 0x0D, 0x3D, 0x1A, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0x02, 0x82, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x03, 0x80, 0x00, 0x00, 0x00,
+  0x07, 0x0D, 0x1D, 0x23, 0x0D, 0x3D, 0x60, 0x0D, 0x1D, 0x8C, 0x0D, 0x3D, 0xA0, 0x0D, 0x3D, 0x9D, 0x0D, 0x3D,
+  0x84, 0x0D, 0x1D, 0x54, 0x0D, 0x1C, 0x16, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x02, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x02, 0x81, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x04, 0x86, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x88, 0x00, 0x00, 0x00, 0x04, 0x03, 0xFF, 0x02, 0x00, 0x00,
+  0x00, 0x2C, 0xFC, 0x22, 0x2D, 0x1C, 0xE2, 0x2D, 0x5D, 0xFF, 0x80, 0x35, 0x7E, 0xFF, 0x04, 0x2D, 0x3D, 0xF8,
+  0x2D, 0x3D, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x01, 0x07, 0xFF, 0x01, 0x96, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0x01, 0x87, 0x00, 0x00, 0x00, 0x01, 0x07, 0xFF, 0x01, 0x05, 0x5F, 0x03, 0x86, 0x00, 0x00, 0x00, 0x01,
+  0x05, 0x5F, 0x03, 0x07, 0xFF, 0x01, 0x84, 0x00, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x02, 0x07, 0xFF, 0x02, 0x86,
+  0x00, 0x00, 0x00, 0x01, 0x05, 0x5F, 0x03, 0x07, 0xFF, 0x01, 0x83, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x02,
+  0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x58, 0xFF, 0xFF, 0x52, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01,
+  0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x02, 0xFF,
+  0xFF, 0x05, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x3A, 0xFF, 0xFF, 0x69, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x04, 0xFF,
+  0xFF, 0x03, 0x81, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x02, 0x83, 0x00,
+  0x00, 0x00, 0x08, 0x03, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x2D, 0x1C, 0x2B, 0x35, 0x5D, 0xFF, 0x35, 0x5E, 0xFF,
+  0x2D, 0x3D, 0xEC, 0x2D, 0x3D, 0xA6, 0x2D, 0x1C, 0x32, 0x00, 0x00, 0x00, 0x80, 0x07, 0xFF, 0x01, 0x82, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0x02, 0x87, 0x05, 0x5F, 0x03, 0x00, 0x07, 0xFF, 0x01, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xEF, 0x02, 0x80, 0x05, 0x5F, 0x03, 0x00, 0x05, 0x55, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0x02, 0x81, 0x05, 0x5F, 0x03, 0x00, 0x00, 0x1F, 0x01, 0x84, 0x00, 0x00, 0x00, 0x02, 0x03, 0xEF, 0x02,
+  0x05, 0x5F, 0x03, 0x03, 0xF7, 0x04, 0x80, 0x05, 0x5F, 0x03, 0x02, 0x03, 0xF7, 0x04, 0x05, 0x5F, 0x03, 0x07,
+  0xFF, 0x01, 0x88, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x02, 0x80, 0x03, 0xF7, 0x04, 0x80, 0x05, 0x5F, 0x03,
+  0x02, 0x03, 0xF7, 0x04, 0x05, 0x5F, 0x03, 0x07, 0xFF, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x05, 0x07, 0xFF, 0x01,
+  0x00, 0x00, 0x00, 0x35, 0x3D, 0x1A, 0x2D, 0x1C, 0x95, 0x2D, 0x3D, 0x6F, 0x2D, 0x3D, 0x25, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x5F, 0x03, 0xC9, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x03, 0x88, 0x00, 0x00, 0x00, 0x01,
+  0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x04, 0x87, 0x00, 0x00, 0x00,
 };
 
-const lv_img_dsc_t ergo_logo_img = {
-  {LV_IMG_CF_TRUE_COLOR_ALPHA, 0, 0, 112, 23},
-  7728,
-  ergo_logo_data,
+const CompressedImage ergo_logo = {
+  112, 23, LV_IMG_CF_TRUE_COLOR_ALPHA, 3,
+  ergo_logo_data, sizeof(ergo_logo_data),
 };
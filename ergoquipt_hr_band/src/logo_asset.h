@@ -1,5 +1,5 @@
 #pragma once
 
-#include <lvgl.h>
+#include "image_asset.h"
 
-extern const lv_img_dsc_t ergo_logo_img;
+extern const CompressedImage ergo_logo;
@@ -3,11 +3,21 @@
 
 #include "ble_manager.h"
 #include "config.h"
+#include "logger.h"
+#include "perf_monitor.h"
 #include "power_manager.h"
 #include "recording_manager.h"
 #include "rtc_manager.h"
 #include "sensor_manager.h"
+#include "trend_store.h"
+#include "ui_events.h"
 #include "ui_manager.h"
+#include "usb_link.h"
+#include "vitals_history.h"
+
+#if defined(ERGO_CODEC_BENCHMARK)
+#include <codec_benchmark.h>
+#endif
 
 SemaphoreHandle_t g_i2cMutex = nullptr;
 
@@ -19,6 +29,10 @@ UiManager g_uiManager;
 PowerManager g_powerManager;
 RtcManager g_rtcManager;
 RecordingManager g_recordingManager;
+UsbLink g_usbLink;
+VitalsHistory g_vitalsHistory;
+TrendStore g_trendStore;
+PerfMonitor g_perfMonitor;
 bool g_softSleep = false;
 
 void sensorTask(void *parameter) {
@@ -38,15 +52,53 @@ VitalData dataWithBatteryStatus(VitalData data) {
   return data;
 }
 
+// Runs the 1 Hz history tick and also wakes on sensor events (task
+// notifications) so beat-synchronous publishing goes out right away.
 void bleTask(void *parameter) {
+  auto *bleManager = static_cast<BleManager *>(parameter);
+  TickType_t nextTick = xTaskGetTickCount();
+
+  for (;;) {
+    const TickType_t now = xTaskGetTickCount();
+    const bool scheduled = static_cast<int32_t>(now - nextTick) >= 0;
+    if (scheduled) {
+      nextTick += pdMS_TO_TICKS(cfg::kBlePublishPeriodMs);
+      if (static_cast<int32_t>(now - nextTick) >= 0) {
+        nextTick = now + pdMS_TO_TICKS(cfg::kBlePublishPeriodMs);
+      }
+    }
+    if (!g_softSleep) {
+      const VitalData data = dataWithBatteryStatus(g_sensorManager.latest());
+      if (scheduled) {
+        g_vitalsHistory.append(data, g_powerManager.batteryPercent(),
+                               g_rtcManager.snapshot());
+        const uint16_t motionX1000 = static_cast<uint16_t>(constrain(
+            lroundf(g_sensorManager.diagnostics().motionScore * 1000.0f), 0L, 65535L));
+        g_trendStore.append(millis(), data, motionX1000);
+      }
+      bleManager->publishLatest(data, g_sensorManager.fingerPresent(), scheduled);
+      if (scheduled) {
+        uiPostEvent(UiEvent::Vitals);
+        g_vitalsHistory.spill();
+      }
+    }
+    const int32_t remaining = static_cast<int32_t>(nextTick - xTaskGetTickCount());
+    ulTaskNotifyTake(pdTRUE, remaining > 0 ? static_cast<TickType_t>(remaining) : 0);
+  }
+}
+
+void bleStreamTask(void *parameter) {
   auto *bleManager = static_cast<BleManager *>(parameter);
   TickType_t lastWake = xTaskGetTickCount();
 
   for (;;) {
     if (!g_softSleep) {
-      bleManager->publishLatest(dataWithBatteryStatus(g_sensorManager.latest()));
+      bleManager->pumpStream();
+      bleManager->pumpSync();
+      bleManager->pumpFiles();
+      bleManager->pumpConnection();
     }
-    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(cfg::kBlePublishPeriodMs));
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(cfg::kBleStreamPeriodMs));
   }
 }
 
@@ -62,11 +114,23 @@ void recordingTask(void *parameter) {
                                g_rtcManager.snapshot(),
                                g_sensorManager.filteringMode(),
                                g_sensorManager.diagnostics());
+      recordingManager->maintain();
     }
     vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(cfg::kRecordPeriodMs));
   }
 }
 
+// Console commands and, while a host captures, the binary sample stream.
+void usbTask(void *parameter) {
+  auto *usbLink = static_cast<UsbLink *>(parameter);
+  TickType_t lastWake = xTaskGetTickCount();
+
+  for (;;) {
+    usbLink->poll();
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(cfg::kUsbPumpPeriodMs));
+  }
+}
+
 void setSoftSleep(bool enabled) {
   if (g_softSleep == enabled) {
     return;
@@ -79,31 +143,51 @@ void setSoftSleep(bool enabled) {
   g_sensorManager.setEnabled(!enabled);
   g_bleManager.setEnabled(!enabled);
   g_uiManager.setDisplayOn(!enabled);
-  Serial.println(enabled ? "Power: entering soft sleep"
-                         : "Power: leaving soft sleep");
+  LOG_INFO(Power, "Power: %s soft sleep", enabled ? "entering" : "leaving");
 }
 
+// Buttons and battery; presses reach ui_task as UiEvent::Power.
+void powerTask(void *parameter) {
+  auto *powerManager = static_cast<PowerManager *>(parameter);
+  TickType_t lastWake = xTaskGetTickCount();
+
+  for (;;) {
+    powerManager->poll();
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(cfg::kPowerPollPeriodMs));
+  }
+}
+
+// Sleeps on the UI event queue until a subsystem posts a change, the touch
+// controller interrupts or LVGL has a timer due. With the display off only
+// events wake it, and a touch turns the display back on.
 void uiTask(void *parameter) {
   auto *uiManager = static_cast<UiManager *>(parameter);
-  TickType_t lastWake = xTaskGetTickCount();
 
   for (;;) {
-    g_powerManager.poll();
     g_rtcManager.poll();
     if (g_powerManager.takeShortPress()) {
-      Serial.println("Power: AXP short press");
+      LOG_INFO(Power, "Power: AXP short press");
       setSoftSleep(!g_softSleep);
     }
     if (g_powerManager.takeLongPress()) {
-      Serial.println("Power: AXP long press");
+      LOG_INFO(Power, "Power: AXP long press");
       setSoftSleep(!g_softSleep);
     }
     if (g_powerManager.takeBootPress()) {
-      Serial.println("BOOT: restarting ESP32");
+      LOG_INFO(System, "BOOT: restarting ESP32");
+      logFlush();
       Serial.flush();
       delay(100);
       ESP.restart();
     }
+    if (uiManager->takeWakeRequest()) {
+      LOG_INFO(Ui, "UI: touch wake");
+      if (g_softSleep) {
+        setSoftSleep(false);
+      } else {
+        uiManager->setDisplayOn(true);
+      }
+    }
     if (!g_softSleep && uiManager->takeRecordingToggleRequest()) {
       if (g_recordingManager.recording()) {
         g_recordingManager.stop();
@@ -115,54 +199,113 @@ void uiTask(void *parameter) {
     if (!g_softSleep && uiManager->takeFilteringModeRequest(requestedMode)) {
       g_sensorManager.setFilteringMode(requestedMode);
     }
-    uiManager->tick(dataWithBatteryStatus(g_sensorManager.latest()), g_bleManager.isConnected(),
-                    g_powerManager.batteryPercent(), g_rtcManager.snapshot(),
-                    g_bleManager.deviceName(), g_recordingManager.snapshot(),
-                    g_sensorManager.filteringMode());
-    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(cfg::kUiTaskPeriodMs));
+    const uint32_t idleMs = uiManager->tick(
+        dataWithBatteryStatus(g_sensorManager.latest()), g_bleManager.isConnected(),
+        g_powerManager.batteryPercent(), g_rtcManager.snapshot(), g_bleManager.deviceName(),
+        g_bleManager.streamStats(), g_recordingManager.snapshot(),
+        g_sensorManager.filteringMode());
+    UiEvent event;
+    if (uiWaitEvent(event, idleMs)) {
+      do {
+        uiManager->handleEvent(event);
+      } while (uiWaitEvent(event, 0));
+    }
   }
 }
 
+#if defined(ERGO_CODEC_BENCHMARK)
+uint32_t benchmarkMicros() { return micros(); }
+
+void runCodecBenchmark() {
+  const ergo::CodecBenchmarkResult result =
+      ergo::runCodecBenchmark(200, cfg::kRawBlockFrames, benchmarkMicros);
+  LOG_INFO(System, "Codec bench: frames=%lu raw=%luB encoded=%luB ratio=%.2f",
+           static_cast<unsigned long>(result.frames),
+           static_cast<unsigned long>(result.rawBytes),
+           static_cast<unsigned long>(result.encodedBytes),
+           static_cast<double>(result.ratio()));
+  LOG_INFO(System, "Codec bench: encode=%.2fMB/s decode=%.2fMB/s worst_block=%luus %s",
+           static_cast<double>(result.encodeMbPerSecond()),
+           static_cast<double>(result.decodeMbPerSecond()),
+           static_cast<unsigned long>(result.worstBlockEncodeUs),
+           result.roundTripOk ? "round-trip ok" : "ROUND-TRIP FAILED");
+}
+#endif
+
 }  // namespace
 
 void setup() {
+  // Room for a few capture pumps while the host is slow to read.
+  Serial.setTxBufferSize(cfg::kUsbTxBufferBytes);
   Serial.begin(115200);
-  Serial.setDebugOutput(true);
+  // Core debug output would write to USB CDC synchronously from any task.
+  Serial.setDebugOutput(false);
   while (!Serial && millis() < 4000U) {
   }
-  Serial.println();
-  Serial.println("Boot: ergoquipt_hr_band");
+  logBegin();
+  uiEventsBegin();
+  LOG_INFO(System, "Boot: ergoquipt_hr_band");
 
   g_i2cMutex = xSemaphoreCreateMutex();
   if (g_i2cMutex == nullptr) {
-    Serial.println("FATAL: failed to create I2C mutex");
+    LOG_ERROR(System, "FATAL: failed to create I2C mutex");
     return;
   }
 
   if (psramFound()) {
-    Serial.printf("PSRAM detected: %u bytes\n", ESP.getPsramSize());
+    LOG_INFO(System, "PSRAM detected: %lu bytes",
+             static_cast<unsigned long>(ESP.getPsramSize()));
   } else {
-    Serial.println("PSRAM not detected, using internal RAM");
+    LOG_WARN(System, "PSRAM not detected, using internal RAM");
   }
 
   g_sensorManager.begin();
   g_powerManager.begin();
   g_recordingManager.begin();
+  g_recordingManager.setRawSampleSource(&g_sensorManager.rawSamples());
   g_rtcManager.begin();
   g_bleManager.begin();
+  g_bleManager.setRawSampleSource(&g_sensorManager.rawSamples());
+  g_bleManager.setBeatSource(&g_sensorManager.beats());
+  g_vitalsHistory.begin(g_recordingManager.sdReady());
+  g_trendStore.begin();
+  g_bleManager.setHistory(&g_vitalsHistory);
+  g_bleManager.setRecordings(&g_recordingManager);
   g_uiManager.begin();
+  g_uiManager.setWaveformSource(&g_sensorManager.waveform());
+  g_uiManager.setTrendStore(&g_trendStore);
+  g_uiManager.setPerfMonitor(&g_perfMonitor);
+  g_usbLink.setSensor(&g_sensorManager);
+  g_usbLink.setRtc(&g_rtcManager);
+  g_usbLink.setPerfMonitor(&g_perfMonitor);
+  g_usbLink.begin(g_bleManager.deviceName());
 
-  Serial.print("BLE device name: ");
-  Serial.println(g_bleManager.deviceName());
+  LOG_INFO(Ble, "BLE device name: %s", g_bleManager.deviceName());
 
+#if defined(ERGO_CODEC_BENCHMARK)
+  runCodecBenchmark();
+#endif
+
+  TaskHandle_t handles[7] = {};
   xTaskCreatePinnedToCore(sensorTask, "sensor_task", 8192, &g_sensorManager, 3,
-                          nullptr, APP_CPU_NUM);
-  xTaskCreatePinnedToCore(bleTask, "ble_task", 6144, &g_bleManager, 2, nullptr,
+                          &handles[0], APP_CPU_NUM);
+  xTaskCreatePinnedToCore(bleTask, "ble_task", 6144, &g_bleManager, 2, &handles[1],
                           APP_CPU_NUM);
+  g_sensorManager.setEventTask(handles[1]);
+  xTaskCreatePinnedToCore(bleStreamTask, "ble_stream_task", 4096, &g_bleManager, 2,
+                          &handles[2], APP_CPU_NUM);
   xTaskCreatePinnedToCore(recordingTask, "recording_task", 8192,
-                          &g_recordingManager, 1, nullptr, APP_CPU_NUM);
-  xTaskCreatePinnedToCore(uiTask, "ui_task", 12288, &g_uiManager, 2, nullptr,
+                          &g_recordingManager, 1, &handles[3], APP_CPU_NUM);
+  xTaskCreatePinnedToCore(powerTask, "power_task", 4096, &g_powerManager, 1, &handles[4],
+                          APP_CPU_NUM);
+  xTaskCreatePinnedToCore(uiTask, "ui_task", 12288, &g_uiManager, 2, &handles[5],
                           PRO_CPU_NUM);
+  xTaskCreatePinnedToCore(usbTask, "usb_task", 4096, &g_usbLink, 2, &handles[6],
+                          PRO_CPU_NUM);
+  for (TaskHandle_t handle : handles) {
+    g_perfMonitor.addTask(handle);
+  }
+  g_perfMonitor.addTask(xTaskGetHandle("log_task"));
 }
 
 void loop() {
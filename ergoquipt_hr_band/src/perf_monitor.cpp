@@ -0,0 +1,47 @@
+#include "perf_monitor.h"
+
+#include <esp_heap_caps.h>
+
+#include <cstring>
+
+void PerfMonitor::addTask(TaskHandle_t task) {
+  if (task == nullptr) {
+    return;
+  }
+  portENTER_CRITICAL(&mux_);
+  if (taskCount_ < cfg::kPerfMaxTasks) {
+    tasks_[taskCount_++] = task;
+  }
+  portEXIT_CRITICAL(&mux_);
+}
+
+void PerfMonitor::publishUi(const UiPerfStats &stats) {
+  portENTER_CRITICAL(&mux_);
+  ui_ = stats;
+  portEXIT_CRITICAL(&mux_);
+}
+
+PerfSnapshot PerfMonitor::snapshot() const {
+  PerfSnapshot snapshot;
+  snapshot.timestampMs = millis();
+  portENTER_CRITICAL(const_cast<portMUX_TYPE *>(&mux_));
+  snapshot.ui = ui_;
+  TaskHandle_t tasks[cfg::kPerfMaxTasks];
+  const uint8_t taskCount = taskCount_;
+  memcpy(tasks, tasks_, sizeof(tasks));
+  portEXIT_CRITICAL(const_cast<portMUX_TYPE *>(&mux_));
+
+  snapshot.internalFreeBytes = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+  snapshot.internalMinFreeBytes = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+  snapshot.internalLargestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+  snapshot.psramFreeBytes = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+
+  // ESP-IDF counts stack in bytes.
+  snapshot.taskCount = taskCount;
+  for (uint8_t i = 0; i < taskCount; ++i) {
+    TaskStackStat &task = snapshot.tasks[i];
+    strncpy(task.name, pcTaskGetName(tasks[i]), sizeof(task.name) - 1U);
+    task.minFreeBytes = uxTaskGetStackHighWaterMark(tasks[i]);
+  }
+  return snapshot;
+}
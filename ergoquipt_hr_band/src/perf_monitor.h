@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "config.h"
+
+// UI counters over one cfg::kPerfPeriodMs window, published by ui_task.
+struct UiPerfStats {
+  uint32_t periodMs = 0;
+  // lv_timer_handler passes that redrew something.
+  uint32_t frames = 0;
+  uint32_t renderUsAvg = 0;
+  uint32_t renderUsMax = 0;
+  // Flush start to DMA transfer complete.
+  uint32_t flushUsAvg = 0;
+  uint32_t flushUsMax = 0;
+  // ui_task passes longer than cfg::kUiFrameBudgetMs.
+  uint32_t missedDeadlines = 0;
+  // LVGL's own heap (lv_mem_monitor).
+  uint32_t lvglUsedBytes = 0;
+  uint32_t lvglMaxUsedBytes = 0;
+  uint32_t lvglTotalBytes = 0;
+  uint8_t lvglFragPct = 0;
+};
+
+struct TaskStackStat {
+  char name[cfg::kPerfTaskNameBytes] = "";
+  // Least free stack the task has had since it started.
+  uint32_t minFreeBytes = 0;
+};
+
+struct PerfSnapshot {
+  uint32_t timestampMs = 0;
+  UiPerfStats ui;
+  uint32_t internalFreeBytes = 0;
+  uint32_t internalMinFreeBytes = 0;
+  uint32_t internalLargestBlock = 0;
+  uint32_t psramFreeBytes = 0;
+  uint8_t taskCount = 0;
+  TaskStackStat tasks[cfg::kPerfMaxTasks];
+};
+
+// Frame time, memory and stack headroom in one place for the device page's
+// perf overlay and the USB Perf frame. The UI half is pushed by ui_task once
+// per window (only it may call into LVGL); heap and stacks are read when a
+// snapshot is taken, from any task.
+class PerfMonitor {
+ public:
+  // Registers a task whose stack high-water mark snapshots carry.
+  void addTask(TaskHandle_t task);
+  void publishUi(const UiPerfStats &stats);
+  PerfSnapshot snapshot() const;
+
+ private:
+  portMUX_TYPE mux_ = portMUX_INITIALIZER_UNLOCKED;
+  UiPerfStats ui_;
+  TaskHandle_t tasks_[cfg::kPerfMaxTasks] = {};
+  uint8_t taskCount_ = 0;
+};
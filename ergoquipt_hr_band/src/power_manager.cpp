@@ -2,6 +2,9 @@
 
 #include <Wire.h>
 
+#include "logger.h"
+#include "ui_events.h"
+
 namespace {
 
 constexpr uint8_t kTcaInputReg = 0x00;
@@ -18,9 +21,9 @@ void PowerManager::begin() {
   pmuReady_ = initPmu();
   updateBattery(millis());
 
-  Serial.printf("Power: AXP2101=%s TCA9554=0x%02X %s battery=%u%%\n",
-                pmuReady_ ? "ok" : "missing", cfg::kTca9554Address,
-                expanderReady_ ? "ok" : "missing", batteryPercent_);
+  LOG_INFO(Power, "Power: AXP2101=%s TCA9554=0x%02X %s battery=%u%%",
+                  pmuReady_ ? "ok" : "missing", cfg::kTca9554Address,
+                  expanderReady_ ? "ok" : "missing", batteryPercent_);
 }
 
 bool PowerManager::initExpander() {
@@ -99,16 +102,18 @@ void PowerManager::pollPmuIrq() {
     xSemaphoreTake(g_i2cMutex, portMAX_DELAY);
   }
   power_.getIrqStatus();
-  if (power_.isPekeyShortPressIrq()) {
-    shortPressPending_ = true;
-  }
-  if (power_.isPekeyLongPressIrq()) {
-    longPressPending_ = true;
-  }
+  const bool shortPress = power_.isPekeyShortPressIrq();
+  const bool longPress = power_.isPekeyLongPressIrq();
   power_.clearIrqStatus();
   if (g_i2cMutex != nullptr) {
     xSemaphoreGive(g_i2cMutex);
   }
+  if (shortPress) {
+    setPending(shortPressPending_);
+  }
+  if (longPress) {
+    setPending(longPressPending_);
+  }
 }
 
 void PowerManager::pollBootButton(uint32_t nowMs) {
@@ -117,7 +122,7 @@ void PowerManager::pollBootButton(uint32_t nowMs) {
     lastBootEdgeMs_ = nowMs;
     bootWasPressed_ = pressed;
     if (!pressed) {
-      bootPressPending_ = true;
+      setPending(bootPressPending_);
     }
   }
 }
@@ -141,14 +146,14 @@ void PowerManager::pollExpanderPowerButton(uint32_t nowMs) {
       expanderPressStartMs_ = nowMs;
       expanderLongReported_ = false;
     } else if (!expanderLongReported_) {
-      shortPressPending_ = true;
+      setPending(shortPressPending_);
     }
   }
 
   if (pressed && !expanderLongReported_ &&
       (nowMs - expanderPressStartMs_) >= cfg::kSoftSleepLongPressMs) {
     expanderLongReported_ = true;
-    longPressPending_ = true;
+    setPending(longPressPending_);
   }
 }
 
@@ -158,6 +163,7 @@ void PowerManager::updateBattery(uint32_t nowMs) {
     return;
   }
 
+  const uint8_t previous = batteryPercent_;
   if (g_i2cMutex != nullptr) {
     xSemaphoreTake(g_i2cMutex, portMAX_DELAY);
   }
@@ -167,27 +173,33 @@ void PowerManager::updateBattery(uint32_t nowMs) {
   if (g_i2cMutex != nullptr) {
     xSemaphoreGive(g_i2cMutex);
   }
+  if (batteryPercent_ != previous) {
+    uiPostEvent(UiEvent::Power);
+  }
 }
 
 uint8_t PowerManager::batteryPercent() const { return batteryPercent_; }
 
 bool PowerManager::available() const { return pmuReady_; }
 
-bool PowerManager::takeShortPress() {
-  const bool pending = shortPressPending_;
-  shortPressPending_ = false;
-  return pending;
-}
+bool PowerManager::takeShortPress() { return takePending(shortPressPending_); }
 
-bool PowerManager::takeLongPress() {
-  const bool pending = longPressPending_;
-  longPressPending_ = false;
-  return pending;
+bool PowerManager::takeLongPress() { return takePending(longPressPending_); }
+
+bool PowerManager::takeBootPress() { return takePending(bootPressPending_); }
+
+void PowerManager::setPending(bool &flag) {
+  portENTER_CRITICAL(&pressMux_);
+  flag = true;
+  portEXIT_CRITICAL(&pressMux_);
+  uiPostEvent(UiEvent::Power);
 }
 
-bool PowerManager::takeBootPress() {
-  const bool pending = bootPressPending_;
-  bootPressPending_ = false;
+bool PowerManager::takePending(bool &flag) {
+  portENTER_CRITICAL(&pressMux_);
+  const bool pending = flag;
+  flag = false;
+  portEXIT_CRITICAL(&pressMux_);
   return pending;
 }
 
@@ -28,6 +28,9 @@ class PowerManager {
   void pollPmuIrq();
   void pollBootButton(uint32_t nowMs);
   void pollExpanderPowerButton(uint32_t nowMs);
+  // Presses are detected in power_task and taken by ui_task.
+  void setPending(bool &flag);
+  bool takePending(bool &flag);
 
   XPowersPMU power_;
   uint8_t expanderConfig_ = 0xFF;
@@ -42,6 +45,7 @@ class PowerManager {
   bool bootWasPressed_ = false;
   bool expanderPowerWasPressed_ = false;
   bool expanderLongReported_ = false;
+  portMUX_TYPE pressMux_ = portMUX_INITIALIZER_UNLOCKED;
   bool shortPressPending_ = false;
   bool longPressPending_ = false;
   bool bootPressPending_ = false;
@@ -0,0 +1,114 @@
+#include "record_file.h"
+
+#include <stdarg.h>
+#include <unistd.h>
+
+#include <SD_MMC.h>
+
+#include "config.h"
+#include "logger.h"
+
+namespace {
+
+constexpr size_t kZeroChunkBytes = 512;
+constexpr size_t kLineBufferBytes = 384;
+
+const uint8_t kZeros[kZeroChunkBytes] = {0};
+
+}  // namespace
+
+bool RecordFile::open(const char *path, uint32_t initialBytes) {
+  close();
+  size_ = 0;
+  allocated_ = 0;
+  file_ = SD_MMC.open(path, FILE_WRITE);
+  if (!file_) {
+    return false;
+  }
+  strncpy(path_, path, sizeof(path_) - 1U);
+  path_[sizeof(path_) - 1U] = '\0';
+  fillZeros(initialBytes);
+  return true;
+}
+
+void RecordFile::close() {
+  if (!file_) {
+    return;
+  }
+  file_.flush();
+  file_.close();
+  if (allocated_ > size_ && !truncateTo(path_, size_)) {
+    LOG_WARN(Recorder, "Recorder: trim %s failed", path_);
+  }
+  allocated_ = 0;
+}
+
+bool RecordFile::truncateTo(const char *path, uint32_t size) {
+  char fullPath[56];
+  snprintf(fullPath, sizeof(fullPath), "%s%s", cfg::kSdMountPoint, path);
+  return truncate(fullPath, static_cast<off_t>(size)) == 0;
+}
+
+size_t RecordFile::write(const uint8_t *data, size_t size) {
+  if (!file_) {
+    return 0;
+  }
+  const size_t written = file_.write(data, size);
+  size_ += static_cast<uint32_t>(written);
+  if (size_ > allocated_) {
+    allocated_ = size_;
+  }
+  return written;
+}
+
+size_t RecordFile::print(const char *text) {
+  return write(reinterpret_cast<const uint8_t *>(text), strlen(text));
+}
+
+size_t RecordFile::printf(const char *format, ...) {
+  char line[kLineBufferBytes];
+  va_list args;
+  va_start(args, format);
+  const int length = vsnprintf(line, sizeof(line), format, args);
+  va_end(args);
+  if (length <= 0) {
+    return 0;
+  }
+  const size_t size = static_cast<size_t>(length) < sizeof(line)
+                          ? static_cast<size_t>(length)
+                          : sizeof(line) - 1U;
+  return write(reinterpret_cast<const uint8_t *>(line), size);
+}
+
+void RecordFile::flush() {
+  if (file_) {
+    file_.flush();
+  }
+}
+
+uint32_t RecordFile::prefill(uint32_t aheadBytes, uint32_t budgetBytes) {
+  if (!file_ || allocated_ - size_ >= aheadBytes) {
+    return 0;
+  }
+  const uint32_t startUs = micros();
+  const uint32_t missing = aheadBytes - (allocated_ - size_);
+  fillZeros(missing < budgetBytes ? missing : budgetBytes);
+  return micros() - startUs;
+}
+
+bool RecordFile::fillZeros(uint32_t bytes) {
+  if (bytes == 0U || !file_.seek(allocated_)) {
+    return false;
+  }
+  uint32_t remaining = bytes;
+  while (remaining > 0U) {
+    const size_t chunk = remaining < kZeroChunkBytes ? remaining : kZeroChunkBytes;
+    const size_t written = file_.write(kZeros, chunk);
+    allocated_ += static_cast<uint32_t>(written);
+    if (written != chunk) {
+      break;
+    }
+    remaining -= static_cast<uint32_t>(chunk);
+  }
+  return file_.seek(size_) && remaining == 0U;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+
+// Append-only SD file that keeps a zero-filled extent allocated ahead of the
+// write position. Cluster allocation happens in bounded prefill() steps
+// instead of inside write(), and close() trims the file back to the bytes
+// actually written. After a power loss the tail is zeros, which recovery
+// code can find and trim.
+class RecordFile {
+ public:
+  bool open(const char *path, uint32_t initialBytes);
+  void close();
+  size_t write(const uint8_t *data, size_t size);
+  size_t print(const char *text);
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+  void flush();
+
+  // Zero-fills at most `budgetBytes` past the allocated end while less than
+  // `aheadBytes` are allocated beyond the write position. Returns the time
+  // spent in microseconds.
+  uint32_t prefill(uint32_t aheadBytes, uint32_t budgetBytes);
+
+  // Cuts a closed file at `size` bytes; `path` is relative to the SD root.
+  static bool truncateTo(const char *path, uint32_t size);
+
+  uint32_t position() const { return size_; }
+  uint32_t allocated() const { return allocated_; }
+  const char *path() const { return path_; }
+  explicit operator bool() const { return static_cast<bool>(file_); }
+
+ private:
+  bool fillZeros(uint32_t bytes);
+
+  File file_;
+  char path_[40] = "";
+  uint32_t size_ = 0;
+  uint32_t allocated_ = 0;
+};
@@ -0,0 +1,66 @@
+#include "recording_journal.h"
+
+#include <SD_MMC.h>
+
+#include "config.h"
+
+namespace {
+
+constexpr uint8_t kJournalSlots = 2;
+
+}  // namespace
+
+bool RecordingJournal::open() {
+  close();
+  if (!SD_MMC.exists(cfg::kJournalPath)) {
+    File created = SD_MMC.open(cfg::kJournalPath, FILE_WRITE);
+    if (!created) {
+      return false;
+    }
+    const uint8_t empty[ergo::kCommitRecordSize * kJournalSlots] = {0};
+    created.write(empty, sizeof(empty));
+    created.close();
+  }
+  file_ = SD_MMC.open(cfg::kJournalPath, "r+");
+  return static_cast<bool>(file_);
+}
+
+void RecordingJournal::close() {
+  if (file_) {
+    file_.close();
+  }
+}
+
+bool RecordingJournal::write(const ergo::CommitRecord &record) {
+  if (!file_) {
+    return false;
+  }
+  uint8_t encoded[ergo::kCommitRecordSize];
+  ergo::serializeCommitRecord(record, encoded);
+  const uint32_t slot = record.commitSequence % kJournalSlots;
+  if (!file_.seek(slot * ergo::kCommitRecordSize) ||
+      file_.write(encoded, sizeof(encoded)) != sizeof(encoded)) {
+    return false;
+  }
+  file_.flush();
+  return true;
+}
+
+bool RecordingJournal::latest(ergo::CommitRecord &record) {
+  if (!file_) {
+    return false;
+  }
+  bool found = false;
+  for (uint8_t slot = 0; slot < kJournalSlots; ++slot) {
+    uint8_t encoded[ergo::kCommitRecordSize];
+    ergo::CommitRecord candidate;
+    if (file_.seek(slot * ergo::kCommitRecordSize) &&
+        file_.read(encoded, sizeof(encoded)) == sizeof(encoded) &&
+        ergo::parseCommitRecord(encoded, sizeof(encoded), candidate) &&
+        (!found || candidate.commitSequence > record.commitSequence)) {
+      record = candidate;
+      found = true;
+    }
+  }
+  return found;
+}
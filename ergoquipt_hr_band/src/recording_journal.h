@@ -0,0 +1,20 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include <recording_format.h>
+
+// Two fixed slots holding the latest CommitRecords, written alternately so a
+// torn write only ever damages the older one. Reading it back at boot tells
+// which recording was open and how much of it is known to be durable.
+class RecordingJournal {
+ public:
+  bool open();
+  void close();
+  bool write(const ergo::CommitRecord &record);
+  bool latest(ergo::CommitRecord &record);
+
+ private:
+  File file_;
+};
@@ -2,6 +2,13 @@
 
 #include <Wire.h>
 
+#include <algorithm>
+
+#include <crc32.h>
+
+#include "logger.h"
+#include "ui_events.h"
+
 namespace {
 
 constexpr uint8_t kTcaOutputReg = 0x01;
@@ -43,31 +50,155 @@ const char *motionStateName(uint8_t state) {
   }
 }
 
+// Recording files are named /REC<6-digit sequence>[_YYYYMMDD_HHMMSS].csv|.erg.
+// The sequence keeps increasing across sessions, rotations and reboots, so it
+// also gives the oldest-first order for reclaiming space.
+bool parseRecordingName(const char *name, uint32_t &sequence, bool &erg) {
+  if (name[0] == '/') {
+    ++name;
+  }
+  if (strncmp(name, "REC", 3) != 0) {
+    return false;
+  }
+  sequence = 0;
+  for (size_t i = 3; i < 9; ++i) {
+    if (name[i] < '0' || name[i] > '9') {
+      return false;
+    }
+    sequence = sequence * 10U + static_cast<uint32_t>(name[i] - '0');
+  }
+  const size_t length = strlen(name);
+  if (length < 13 || (name[9] != '_' && name[9] != '.')) {
+    return false;
+  }
+  erg = strcmp(name + length - 4, ".erg") == 0;
+  return erg || strcmp(name + length - 4, ".csv") == 0;
+}
+
+static_assert(cfg::kMinFreeBytes >= 2ULL * cfg::kRotateBytes,
+              "a rotation must fit in the space kept free");
+
+void rootPath(const char *name, char *out, size_t outSize) {
+  snprintf(out, outSize, "%s%s", name[0] == '/' ? "" : "/", name);
+}
+
+// Walks CRC-checked blocks from the last committed offset and returns the
+// end of the last intact one, reading at most kRecoveryScanBytes.
+uint32_t salvageErgBlocks(File &file, uint32_t offset) {
+  const uint32_t size = static_cast<uint32_t>(file.size());
+  if (offset > size) {
+    return size;
+  }
+  const uint32_t limit = offset + std::min(size - offset, cfg::kRecoveryScanBytes);
+  uint8_t buffer[512];
+  ergo::BlockHeader header;
+  while (offset + ergo::kBlockHeaderSize <= limit && file.seek(offset) &&
+         file.read(buffer, ergo::kBlockHeaderSize) == ergo::kBlockHeaderSize &&
+         ergo::parseBlockHeader(buffer, ergo::kBlockHeaderSize, header) &&
+         header.payloadBytes <= limit - offset - ergo::kBlockHeaderSize) {
+    uint32_t crc = ergo::blockHeaderCrc(header);
+    uint32_t remaining = header.payloadBytes;
+    while (remaining > 0U) {
+      const size_t chunk = std::min<uint32_t>(remaining, sizeof(buffer));
+      if (file.read(buffer, chunk) != chunk) {
+        return offset;
+      }
+      crc = ergo::crc32(buffer, chunk, crc);
+      remaining -= static_cast<uint32_t>(chunk);
+    }
+    if (crc != header.crc) {
+      break;
+    }
+    offset += ergo::kBlockHeaderSize + header.payloadBytes;
+  }
+  return offset;
+}
+
+// Returns the end of the last complete row after the committed offset,
+// stopping at the zero-filled preallocation or after kRecoveryScanBytes.
+uint32_t salvageCsvRows(File &file, uint32_t offset) {
+  const uint32_t size = static_cast<uint32_t>(file.size());
+  if (offset > size) {
+    return size;
+  }
+  const uint32_t limit = offset + std::min(size - offset, cfg::kRecoveryScanBytes);
+  uint8_t buffer[512];
+  uint32_t end = offset;
+  uint32_t position = offset;
+  if (!file.seek(offset)) {
+    return offset;
+  }
+  while (position < limit) {
+    const size_t count = std::min<uint32_t>(limit - position, sizeof(buffer));
+    if (file.read(buffer, count) != count) {
+      break;
+    }
+    for (size_t i = 0; i < count; ++i) {
+      if (buffer[i] == 0U) {
+        return end;
+      }
+      if (buffer[i] == '\n') {
+        end = position + static_cast<uint32_t>(i) + 1U;
+      }
+    }
+    position += static_cast<uint32_t>(count);
+  }
+  return end;
+}
+
 }  // namespace
 
 void RecordingManager::begin() {
+  fileMutex_ = xSemaphoreCreateMutex();
+  const size_t indexBytes = cfg::kMaxIndexEntries * sizeof(ergo::IntervalSummary);
+  indexEntries_ = static_cast<ergo::IntervalSummary *>(ps_malloc(indexBytes));
+  if (indexEntries_ == nullptr) {
+    indexEntries_ = static_cast<ergo::IntervalSummary *>(malloc(indexBytes));
+  }
   if (!enableSdSlot()) {
     setStatus("SD enable failed");
-    Serial.println("Recorder: SD EXIO7 enable failed");
+    LOG_ERROR(Recorder, "Recorder: SD EXIO7 enable failed");
     return;
   }
 
   SD_MMC.setPins(cfg::kSdClkPin, cfg::kSdCmdPin, cfg::kSdDataPin);
-  mounted_ = SD_MMC.begin("/sdcard", true);
+  mounted_ = SD_MMC.begin(cfg::kSdMountPoint, true);
   if (!mounted_ || SD_MMC.cardType() == CARD_NONE) {
     mounted_ = false;
     setStatus("SD card not mounted");
-    Serial.println("Recorder: SD card not mounted");
+    LOG_WARN(Recorder, "Recorder: SD card not mounted");
     return;
   }
 
+  scanRecordings();
+  if (journal_.open()) {
+    ergo::CommitRecord last;
+    if (journal_.latest(last)) {
+      commitSequence_ = last.commitSequence + 1U;
+      nextSequence_ = std::max(nextSequence_, last.fileSequence + 1U);
+      if ((last.flags & ergo::kCommitFlagOpen) != 0U) {
+        recoverRecording(last);
+      }
+    }
+  } else {
+    LOG_WARN(Recorder, "Recorder: journal unavailable");
+  }
+  updateFreeSpace();
+
   portENTER_CRITICAL(&dataMux_);
   snapshot_.sdReady = true;
   snapshot_.cardSizeMb = SD_MMC.cardSize() / (1024ULL * 1024ULL);
   copyText(snapshot_.statusText, sizeof(snapshot_.statusText), "SD ready");
   portEXIT_CRITICAL(&dataMux_);
+  uiPostEvent(UiEvent::Recording);
 
-  Serial.printf("Recorder: SD ready, size=%lluMB\n", snapshot_.cardSizeMb);
+  LOG_INFO(Recorder, "Recorder: SD ready, size=%lluMB free=%lluMB next=%lu",
+                     snapshot_.cardSizeMb, snapshot_.freeMb,
+                     static_cast<unsigned long>(nextSequence_));
+}
+
+void RecordingManager::setRawSampleSource(const RawSampleRing *source) {
+  rawSource_ = source;
 }
 
 bool RecordingManager::start(const RtcSnapshot &rtc) {
@@ -75,60 +206,101 @@ bool RecordingManager::start(const RtcSnapshot &rtc) {
     setStatus("Insert SD card");
     return false;
   }
-  if (file_) {
-    file_.close();
-  }
+  lockFiles();
+  closeFiles(millis());
 
-  char fileName[40];
-  buildFileName(rtc, fileName, sizeof(fileName));
-  file_ = SD_MMC.open(fileName, FILE_WRITE);
-  if (!file_) {
-    setStatus("Open CSV failed");
-    Serial.printf("Recorder: failed to open %s\n", fileName);
+  portENTER_CRITICAL(&dataMux_);
+  snapshot_.rowsWritten = 0;
+  snapshot_.rawFramesWritten = 0;
+  snapshot_.rawFramesDropped = 0;
+  snapshot_.rawBytesWritten = 0;
+  snapshot_.filesWritten = 0;
+  snapshot_.appendLastUs = 0;
+  snapshot_.appendMaxUs = 0;
+  snapshot_.appendMeanUs = 0;
+  snapshot_.appendsOverBudget = 0;
+  snapshot_.prefillMaxUs = 0;
+  portEXIT_CRITICAL(&dataMux_);
+  appendTotalUs_ = 0;
+  rawCursor_ = rawSource_ != nullptr ? rawSource_->head() : 0;
+
+  reclaimSpace();
+  if (!openFiles(rtc)) {
+    unlockFiles();
     return false;
   }
-
-  file_.println(
-      "millis,date,time,filter_mode,hr,spo2_x100,rri,hrv,status,battery_pct,"
-      "ble_connected,ir_raw,red_raw,ir_filtered,acc_x,acc_y,acc_z,acc_mag,"
-      "motion_score,motion_state,imu_ready,finger_present,peak_detected,rri_accepted");
-  file_.flush();
+  session_.reset(fileStartMs_, fileSummary_.summary().csvOffset,
+                 fileSummary_.summary().ergOffset);
+  unlockFiles();
 
   portENTER_CRITICAL(&dataMux_);
   snapshot_.recording = true;
-  snapshot_.rowsWritten = 0;
-  copyText(snapshot_.fileName, sizeof(snapshot_.fileName), fileName);
-  copyText(snapshot_.statusText, sizeof(snapshot_.statusText), "Recording");
+  snapshot_.session = session_.summary();
   portEXIT_CRITICAL(&dataMux_);
-
-  Serial.printf("Recorder: started %s\n", fileName);
+  uiPostEvent(UiEvent::Recording);
   return true;
 }
 
 void RecordingManager::stop() {
-  if (file_) {
-    file_.flush();
-    file_.close();
-  }
+  lockFiles();
+  closeFiles(millis());
+  unlockFiles();
+  updateFreeSpace();
 
   portENTER_CRITICAL(&dataMux_);
   snapshot_.recording = false;
   copyText(snapshot_.statusText, sizeof(snapshot_.statusText), "Recording stopped");
   portEXIT_CRITICAL(&dataMux_);
+  uiPostEvent(UiEvent::Recording);
 
-  Serial.println("Recorder: stopped");
+  const RecordingSnapshot stats = snapshot();
+  LOG_INFO(Recorder, "Recorder: stopped, append max=%luus mean=%luus over=%lu "
+                     "prefill max=%luus",
+                     static_cast<unsigned long>(stats.appendMaxUs),
+                     static_cast<unsigned long>(stats.appendMeanUs),
+                     static_cast<unsigned long>(stats.appendsOverBudget),
+                     static_cast<unsigned long>(stats.prefillMaxUs));
 }
 
 void RecordingManager::append(const VitalData &data, uint8_t batteryPercent,
                               bool bleConnected, const RtcSnapshot &rtc,
                               FilteringMode mode,
                               const SensorDiagnostics &diagnostics) {
+  const uint32_t startUs = micros();
+  lockFiles();
   if (!file_ || !recording()) {
+    unlockFiles();
     return;
   }
 
+  const uint32_t nowMs = millis();
+  if (rotationDue(nowMs)) {
+    // kMinFreeBytes covers a full file set, so the next one fits; the space
+    // it takes is reclaimed afterwards by maintain().
+    closeFiles(nowMs);
+    if (!openFiles(rtc)) {
+      unlockFiles();
+      LOG_ERROR(Recorder, "Recorder: rotation failed, recording stopped");
+      portENTER_CRITICAL(&dataMux_);
+      snapshot_.recording = false;
+      copyText(snapshot_.statusText, sizeof(snapshot_.statusText),
+               "Rotation failed, recording stopped");
+      portEXIT_CRITICAL(&dataMux_);
+      uiPostEvent(UiEvent::Recording);
+      return;
+    }
+    reclaimPending_ = true;
+  }
+
+  drainRawSamples();
+
+  if (minute_.summary().rows > 0U &&
+      (nowMs - minute_.summary().startMs) >= cfg::kIndexIntervalMs) {
+    closeIndexInterval(nowMs);
+  }
+
   file_.printf("%lu,%s,%s,%s,%u,%u,%u,%u,0x%02X,%u,%u,%lu,%lu,%lu,%.4f,%.4f,%.4f,%.4f,%.5f,%s,%u,%u,%u,%u\n",
-               static_cast<unsigned long>(millis()),
+               static_cast<unsigned long>(nowMs),
                rtc.valid ? rtc.dateText : "",
                rtc.valid ? rtc.timeText : "",
                filteringModeName(mode),
@@ -147,10 +319,37 @@ void RecordingManager::append(const VitalData &data, uint8_t batteryPercent,
                diagnostics.fingerPresent ? 1U : 0U,
                diagnostics.peakDetected ? 1U : 0U,
                diagnostics.rriAccepted ? 1U : 0U);
-  file_.flush();
+
+  const bool vitalsValid = (data.status & cfg::kStatusVitalsValid) != 0U;
+  const uint16_t motionX1000 = static_cast<uint16_t>(
+      constrain(lroundf(diagnostics.motionScore * 1000.0f), 0L, 65535L));
+  minute_.add(nowMs, vitalsValid, data.hr, data.spo2_x100, motionX1000);
+  fileSummary_.add(nowMs, vitalsValid, data.hr, data.spo2_x100, motionX1000);
+  session_.add(nowMs, vitalsValid, data.hr, data.spo2_x100, motionX1000);
+  if ((nowMs - lastCommitMs_) >= cfg::kCommitIntervalMs) {
+    commit(nowMs, true);
+  }
+
+  // Keep the next extent allocated so the writes above never grow the FAT
+  // chain themselves.
+  const uint32_t prefillUs =
+      file_.prefill(cfg::kCsvPreallocBytes, cfg::kPrefillBudgetBytes) +
+      rawFile_.prefill(cfg::kErgPreallocBytes, cfg::kPrefillBudgetBytes);
+  unlockFiles();
+  const uint32_t elapsedUs = micros() - startUs;
+  appendTotalUs_ += elapsedUs;
 
   portENTER_CRITICAL(&dataMux_);
   ++snapshot_.rowsWritten;
+  snapshot_.session = session_.summary();
+  snapshot_.appendLastUs = elapsedUs;
+  snapshot_.appendMaxUs = std::max(snapshot_.appendMaxUs, elapsedUs);
+  snapshot_.appendMeanUs =
+      static_cast<uint32_t>(appendTotalUs_ / snapshot_.rowsWritten);
+  snapshot_.prefillMaxUs = std::max(snapshot_.prefillMaxUs, prefillUs);
+  if (elapsedUs > cfg::kAppendLatencyBudgetUs) {
+    ++snapshot_.appendsOverBudget;
+  }
   portEXIT_CRITICAL(&dataMux_);
 }
 
@@ -176,6 +375,124 @@ bool RecordingManager::sdReady() const {
   return value;
 }
 
+size_t RecordingManager::listRecordings(uint32_t fromSequence, ergo::FileEntry *entries,
+                                        size_t capacity) {
+  if (!mounted_ || entries == nullptr || capacity == 0U) {
+    return 0;
+  }
+  File root = SD_MMC.open("/");
+  if (!root) {
+    return 0;
+  }
+
+  portENTER_CRITICAL(&dataMux_);
+  const uint32_t activeSequence = activeSequence_;
+  const uint32_t activeCsvBytes = activeCsvBytes_;
+  const uint32_t activeErgBytes = activeErgBytes_;
+  portEXIT_CRITICAL(&dataMux_);
+
+  // Keeps the `capacity` smallest (sequence, kind) keys, sorted.
+  const auto before = [](const ergo::FileEntry &a, const ergo::FileEntry &b) {
+    return a.sequence != b.sequence ? a.sequence < b.sequence
+                                    : (a.flags & ergo::kFileFlagErg) <
+                                          (b.flags & ergo::kFileFlagErg);
+  };
+  size_t count = 0;
+  for (File file = root.openNextFile(); file; file = root.openNextFile()) {
+    ergo::FileEntry entry;
+    bool erg = false;
+    if (!file.isDirectory() && parseRecordingName(file.name(), entry.sequence, erg) &&
+        entry.sequence >= fromSequence) {
+      entry.flags = erg ? ergo::kFileFlagErg : 0U;
+      entry.size = static_cast<uint32_t>(file.size());
+      if (entry.sequence == activeSequence) {
+        // The tail past the last commit is unflushed rows and prefill zeros.
+        entry.flags |= ergo::kFileFlagActive;
+        entry.size = erg ? activeErgBytes : activeCsvBytes;
+      }
+      const char *name = file.name();
+      copyText(entry.name, sizeof(entry.name), name[0] == '/' ? name + 1 : name);
+      if (count < capacity || before(entry, entries[count - 1U])) {
+        size_t slot = count < capacity ? count++ : count - 1U;
+        for (; slot > 0U && before(entry, entries[slot - 1U]); --slot) {
+          entries[slot] = entries[slot - 1U];
+        }
+        entries[slot] = entry;
+      }
+    }
+    file.close();
+  }
+  root.close();
+  return count;
+}
+
+bool RecordingManager::openTransfer(uint32_t sequence, bool erg) {
+  closeTransfer();
+  if (!mounted_) {
+    return false;
+  }
+  lockFiles();
+  char path[40];
+  if (findRecording(sequence, erg, path, sizeof(path))) {
+    transferFile_ = SD_MMC.open(path, FILE_READ);
+  }
+  if (transferFile_) {
+    transferSequence_ = sequence;
+    transferErg_ = erg;
+    copyText(transferPath_, sizeof(transferPath_), path);
+    transferEnd_ = static_cast<uint32_t>(transferFile_.size());
+    transferActive_ = false;
+  }
+  unlockFiles();
+  return static_cast<bool>(transferFile_);
+}
+
+uint32_t RecordingManager::transferSize(bool &active) {
+  active = false;
+  if (!transferFile_) {
+    return 0;
+  }
+  uint32_t end = 0;
+  portENTER_CRITICAL(&dataMux_);
+  if (activeSequence_ == transferSequence_) {
+    active = true;
+    end = transferErg_ ? activeErgBytes_ : activeCsvBytes_;
+  }
+  portEXIT_CRITICAL(&dataMux_);
+
+  // Once the writer has moved on, this handle's size and buffered sectors
+  // are stale; reopening picks up the new commit or the trimmed final file.
+  if (active ? end != transferEnd_ : transferActive_) {
+    transferFile_.close();
+    transferFile_ = SD_MMC.open(transferPath_, FILE_READ);
+    if (!active) {
+      end = transferFile_ ? static_cast<uint32_t>(transferFile_.size()) : 0U;
+    }
+  } else if (!active) {
+    end = transferEnd_;
+  }
+  transferEnd_ = end;
+  transferActive_ = active;
+  return end;
+}
+
+size_t RecordingManager::readTransfer(uint32_t offset, uint8_t *out, size_t size) {
+  if (!transferFile_ || offset >= transferEnd_ || !transferFile_.seek(offset)) {
+    return 0;
+  }
+  const size_t wanted = std::min<size_t>(size, transferEnd_ - offset);
+  return transferFile_.read(out, wanted);
+}
+
+void RecordingManager::closeTransfer() {
+  lockFiles();
+  if (transferFile_) {
+    transferFile_.close();
+  }
+  transferSequence_ = 0;
+  unlockFiles();
+}
+
 bool RecordingManager::enableSdSlot() {
   uint8_t config = 0;
   uint8_t output = 0;
@@ -223,18 +540,457 @@ bool RecordingManager::expanderWriteReg(uint8_t reg, uint8_t value) {
   return ok;
 }
 
+void RecordingManager::lockFiles() {
+  if (fileMutex_ != nullptr) {
+    xSemaphoreTake(fileMutex_, portMAX_DELAY);
+  }
+}
+
+void RecordingManager::unlockFiles() {
+  if (fileMutex_ != nullptr) {
+    xSemaphoreGive(fileMutex_);
+  }
+}
+
 void RecordingManager::setStatus(const char *status) {
   portENTER_CRITICAL(&dataMux_);
   copyText(snapshot_.statusText, sizeof(snapshot_.statusText), status);
   portEXIT_CRITICAL(&dataMux_);
+  uiPostEvent(UiEvent::Recording);
+}
+
+bool RecordingManager::openRawFile(const char *baseName, const RtcSnapshot &rtc) {
+  if (rawFile_) {
+    rawFile_.close();
+  }
+  rawFrameCount_ = 0;
+  if (rawSource_ == nullptr) {
+    return false;
+  }
+
+  char rawName[40];
+  snprintf(rawName, sizeof(rawName), "%s.erg", baseName);
+  if (!rawFile_.open(rawName, cfg::kPrefillBudgetBytes)) {
+    LOG_ERROR(Recorder, "Recorder: failed to open %s", rawName);
+    return false;
+  }
+
+  ergo::FileHeader header;
+  header.startMs = millis();
+  header.rtcValid = rtc.valid ? 1U : 0U;
+  header.year = rtc.year;
+  header.month = rtc.month;
+  header.day = rtc.day;
+  header.hour = rtc.hour;
+  header.minute = rtc.minute;
+  header.second = rtc.second;
+  uint8_t encoded[ergo::kFileHeaderSize];
+  ergo::serializeFileHeader(header, encoded);
+  rawFile_.write(encoded, sizeof(encoded));
+  rawFile_.flush();
+  return true;
+}
+
+void RecordingManager::drainRawSamples() {
+  if (!rawFile_ || rawSource_ == nullptr) {
+    return;
+  }
+
+  RawSample samples[32];
+  uint32_t dropped = 0;
+  size_t count = 0;
+  while ((count = rawSource_->read(rawCursor_, samples, 32, &dropped)) > 0) {
+    for (size_t i = 0; i < count; ++i) {
+      int32_t *frame = &rawFrames_[rawFrameCount_ * ergo::kRawChannelCount];
+      frame[ergo::kRawChannelTimestampMs] = static_cast<int32_t>(samples[i].timestampMs);
+      frame[ergo::kRawChannelIr] = static_cast<int32_t>(samples[i].ir);
+      frame[ergo::kRawChannelRed] = static_cast<int32_t>(samples[i].red);
+      frame[ergo::kRawChannelAccelXmg] = samples[i].accelXmg;
+      frame[ergo::kRawChannelAccelYmg] = samples[i].accelYmg;
+      frame[ergo::kRawChannelAccelZmg] = samples[i].accelZmg;
+      if (++rawFrameCount_ == cfg::kRawBlockFrames) {
+        writeRawBlock();
+      }
+    }
+  }
+
+  if (dropped > 0U) {
+    portENTER_CRITICAL(&dataMux_);
+    snapshot_.rawFramesDropped += dropped;
+    portEXIT_CRITICAL(&dataMux_);
+  }
+}
+
+void RecordingManager::writeRawBlock() {
+  if (!rawFile_ || rawFrameCount_ == 0U) {
+    return;
+  }
+
+  uint8_t *payload = rawBlock_ + ergo::kBlockHeaderSize;
+  const size_t payloadBytes = ergo::encodeSampleBlock(
+      rawFrames_, ergo::kRawChannelCount, rawFrameCount_, payload,
+      sizeof(rawBlock_) - ergo::kBlockHeaderSize);
+  const uint16_t frames = rawFrameCount_;
+  rawFrameCount_ = 0;
+  if (payloadBytes == 0U) {
+    portENTER_CRITICAL(&dataMux_);
+    snapshot_.rawFramesDropped += frames;
+    portEXIT_CRITICAL(&dataMux_);
+    LOG_WARN(Recorder, "Recorder: raw block encode failed, %u frames dropped",
+                       static_cast<unsigned>(frames));
+    return;
+  }
+
+  ergo::BlockHeader header;
+  header.type = ergo::BlockType::RawSamples;
+  header.channels = ergo::kRawChannelCount;
+  header.sampleCount = frames;
+  header.firstSampleMs = static_cast<uint32_t>(rawFrames_[ergo::kRawChannelTimestampMs]);
+  header.payloadBytes = static_cast<uint32_t>(payloadBytes);
+  header.crc = ergo::blockCrc(header, payload, payloadBytes);
+  ergo::serializeBlockHeader(header, rawBlock_);
+  const size_t blockBytes = ergo::kBlockHeaderSize + payloadBytes;
+  rawFile_.write(rawBlock_, blockBytes);
+
+  portENTER_CRITICAL(&dataMux_);
+  snapshot_.rawFramesWritten += frames;
+  snapshot_.rawBytesWritten += static_cast<uint32_t>(blockBytes);
+  portEXIT_CRITICAL(&dataMux_);
 }
 
-void RecordingManager::buildFileName(const RtcSnapshot &rtc, char *out,
-                                     size_t outSize) const {
+void RecordingManager::writeErgBlock(ergo::BlockType type, uint32_t timestampMs,
+                                     const uint8_t *payload, size_t size) {
+  ergo::BlockHeader header;
+  header.type = type;
+  header.firstSampleMs = timestampMs;
+  header.payloadBytes = static_cast<uint32_t>(size);
+  header.crc = ergo::blockCrc(header, payload, size);
+  uint8_t encoded[ergo::kBlockHeaderSize];
+  ergo::serializeBlockHeader(header, encoded);
+  rawFile_.write(encoded, sizeof(encoded));
+  if (payload != nullptr && size > 0U) {
+    rawFile_.write(payload, size);
+  }
+
+  portENTER_CRITICAL(&dataMux_);
+  snapshot_.rawBytesWritten += static_cast<uint32_t>(sizeof(encoded) + size);
+  portEXIT_CRITICAL(&dataMux_);
+}
+
+void RecordingManager::closeIndexInterval(uint32_t nowMs) {
+  if (rawFile_ && minute_.summary().rows > 0U) {
+    uint8_t payload[ergo::kIntervalSummarySize];
+    ergo::serializeIntervalSummary(minute_.summary(), payload);
+    writeErgBlock(ergo::BlockType::Index, minute_.summary().startMs, payload,
+                  sizeof(payload));
+    if (indexEntries_ != nullptr && indexCount_ < cfg::kMaxIndexEntries) {
+      indexEntries_[indexCount_++] = minute_.summary();
+    }
+  }
+
+  minute_.reset(nowMs, static_cast<uint32_t>(file_.position()),
+                rawFile_ ? static_cast<uint32_t>(rawFile_.position()) : 0U);
+
+  portENTER_CRITICAL(&dataMux_);
+  snapshot_.indexEntries = static_cast<uint32_t>(indexCount_);
+  portEXIT_CRITICAL(&dataMux_);
+}
+
+void RecordingManager::writeFooter(uint32_t nowMs) {
+  closeIndexInterval(nowMs);
+
+  ergo::FooterInfo footer;
+  footer.session = fileSummary_.summary();
+  footer.indexTableOffset = static_cast<uint32_t>(rawFile_.position());
+  footer.indexEntryCount = static_cast<uint32_t>(indexCount_);
+
+  ergo::BlockHeader header;
+  header.type = ergo::BlockType::IndexTable;
+  header.firstSampleMs = footer.session.startMs;
+  header.payloadBytes = static_cast<uint32_t>(indexCount_ * ergo::kIntervalSummarySize);
+  header.crc = ergo::blockHeaderCrc(header);
+  for (size_t i = 0; i < indexCount_; ++i) {
+    uint8_t entry[ergo::kIntervalSummarySize];
+    ergo::serializeIntervalSummary(indexEntries_[i], entry);
+    header.crc = ergo::crc32(entry, sizeof(entry), header.crc);
+  }
+  uint8_t encoded[ergo::kBlockHeaderSize];
+  ergo::serializeBlockHeader(header, encoded);
+  rawFile_.write(encoded, sizeof(encoded));
+  for (size_t i = 0; i < indexCount_; ++i) {
+    uint8_t entry[ergo::kIntervalSummarySize];
+    ergo::serializeIntervalSummary(indexEntries_[i], entry);
+    rawFile_.write(entry, sizeof(entry));
+  }
+  portENTER_CRITICAL(&dataMux_);
+  snapshot_.rawBytesWritten += static_cast<uint32_t>(sizeof(encoded)) + header.payloadBytes;
+  portEXIT_CRITICAL(&dataMux_);
+
+  uint8_t payload[ergo::kFooterPayloadSize];
+  ergo::serializeFooter(footer, payload);
+  writeErgBlock(ergo::BlockType::Footer, nowMs, payload, sizeof(payload));
+}
+
+void RecordingManager::buildBaseName(uint32_t sequence, const RtcSnapshot &rtc,
+                                     char *out, size_t outSize) const {
   if (rtc.valid) {
-    snprintf(out, outSize, "/ERGO_%04u%02u%02u_%02u%02u%02u.csv", rtc.year,
-             rtc.month, rtc.day, rtc.hour, rtc.minute, rtc.second);
+    snprintf(out, outSize, "/REC%06lu_%04u%02u%02u_%02u%02u%02u",
+             static_cast<unsigned long>(sequence), rtc.year, rtc.month, rtc.day,
+             rtc.hour, rtc.minute, rtc.second);
   } else {
-    snprintf(out, outSize, "/ERGO_%lu.csv", static_cast<unsigned long>(millis()));
+    snprintf(out, outSize, "/REC%06lu", static_cast<unsigned long>(sequence));
   }
 }
+
+bool RecordingManager::openFiles(const RtcSnapshot &rtc) {
+  char baseName[32];
+  char fileName[40];
+  fileSequence_ = nextSequence_++;
+  buildBaseName(fileSequence_, rtc, baseName, sizeof(baseName));
+  snprintf(fileName, sizeof(fileName), "%s.csv", baseName);
+  if (!file_.open(fileName, cfg::kPrefillBudgetBytes)) {
+    setStatus("Open CSV failed");
+    LOG_ERROR(Recorder, "Recorder: failed to open %s", fileName);
+    return false;
+  }
+
+  file_.print(
+      "millis,date,time,filter_mode,hr,spo2_x100,rri,hrv,status,battery_pct,"
+      "ble_connected,ir_raw,red_raw,ir_filtered,acc_x,acc_y,acc_z,acc_mag,"
+      "motion_score,motion_state,imu_ready,finger_present,peak_detected,rri_accepted\n");
+  file_.flush();
+  const bool rawOpen = openRawFile(baseName, rtc);
+  fileStartMs_ = millis();
+  const uint32_t csvOffset = file_.position();
+  const uint32_t ergOffset = rawOpen ? rawFile_.position() : 0U;
+  minute_.reset(fileStartMs_, csvOffset, ergOffset);
+  fileSummary_.reset(fileStartMs_, csvOffset, ergOffset);
+  indexCount_ = 0;
+  commit(fileStartMs_, true);
+
+  portENTER_CRITICAL(&dataMux_);
+  ++snapshot_.filesWritten;
+  snapshot_.rawBytesWritten += rawOpen ? ergo::kFileHeaderSize : 0U;
+  snapshot_.indexEntries = 0;
+  copyText(snapshot_.fileName, sizeof(snapshot_.fileName), fileName);
+  copyText(snapshot_.statusText, sizeof(snapshot_.statusText),
+           rawOpen ? "Recording" : "Recording (raw stream off)");
+  portEXIT_CRITICAL(&dataMux_);
+
+  LOG_INFO(Recorder, "Recorder: started %s", fileName);
+  return true;
+}
+
+void RecordingManager::closeFiles(uint32_t nowMs) {
+  if (rawFile_) {
+    drainRawSamples();
+    writeRawBlock();
+    writeFooter(nowMs);
+    rawFile_.close();
+  }
+  if (file_) {
+    file_.close();
+    commit(nowMs, false);
+  }
+}
+
+// Makes everything written so far durable: flushes both files, appends a
+// Commit block to the .erg and mirrors the record into the journal. A closing
+// record (open == false) is written after the files are trimmed and closed.
+void RecordingManager::commit(uint32_t nowMs, bool open) {
+  ergo::CommitRecord record;
+  record.commitSequence = commitSequence_++;
+  record.fileSequence = fileSequence_;
+  record.flags = open ? ergo::kCommitFlagOpen : 0U;
+  record.rows = fileSummary_.summary().rows;
+  record.timestampMs = nowMs;
+  file_.flush();
+  record.csvBytes = file_.position();
+  record.ergBytes = rawFile_.position();
+  if (open && rawFile_) {
+    record.ergBytes += static_cast<uint32_t>(ergo::kBlockHeaderSize + ergo::kCommitRecordSize);
+    uint8_t payload[ergo::kCommitRecordSize];
+    ergo::serializeCommitRecord(record, payload);
+    writeErgBlock(ergo::BlockType::Commit, nowMs, payload, sizeof(payload));
+    rawFile_.flush();
+  }
+  journal_.write(record);
+  lastCommitMs_ = nowMs;
+
+  portENTER_CRITICAL(&dataMux_);
+  activeSequence_ = open ? fileSequence_ : 0U;
+  activeCsvBytes_ = record.csvBytes;
+  activeErgBytes_ = record.ergBytes;
+  portEXIT_CRITICAL(&dataMux_);
+}
+
+bool RecordingManager::rotationDue(uint32_t nowMs) const {
+  return file_.position() >= cfg::kRotateBytes ||
+         rawFile_.position() >= cfg::kRotateBytes ||
+         (nowMs - fileStartMs_) >= cfg::kRotateIntervalMs;
+}
+
+void RecordingManager::scanRecordings() {
+  File root = SD_MMC.open("/");
+  if (!root) {
+    return;
+  }
+
+  uint32_t lastSequence = 0;
+  for (File entry = root.openNextFile(); entry; entry = root.openNextFile()) {
+    uint32_t sequence = 0;
+    bool erg = false;
+    if (!entry.isDirectory() && parseRecordingName(entry.name(), sequence, erg)) {
+      lastSequence = std::max(lastSequence, sequence);
+    }
+    entry.close();
+  }
+  root.close();
+  nextSequence_ = lastSequence + 1U;
+}
+
+// Repairs the recording that was open when power was lost. Everything up to
+// the last commit is trusted; past it only CRC-valid .erg blocks and complete
+// CSV rows within kRecoveryScanBytes are kept, then both files are trimmed.
+void RecordingManager::recoverRecording(ergo::CommitRecord record) {
+  char path[40];
+  if (record.ergBytes >= ergo::kFileHeaderSize &&
+      findRecording(record.fileSequence, true, path, sizeof(path))) {
+    File file = SD_MMC.open(path, FILE_READ);
+    const uint32_t size = static_cast<uint32_t>(file.size());
+    record.ergBytes = salvageErgBlocks(file, record.ergBytes);
+    file.close();
+    if (record.ergBytes < size) {
+      RecordFile::truncateTo(path, record.ergBytes);
+    }
+  }
+  if (findRecording(record.fileSequence, false, path, sizeof(path))) {
+    File file = SD_MMC.open(path, FILE_READ);
+    const uint32_t size = static_cast<uint32_t>(file.size());
+    record.csvBytes = salvageCsvRows(file, record.csvBytes);
+    file.close();
+    if (record.csvBytes < size) {
+      RecordFile::truncateTo(path, record.csvBytes);
+    }
+  }
+
+  record.commitSequence = commitSequence_++;
+  record.flags &= ~ergo::kCommitFlagOpen;
+  journal_.write(record);
+  LOG_INFO(Recorder, "Recorder: recovered REC%06lu, csv=%lu erg=%lu bytes",
+                     static_cast<unsigned long>(record.fileSequence),
+                     static_cast<unsigned long>(record.csvBytes),
+                     static_cast<unsigned long>(record.ergBytes));
+}
+
+bool RecordingManager::findRecording(uint32_t sequence, bool erg, char *path,
+                                     size_t pathSize) {
+  File root = SD_MMC.open("/");
+  if (!root) {
+    return false;
+  }
+
+  bool found = false;
+  for (File entry = root.openNextFile(); entry && !found; entry = root.openNextFile()) {
+    uint32_t entrySequence = 0;
+    bool entryErg = false;
+    if (!entry.isDirectory() &&
+        parseRecordingName(entry.name(), entrySequence, entryErg) &&
+        entrySequence == sequence && entryErg == erg) {
+      rootPath(entry.name(), path, pathSize);
+      found = true;
+    }
+    entry.close();
+  }
+  root.close();
+  return found;
+}
+
+// The `capacity` oldest recording files in (sequence, .csv before .erg)
+// order, from one pass over the root directory.
+size_t RecordingManager::findOldestRecordings(ReclaimCandidate *out, size_t capacity,
+                                              uint32_t skipA, uint32_t skipB) {
+  File root = SD_MMC.open("/");
+  if (!root) {
+    return 0;
+  }
+
+  size_t count = 0;
+  for (File entry = root.openNextFile(); entry; entry = root.openNextFile()) {
+    uint32_t sequence = 0;
+    bool erg = false;
+    if (!entry.isDirectory() && parseRecordingName(entry.name(), sequence, erg) &&
+        sequence != skipA && sequence != skipB) {
+      // Insertion into the sorted candidates, dropping the newest when full.
+      size_t slot = count;
+      while (slot > 0U && (out[slot - 1U].sequence > sequence ||
+                           (out[slot - 1U].sequence == sequence && out[slot - 1U].erg))) {
+        --slot;
+      }
+      if (slot < capacity) {
+        const size_t moved = (count < capacity ? count : capacity - 1U) - slot;
+        memmove(&out[slot + 1U], &out[slot], moved * sizeof(ReclaimCandidate));
+        out[slot].sequence = sequence;
+        out[slot].erg = erg;
+        out[slot].bytes = static_cast<uint32_t>(entry.size());
+        rootPath(entry.name(), out[slot].path, sizeof(out[slot].path));
+        count = count < capacity ? count + 1U : capacity;
+      }
+    }
+    entry.close();
+  }
+  root.close();
+  return count;
+}
+
+// Deletes whole recordings oldest-first until kMinFreeBytes are free, except
+// the open one and one being downloaded. Free space is measured once and
+// then credited with each deleted file's size, and one directory scan yields
+// kReclaimBatch files, so the SD work grows linearly with what is deleted.
+void RecordingManager::reclaimSpace() {
+  const uint32_t openSequence = file_ ? fileSequence_ : 0U;
+  uint64_t freeBytes = updateFreeSpace();
+  bool removed = false;
+  while (freeBytes < cfg::kMinFreeBytes) {
+    ReclaimCandidate candidates[cfg::kReclaimBatch];
+    const size_t count = findOldestRecordings(candidates, cfg::kReclaimBatch,
+                                              transferSequence_, openSequence);
+    if (count == 0U) {
+      LOG_WARN(Recorder, "Recorder: SD low on space, nothing left to reclaim");
+      break;
+    }
+    for (size_t i = 0; i < count && freeBytes < cfg::kMinFreeBytes; ++i) {
+      LOG_INFO(Recorder, "Recorder: reclaiming %s", candidates[i].path);
+      if (!SD_MMC.remove(candidates[i].path)) {
+        LOG_WARN(Recorder, "Recorder: failed to remove %s", candidates[i].path);
+        freeBytes = cfg::kMinFreeBytes;
+        break;
+      }
+      removed = true;
+      freeBytes += candidates[i].bytes;
+    }
+  }
+  if (removed) {
+    updateFreeSpace();
+  }
+}
+
+void RecordingManager::maintain() {
+  if (!reclaimPending_) {
+    return;
+  }
+  lockFiles();
+  reclaimPending_ = false;
+  reclaimSpace();
+  unlockFiles();
+}
+
+uint64_t RecordingManager::updateFreeSpace() {
+  const uint64_t total = SD_MMC.totalBytes();
+  const uint64_t used = SD_MMC.usedBytes();
+  const uint64_t freeBytes = total > used ? total - used : 0U;
+  portENTER_CRITICAL(&dataMux_);
+  snapshot_.freeMb = freeBytes / (1024ULL * 1024ULL);
+  portEXIT_CRITICAL(&dataMux_);
+  return freeBytes;
+}
@@ -4,14 +4,34 @@
 #include <FS.h>
 #include <SD_MMC.h>
 
+#include <file_transfer.h>
+#include <sample_codec.h>
+#include <recording_format.h>
+
 #include "config.h"
+#include "record_file.h"
+#include "recording_journal.h"
 #include "rtc_manager.h"
+#include "sensor_manager.h"
 
 struct RecordingSnapshot {
   bool sdReady = false;
   bool recording = false;
   uint32_t rowsWritten = 0;
+  uint32_t rawFramesWritten = 0;
+  uint32_t rawFramesDropped = 0;
+  uint32_t rawBytesWritten = 0;
+  uint32_t indexEntries = 0;
+  uint32_t filesWritten = 0;
+  ergo::IntervalSummary session{};
+  // append() latency including SD writes and prefill, in microseconds.
+  uint32_t appendLastUs = 0;
+  uint32_t appendMaxUs = 0;
+  uint32_t appendMeanUs = 0;
+  uint32_t appendsOverBudget = 0;
+  uint32_t prefillMaxUs = 0;
   uint64_t cardSizeMb = 0;
+  uint64_t freeMb = 0;
   char fileName[40] = "";
   char statusText[96] = "Recorder idle";
 };
@@ -19,24 +39,107 @@ struct RecordingSnapshot {
 class RecordingManager {
  public:
   void begin();
+  void setRawSampleSource(const RawSampleRing *source);
   bool start(const RtcSnapshot &rtc);
   void stop();
   void append(const VitalData &data, uint8_t batteryPercent, bool bleConnected,
               const RtcSnapshot &rtc, FilteringMode mode,
               const SensorDiagnostics &diagnostics);
+  // Idle-time upkeep for the recording task between appends: reclaims
+  // space after a rotation so append() itself never deletes files.
+  void maintain();
   RecordingSnapshot snapshot() const;
   bool recording() const;
   bool sdReady() const;
 
+  // Recordings from `fromSequence` on in (sequence, .csv before .erg) order,
+  // at most `capacity` of them. The open recording reports its size as of
+  // the last commit and has kFileFlagActive set. Safe to call from another
+  // task while recording.
+  size_t listRecordings(uint32_t fromSequence, ergo::FileEntry *entries,
+                        size_t capacity);
+  // Opens one recording for reading from another task; space reclaim skips
+  // it until closeTransfer(). One transfer at a time.
+  bool openTransfer(uint32_t sequence, bool erg);
+  // Bytes readable now. For the open recording that is the last commit, so
+  // it grows while `active` stays true.
+  uint32_t transferSize(bool &active);
+  // Reads up to `size` bytes at `offset`, never past transferSize().
+  size_t readTransfer(uint32_t offset, uint8_t *out, size_t size);
+  void closeTransfer();
+
  private:
   bool enableSdSlot();
   bool expanderReadReg(uint8_t reg, uint8_t &value);
   bool expanderWriteReg(uint8_t reg, uint8_t value);
   void setStatus(const char *status);
-  void buildFileName(const RtcSnapshot &rtc, char *out, size_t outSize) const;
+  void lockFiles();
+  void unlockFiles();
+  void buildBaseName(uint32_t sequence, const RtcSnapshot &rtc, char *out,
+                     size_t outSize) const;
+  bool openFiles(const RtcSnapshot &rtc);
+  void closeFiles(uint32_t nowMs);
+  bool rotationDue(uint32_t nowMs) const;
+  void commit(uint32_t nowMs, bool open);
+  void scanRecordings();
+  void recoverRecording(ergo::CommitRecord record);
+  bool findRecording(uint32_t sequence, bool erg, char *path, size_t pathSize);
+  struct ReclaimCandidate {
+    uint32_t sequence = 0;
+    bool erg = false;
+    uint32_t bytes = 0;
+    char path[40] = "";
+  };
+  size_t findOldestRecordings(ReclaimCandidate *out, size_t capacity,
+                              uint32_t skipA, uint32_t skipB);
+  void reclaimSpace();
+  uint64_t updateFreeSpace();
+  bool openRawFile(const char *baseName, const RtcSnapshot &rtc);
+  void drainRawSamples();
+  void writeRawBlock();
+  void writeErgBlock(ergo::BlockType type, uint32_t timestampMs,
+                     const uint8_t *payload, size_t size);
+  void closeIndexInterval(uint32_t nowMs);
+  void writeFooter(uint32_t nowMs);
 
-  File file_;
+  RecordFile file_;
+  RecordFile rawFile_;
+  RecordingJournal journal_;
+  SemaphoreHandle_t fileMutex_ = nullptr;
+  const RawSampleRing *rawSource_ = nullptr;
+  uint32_t rawCursor_ = 0;
+  uint16_t rawFrameCount_ = 0;
+  uint32_t nextSequence_ = 1;
+  uint32_t fileSequence_ = 0;
+  uint32_t commitSequence_ = 1;
+  uint32_t fileStartMs_ = 0;
+  uint32_t lastCommitMs_ = 0;
+  // Set by a rotation in append(), cleared by maintain().
+  bool reclaimPending_ = false;
+  uint64_t appendTotalUs_ = 0;
+  ergo::SummaryAccumulator minute_;
+  ergo::SummaryAccumulator fileSummary_;
+  ergo::SummaryAccumulator session_;
+  ergo::IntervalSummary *indexEntries_ = nullptr;
+  size_t indexCount_ = 0;
+  int32_t rawFrames_[cfg::kRawBlockFrames * ergo::kRawChannelCount] = {0};
+  uint8_t rawBlock_[ergo::kBlockHeaderSize +
+                    ergo::maxEncodedBlockSize(ergo::kRawChannelCount,
+                                              cfg::kRawBlockFrames)] = {0};
   portMUX_TYPE dataMux_ = portMUX_INITIALIZER_UNLOCKED;
   RecordingSnapshot snapshot_{};
+  // Open recording (0 = none) and its sizes as of the last commit, under
+  // dataMux_.
+  uint32_t activeSequence_ = 0;
+  uint32_t activeCsvBytes_ = 0;
+  uint32_t activeErgBytes_ = 0;
+  // Download in progress; transferSequence_ changes under fileMutex_, the
+  // rest belongs to the reading task.
+  uint32_t transferSequence_ = 0;
+  bool transferErg_ = false;
+  File transferFile_;
+  char transferPath_[40] = "";
+  uint32_t transferEnd_ = 0;
+  bool transferActive_ = false;
   bool mounted_ = false;
 };
@@ -2,6 +2,10 @@
 
 #include <Wire.h>
 
+#include <cstring>
+
+#include "logger.h"
+
 namespace {
 
 bool isValidDateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour,
@@ -12,6 +16,23 @@ bool isValidDateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour,
 
 }  // namespace
 
+uint32_t rtcSeconds(const RtcSnapshot &rtc) {
+  if (!rtc.valid) {
+    return 0;
+  }
+  // Days from civil date, shifted so March starts the year.
+  const int32_t year = static_cast<int32_t>(rtc.year) - (rtc.month <= 2U ? 1 : 0);
+  const int32_t era = year / 400;
+  const uint32_t yearOfEra = static_cast<uint32_t>(year - era * 400);
+  const uint32_t monthIndex = rtc.month > 2U ? rtc.month - 3U : rtc.month + 9U;
+  const uint32_t dayOfYear = (153U * monthIndex + 2U) / 5U + rtc.day - 1U;
+  const uint32_t dayOfEra =
+      yearOfEra * 365U + yearOfEra / 4U - yearOfEra / 100U + dayOfYear;
+  const int32_t days = era * 146097 + static_cast<int32_t>(dayOfEra) - 719468;
+  return static_cast<uint32_t>(days) * 86400U + rtc.hour * 3600U +
+         rtc.minute * 60U + rtc.second;
+}
+
 void RtcManager::begin() {
   if (g_i2cMutex != nullptr) {
     xSemaphoreTake(g_i2cMutex, portMAX_DELAY);
@@ -26,25 +47,13 @@ void RtcManager::begin() {
   }
 
   updateSnapshot(millis());
-  Serial.printf("RTC: PCF85063 %s on I2C address 0x%02X\n",
+  LOG_INFO(Rtc, "RTC: PCF85063 %s on I2C address 0x%02X",
                 available_ ? "initialized" : "not detected",
                 cfg::kPcf85063Address);
-  Serial.println("RTC command: RTC=YYYY-MM-DD HH:MM:SS");
+  LOG_INFO(Rtc, "RTC command: RTC=YYYY-MM-DD HH:MM:SS");
 }
 
 void RtcManager::poll() {
-  while (Serial.available() > 0) {
-    const char ch = static_cast<char>(Serial.read());
-    if (ch == '\n' || ch == '\r') {
-      if (serialBuffer_.length() > 0) {
-        parseSerialCommand(serialBuffer_);
-        serialBuffer_ = "";
-      }
-    } else if (serialBuffer_.length() < 40) {
-      serialBuffer_ += ch;
-    }
-  }
-
   const uint32_t nowMs = millis();
   if ((nowMs - lastPollMs_) >= cfg::kRtcPollPeriodMs) {
     updateSnapshot(nowMs);
@@ -119,28 +128,33 @@ bool RtcManager::setDateTime(uint16_t year, uint8_t month, uint8_t day,
   return true;
 }
 
-bool RtcManager::parseSerialCommand(const String &line) {
-  String command = line;
-  command.trim();
-  if (!command.startsWith("RTC=") && !command.startsWith("TIME=")) {
+bool RtcManager::isCommand(const char *line) {
+  return strncmp(line, "RTC=", 4) == 0 || strncmp(line, "TIME=", 5) == 0;
+}
+
+bool RtcManager::handleCommand(const char *line) {
+  if (!isCommand(line)) {
     return false;
   }
 
-  const int valueStart = command.indexOf('=') + 1;
   uint16_t year = 0;
   uint8_t month = 0;
   uint8_t day = 0;
   uint8_t hour = 0;
   uint8_t minute = 0;
   uint8_t second = 0;
-  if (!parseDateTime(command.c_str() + valueStart, year, month, day, hour,
-                     minute, second)) {
-    Serial.println("RTC set failed: use RTC=YYYY-MM-DD HH:MM:SS");
+  if (!parseDateTime(strchr(line, '=') + 1, year, month, day, hour, minute,
+                     second)) {
+    LOG_WARN(Rtc, "RTC set failed: use RTC=YYYY-MM-DD HH:MM:SS");
     return false;
   }
 
   const bool ok = setDateTime(year, month, day, hour, minute, second);
-  Serial.println(ok ? "RTC set OK" : "RTC set failed: PCF85063 unavailable");
+  if (ok) {
+    LOG_INFO(Rtc, "RTC set OK");
+  } else {
+    LOG_WARN(Rtc, "RTC set failed: PCF85063 unavailable");
+  }
   return ok;
 }
 
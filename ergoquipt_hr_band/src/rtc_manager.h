@@ -18,6 +18,9 @@ struct RtcSnapshot {
   char dateText[11] = "----/--/--";
 };
 
+// Wall clock as set on the RTC, in seconds since 1970-01-01; 0 when not valid.
+uint32_t rtcSeconds(const RtcSnapshot &rtc);
+
 class RtcManager {
  public:
   void begin();
@@ -26,9 +29,13 @@ class RtcManager {
   bool setDateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour,
                    uint8_t minute, uint8_t second);
   bool available() const;
+  // "RTC=YYYY-MM-DD HH:MM:SS" or "TIME=..." console commands.
+  static bool isCommand(const char *line);
+  // Sets the clock from a command line; false if it is not an RTC command,
+  // is malformed or the RTC is unavailable.
+  bool handleCommand(const char *line);
 
  private:
-  bool parseSerialCommand(const String &line);
   bool parseDateTime(const char *text, uint16_t &year, uint8_t &month,
                      uint8_t &day, uint8_t &hour, uint8_t &minute,
                      uint8_t &second) const;
@@ -37,7 +44,6 @@ class RtcManager {
   SensorPCF85063 rtc_;
   portMUX_TYPE dataMux_ = portMUX_INITIALIZER_UNLOCKED;
   RtcSnapshot snapshot_{};
-  String serialBuffer_;
   uint32_t lastPollMs_ = 0;
   bool available_ = false;
 };
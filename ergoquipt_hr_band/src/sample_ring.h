@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Single-producer broadcast ring. The producer never blocks; each consumer
+// keeps its own cursor and learns how many items it missed when it falls
+// N - 1 or more items behind. One slot is always held back because the
+// producer may be writing it.
+template <typename T, size_t N>
+class SampleRing {
+  static_assert((N & (N - 1U)) == 0U, "SampleRing size must be a power of two");
+
+ public:
+  void push(const T &item) {
+    const uint32_t head = head_.load(std::memory_order_relaxed);
+    items_[head & (N - 1U)] = item;
+    head_.store(head + 1U, std::memory_order_release);
+  }
+
+  uint32_t head() const { return head_.load(std::memory_order_acquire); }
+
+  size_t read(uint32_t &cursor, T *out, size_t maxCount,
+              uint32_t *dropped = nullptr) const {
+    constexpr uint32_t kReadable = static_cast<uint32_t>(N) - 1U;
+    const uint32_t head = head_.load(std::memory_order_acquire);
+    uint32_t lag = head - cursor;
+    if (lag > kReadable) {
+      if (dropped != nullptr) {
+        *dropped += lag - kReadable;
+      }
+      cursor = head - kReadable;
+      lag = kReadable;
+    }
+
+    size_t count = lag < maxCount ? lag : maxCount;
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = items_[(cursor + i) & (N - 1U)];
+    }
+
+    // Items the producer lapped, or may have been writing, while they were
+    // being copied are discarded. The fence keeps the copies before the load.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint32_t after = head_.load(std::memory_order_relaxed);
+    const uint32_t span = after - cursor;
+    if (span >= N) {
+      const size_t overwritten = span - static_cast<uint32_t>(N) + 1U;
+      const size_t skip = overwritten < count ? overwritten : count;
+      memmove(out, out + skip, (count - skip) * sizeof(T));
+      count -= skip;
+      cursor += static_cast<uint32_t>(overwritten);
+      if (dropped != nullptr) {
+        *dropped += static_cast<uint32_t>(overwritten);
+      }
+    }
+    cursor += static_cast<uint32_t>(count);
+    return count;
+  }
+
+ private:
+  T items_[N];
+  std::atomic<uint32_t> head_{0};
+};
@@ -5,6 +5,8 @@
 #include <algorithm>
 #include <cmath>
 
+#include "logger.h"
+
 namespace {
 
 uint32_t averageWindow(const uint32_t *buffer, size_t count) {
@@ -23,6 +25,10 @@ uint16_t clampU16(uint32_t value) {
   return static_cast<uint16_t>(std::min<uint32_t>(value, 0xFFFFU));
 }
 
+int16_t toMilliG(float g) {
+  return static_cast<int16_t>(constrain(lroundf(g * 1000.0f), -32768L, 32767L));
+}
+
 }  // namespace
 
 void SensorManager::CircularRriBuffer::push(uint16_t rri) {
@@ -79,12 +85,12 @@ void SensorManager::begin() {
   latest_.status = sensorReady_ ? 0 : cfg::kStatusSensorError;
 
   if (sensorReady_) {
-    Serial.printf("MAX3010x initialized, part_id=0x%02X\n", partId_);
+    LOG_INFO(Sensor, "MAX3010x initialized, part_id=0x%02X", partId_);
   } else {
-    Serial.println("MAX3010x init failed on I2C address 0x57");
+    LOG_ERROR(Sensor, "MAX3010x init failed on I2C address 0x57");
   }
-  Serial.printf("QMI8658 IMU %s on I2C address 0x%02X\n",
-                imuReady_ ? "initialized" : "not detected", cfg::kQmi8658Address);
+  LOG_INFO(Sensor, "QMI8658 IMU %s on I2C address 0x%02X",
+                   imuReady_ ? "initialized" : "not detected", cfg::kQmi8658Address);
 }
 
 bool SensorManager::initSensor() {
@@ -129,7 +135,7 @@ bool SensorManager::initImu() {
 }
 
 void SensorManager::scanI2cBus() {
-  Serial.printf("I2C scan on SDA=%d SCL=%d\n", cfg::kI2cSdaPin, cfg::kI2cSclPin);
+  LOG_INFO(Sensor, "I2C scan on SDA=%d SCL=%d", cfg::kI2cSdaPin, cfg::kI2cSclPin);
 
   if (g_i2cMutex != nullptr) {
     xSemaphoreTake(g_i2cMutex, portMAX_DELAY);
@@ -140,7 +146,7 @@ void SensorManager::scanI2cBus() {
     Wire.beginTransmission(address);
     if (Wire.endTransmission() == 0) {
       ++foundCount;
-      Serial.printf("  I2C device found at 0x%02X\n", address);
+      LOG_INFO(Sensor, "  I2C device found at 0x%02X", address);
     }
   }
 
@@ -149,7 +155,7 @@ void SensorManager::scanI2cBus() {
   }
 
   if (foundCount == 0) {
-    Serial.println("  No I2C devices detected");
+    LOG_INFO(Sensor, "  No I2C devices detected");
   }
 }
 
@@ -192,7 +198,7 @@ void SensorManager::sample() {
   if (!readSample(ir, red)) {
     if ((nowMs - lastDebugLogMs_) >= 1000U) {
       lastDebugLogMs_ = nowMs;
-      Serial.println("MAX3010x: no FIFO sample available");
+      LOG_WARN(Sensor, "MAX3010x: no FIFO sample available");
     }
     return;
   }
@@ -200,14 +206,15 @@ void SensorManager::sample() {
   lastIrSample_ = ir;
   lastRedSample_ = red;
   sampleMotion(nowMs);
+  pushRawSample(nowMs, ir, red);
   processSignals(nowMs, ir, red);
 
   if ((nowMs - lastDebugLogMs_) >= 1000U) {
     lastDebugLogMs_ = nowMs;
     const VitalData snapshot = latest();
-    Serial.printf(
+    LOG_INFO(Sensor,
         "Vitals hr=%u spo2=%u.%02u rri=%u hrv=%u status=0x%02X ir=%lu red=%lu "
-        "finger=%s sensor=%s part=0x%02X mode=%s motion=%.3f imu=%s peak=%u rri_ok=%u\n",
+        "finger=%s sensor=%s part=0x%02X mode=%s motion=%.3f imu=%s peak=%u rri_ok=%u",
         snapshot.hr, snapshot.spo2_x100 / 100U, snapshot.spo2_x100 % 100U,
         snapshot.rri, snapshot.hrv, snapshot.status,
         static_cast<unsigned long>(lastIrSample_),
@@ -218,6 +225,8 @@ void SensorManager::sample() {
   }
 }
 
+void SensorManager::setEventTask(TaskHandle_t task) { eventTask_ = task; }
+
 void SensorManager::setEnabled(bool enabled) {
   if (enabled_ == enabled) {
     return;
@@ -275,6 +284,17 @@ void SensorManager::sampleMotion(uint32_t nowMs) {
   motionScore_ = motionScore_ * 0.85f + delta * 0.15f;
 }
 
+void SensorManager::pushRawSample(uint32_t nowMs, uint32_t ir, uint32_t red) {
+  RawSample sample;
+  sample.timestampMs = nowMs;
+  sample.ir = ir;
+  sample.red = red;
+  sample.accelXmg = toMilliG(accelX_);
+  sample.accelYmg = toMilliG(accelY_);
+  sample.accelZmg = toMilliG(accelZ_);
+  rawSamples_.push(sample);
+}
+
 void SensorManager::processSignals(uint32_t nowMs, uint32_t ir, uint32_t red) {
   irWindow_[signalIndex_] = ir;
   redWindow_[signalIndex_] = red;
@@ -309,6 +329,7 @@ void SensorManager::processSignals(uint32_t nowMs, uint32_t ir, uint32_t red) {
     baselineIr_ = static_cast<uint32_t>((baselineIr_ * 31U + filteredIr) / 32U);
   }
 
+  const bool wasFingerPresent = fingerPresent_;
   fingerPresent_ = filteredIr > cfg::kFingerIrThreshold;
   const int32_t derivative =
       static_cast<int32_t>(filteredIr) - static_cast<int32_t>(lastFilteredIr_);
@@ -320,6 +341,14 @@ void SensorManager::processSignals(uint32_t nowMs, uint32_t ir, uint32_t red) {
   previousDerivative_ = derivative;
   ++sampleCounter_;
 
+  WaveformSample point;
+  point.timestampMs = nowMs;
+  point.ac = static_cast<int32_t>(filteredIr) - static_cast<int32_t>(baselineIr_);
+  point.flags = static_cast<uint8_t>((peakDetected ? cfg::kWaveformPeak : 0U) |
+                                     (rriAccepted ? cfg::kWaveformBeat : 0U) |
+                                     (fingerPresent_ ? cfg::kWaveformFinger : 0U));
+  waveform_.push(point);
+
   VitalData updated = latest();
   updated.status = 0;
 
@@ -347,6 +376,9 @@ void SensorManager::processSignals(uint32_t nowMs, uint32_t ir, uint32_t red) {
     diagnostics_.motionState = highMotion() ? 2U : (motionStable() ? 0U : 1U);
     latest_ = updated;
     portEXIT_CRITICAL(&dataMux_);
+    if (fingerPresent_ != wasFingerPresent && eventTask_ != nullptr) {
+      xTaskNotifyGive(eventTask_);
+    }
     return;
   } else {
     if (updatesSpo2DuringMotion() || motionStable()) {
@@ -380,8 +412,10 @@ void SensorManager::processSignals(uint32_t nowMs, uint32_t ir, uint32_t red) {
   diagnostics_.motionState = highMotion() ? 2U : (motionStable() ? 0U : 1U);
   latest_ = updated;
   portEXIT_CRITICAL(&dataMux_);
+  if ((rriAccepted || fingerPresent_ != wasFingerPresent) && eventTask_ != nullptr) {
+    xTaskNotifyGive(eventTask_);
+  }
 
-  (void)peakDetected;
   (void)filteredRed;
 }
 
@@ -438,6 +472,11 @@ bool SensorManager::detectPeak(uint32_t nowMs, uint32_t filteredIr,
   latest_.hrv = rmssd;
   portEXIT_CRITICAL(&dataMux_);
 
+  BeatEvent beat;
+  beat.timestampMs = nowMs;
+  beat.rriMs = static_cast<uint16_t>(rri);
+  beats_.push(beat);
+
   lastPeakMs_ = nowMs;
   lastPeakAmplitude_ = amplitude;
   lastAcceptedRriMs_ = nowMs;
@@ -530,7 +569,7 @@ void SensorManager::setFilteringMode(FilteringMode mode) {
   portENTER_CRITICAL(&dataMux_);
   filteringMode_ = mode;
   portEXIT_CRITICAL(&dataMux_);
-  Serial.printf("Sensor: filtering mode=%s\n", modeName());
+  LOG_INFO(Sensor, "Sensor: filtering mode=%s", modeName());
 }
 
 FilteringMode SensorManager::filteringMode() const {
@@ -591,3 +630,9 @@ uint32_t SensorManager::lastIrSample() const { return lastIrSample_; }
 uint32_t SensorManager::lastRedSample() const { return lastRedSample_; }
 
 uint8_t SensorManager::partId() const { return partId_; }
+
+const RawSampleRing &SensorManager::rawSamples() const { return rawSamples_; }
+
+const BeatRing &SensorManager::beats() const { return beats_; }
+
+const WaveformRing &SensorManager::waveform() const { return waveform_; }
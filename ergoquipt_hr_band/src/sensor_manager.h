@@ -5,12 +5,20 @@
 #include <SensorQMI8658.hpp>
 
 #include "config.h"
+#include "sample_ring.h"
+
+using RawSampleRing = SampleRing<RawSample, cfg::kRawSampleRingSize>;
+using BeatRing = SampleRing<BeatEvent, cfg::kBeatRingSize>;
+using WaveformRing = SampleRing<WaveformSample, cfg::kWaveformRingSize>;
 
 class SensorManager {
  public:
   void begin();
   void sample();
   void setEnabled(bool enabled);
+  // The task gets a task notification on every accepted beat and finger
+  // on/off transition.
+  void setEventTask(TaskHandle_t task);
   void setFilteringMode(FilteringMode mode);
   FilteringMode filteringMode() const;
   VitalData latest() const;
@@ -21,6 +29,11 @@ class SensorManager {
   uint32_t lastIrSample() const;
   uint32_t lastRedSample() const;
   uint8_t partId() const;
+  const RawSampleRing &rawSamples() const;
+  // Every accepted RR interval, in order.
+  const BeatRing &beats() const;
+  // Every processed sample, baseline-removed, for the live trace.
+  const WaveformRing &waveform() const;
 
  private:
   struct CircularRriBuffer {
@@ -34,6 +47,7 @@ class SensorManager {
   };
 
   bool initSensor();
+  void pushRawSample(uint32_t nowMs, uint32_t ir, uint32_t red);
   bool initImu();
   void scanI2cBus();
   bool readSample(uint32_t &ir, uint32_t &red);
@@ -58,6 +72,9 @@ class SensorManager {
   FilteringMode filteringMode_ = FilteringMode::M2MotionAdaptive;
 
   CircularRriBuffer rriBuffer_;
+  RawSampleRing rawSamples_;
+  BeatRing beats_;
+  WaveformRing waveform_;
   uint32_t irWindow_[cfg::kSignalWindowSize] = {0};
   uint32_t redWindow_[cfg::kSignalWindowSize] = {0};
   uint32_t spo2IrWindow_[cfg::kSpo2WindowSize] = {0};
@@ -90,4 +107,5 @@ class SensorManager {
   bool imuReady_ = false;
   bool fingerPresent_ = false;
   bool enabled_ = true;
+  TaskHandle_t eventTask_ = nullptr;
 };
@@ -0,0 +1,248 @@
+#include "trend_store.h"
+
+#include <algorithm>
+
+#include "logger.h"
+
+namespace {
+
+constexpr uint32_t kTierBucketMs[] = {1000U, 60U * 1000U, 60U * 60U * 1000U};
+constexpr uint32_t kTierCapacity[] = {cfg::kTrendSecondBuckets, cfg::kTrendMinuteBuckets,
+                                      cfg::kTrendHourBuckets};
+
+// Signed distance that stays right across the millis() wrap.
+int32_t since(uint32_t laterMs, uint32_t earlierMs) {
+  return static_cast<int32_t>(laterMs - earlierMs);
+}
+
+void mergeStat(TrendStat &into, const TrendStat &from) {
+  if (from.count == 0U) {
+    return;
+  }
+  if (into.count == 0U) {
+    into = from;
+    return;
+  }
+  const uint64_t total = static_cast<uint64_t>(into.count) + from.count;
+  into.mean = static_cast<uint16_t>(
+      ((static_cast<uint64_t>(into.mean) * into.count) +
+       (static_cast<uint64_t>(from.mean) * from.count) + (total / 2U)) /
+      total);
+  into.min = std::min(into.min, from.min);
+  into.max = std::max(into.max, from.max);
+  into.count = static_cast<uint32_t>(total);
+}
+
+}  // namespace
+
+void TrendStore::OpenBucket::start(uint32_t bucketStartMs) {
+  open = true;
+  startMs = bucketStartMs;
+  for (size_t m = 0; m < kMetricCount; ++m) {
+    min[m] = UINT16_MAX;
+    max[m] = 0;
+    sum[m] = 0;
+    count[m] = 0;
+  }
+}
+
+void TrendStore::OpenBucket::add(const Bucket &bucket) {
+  for (size_t m = 0; m < kMetricCount; ++m) {
+    const TrendStat &stat = bucket.stats[m];
+    if (stat.count == 0U) {
+      continue;
+    }
+    min[m] = std::min(min[m], stat.min);
+    max[m] = std::max(max[m], stat.max);
+    sum[m] += static_cast<uint32_t>(stat.mean) * stat.count;
+    count[m] += stat.count;
+  }
+}
+
+TrendStore::Bucket TrendStore::OpenBucket::close() const {
+  Bucket bucket;
+  bucket.startMs = startMs;
+  for (size_t m = 0; m < kMetricCount; ++m) {
+    if (count[m] == 0U) {
+      continue;
+    }
+    bucket.stats[m].min = min[m];
+    bucket.stats[m].max = max[m];
+    bucket.stats[m].mean = static_cast<uint16_t>((sum[m] + (count[m] / 2U)) / count[m]);
+    bucket.stats[m].count = count[m];
+  }
+  return bucket;
+}
+
+void TrendStore::Tier::push(const Bucket &bucket) {
+  if (capacity == 0U) {
+    return;
+  }
+  buckets[head % capacity] = bucket;
+  ++head;
+}
+
+uint32_t TrendStore::Tier::size() const { return std::min(head, capacity); }
+
+const TrendStore::Bucket &TrendStore::Tier::at(uint32_t index) const {
+  return buckets[(head - size() + index) % capacity];
+}
+
+// Index of the oldest kept bucket that ends after `afterMs`.
+uint32_t TrendStore::Tier::firstEnding(uint32_t afterMs) const {
+  uint32_t low = 0;
+  uint32_t high = size();
+  while (low < high) {
+    const uint32_t middle = low + ((high - low) / 2U);
+    if (since(at(middle).startMs + bucketMs, afterMs) > 0) {
+      high = middle;
+    } else {
+      low = middle + 1U;
+    }
+  }
+  return low;
+}
+
+void TrendStore::begin() {
+  mutex_ = xSemaphoreCreateMutex();
+  for (size_t t = 0; t < kTierCount; ++t) {
+    Tier &tier = tiers_[t];
+    tier.bucketMs = kTierBucketMs[t];
+    tier.capacity = kTierCapacity[t];
+    tier.buckets = static_cast<Bucket *>(ps_malloc(tier.capacity * sizeof(Bucket)));
+    if (tier.buckets == nullptr) {
+      tier.capacity = cfg::kTrendFallbackBuckets;
+      tier.buckets = static_cast<Bucket *>(malloc(tier.capacity * sizeof(Bucket)));
+    }
+    if (tier.buckets == nullptr) {
+      tier.capacity = 0;
+    }
+  }
+  LOG_INFO(History, "Trends: %lu s / %lu min / %lu h buckets",
+           static_cast<unsigned long>(tiers_[0].capacity),
+           static_cast<unsigned long>(tiers_[1].capacity),
+           static_cast<unsigned long>(tiers_[2].capacity));
+}
+
+void TrendStore::append(uint32_t nowMs, const VitalData &data, uint16_t motionX1000) {
+  const bool vitalsValid = (data.status & cfg::kStatusVitalsValid) != 0U;
+  const uint16_t values[kMetricCount] = {
+      vitalsValid ? data.hr : static_cast<uint16_t>(0),
+      vitalsValid ? data.spo2_x100 : static_cast<uint16_t>(0),
+      (data.status & cfg::kStatusRriValid) != 0U ? data.rri : static_cast<uint16_t>(0),
+      (data.status & cfg::kStatusHrvValid) != 0U ? data.hrv : static_cast<uint16_t>(0),
+      motionX1000,
+  };
+  Bucket sample;
+  sample.startMs = nowMs;
+  for (size_t m = 0; m < kMetricCount; ++m) {
+    if (values[m] > 0U || m == static_cast<size_t>(TrendMetric::Motion)) {
+      sample.stats[m] = {values[m], values[m], values[m], 1U};
+    }
+  }
+
+  lock();
+  roll(nowMs);
+  tiers_[0].push(sample);
+  OpenBucket &minute = tiers_[1].pending;
+  if (!minute.open) {
+    minute.start(nowMs - (nowMs % tiers_[1].bucketMs));
+  }
+  minute.add(sample);
+  unlock();
+}
+
+// Closes every open bucket whose period has ended and folds it into the
+// next tier up, lowest tier first so an hour sees its last minute.
+void TrendStore::roll(uint32_t nowMs) {
+  for (size_t t = 1; t < kTierCount; ++t) {
+    Tier &tier = tiers_[t];
+    if (!tier.pending.open ||
+        since(nowMs, tier.pending.startMs) < static_cast<int32_t>(tier.bucketMs)) {
+      continue;
+    }
+    const Bucket closed = tier.pending.close();
+    tier.pending.open = false;
+    tier.push(closed);
+    if (t + 1U < kTierCount) {
+      OpenBucket &up = tiers_[t + 1U].pending;
+      if (!up.open) {
+        up.start(closed.startMs - (closed.startMs % tiers_[t + 1U].bucketMs));
+      }
+      up.add(closed);
+    }
+  }
+}
+
+// The coarsest tier whose buckets still fit inside one slot: every slot
+// then merges fewer than 60 buckets, and coarser tiers reach further back.
+size_t TrendStore::pickTier(uint32_t slotMs) const {
+  size_t picked = 0;
+  for (size_t t = 1; t < kTierCount; ++t) {
+    if (tiers_[t].bucketMs <= slotMs) {
+      picked = t;
+    }
+  }
+  return picked;
+}
+
+uint32_t TrendStore::query(TrendMetric metric, uint32_t fromMs, uint32_t toMs, TrendStat *out,
+                           size_t points) const {
+  if (points == 0U || since(toMs, fromMs) <= 0) {
+    return 0;
+  }
+  const uint32_t slotMs = std::max<uint32_t>((toMs - fromMs) / points, 1U);
+  const size_t m = static_cast<size_t>(metric);
+  std::fill(out, out + points, TrendStat{});
+
+  auto place = [&](const Bucket &bucket) {
+    const int32_t offset = since(bucket.startMs, fromMs);
+    const size_t slot =
+        offset <= 0 ? 0U : std::min<size_t>(static_cast<uint32_t>(offset) / slotMs, points - 1U);
+    mergeStat(out[slot], bucket.stats[m]);
+  };
+
+  lock();
+  const size_t picked = pickTier(slotMs);
+  const Tier &tier = tiers_[picked];
+  if (tier.capacity == 0U) {
+    unlock();
+    return 0;
+  }
+  for (uint32_t i = tier.firstEnding(fromMs); i < tier.size(); ++i) {
+    const Bucket &bucket = tier.at(i);
+    if (since(bucket.startMs, toMs) >= 0) {
+      break;
+    }
+    place(bucket);
+  }
+  // Data newer than the tier's last closed bucket is still in the open
+  // buckets of this tier and the ones below it.
+  for (size_t t = picked; t > 0U; --t) {
+    const OpenBucket &pending = tiers_[t].pending;
+    if (pending.open && since(pending.startMs, toMs) < 0 &&
+        since(pending.startMs + tiers_[t].bucketMs, fromMs) > 0) {
+      place(pending.close());
+    }
+  }
+  unlock();
+  return slotMs;
+}
+
+TrendStat TrendStore::summarize(TrendMetric metric, uint32_t fromMs, uint32_t toMs) const {
+  TrendStat stat;
+  query(metric, fromMs, toMs, &stat, 1);
+  return stat;
+}
+
+void TrendStore::lock() const {
+  if (mutex_ != nullptr) {
+    xSemaphoreTake(mutex_, portMAX_DELAY);
+  }
+}
+
+void TrendStore::unlock() const {
+  if (mutex_ != nullptr) {
+    xSemaphoreGive(mutex_);
+  }
+}
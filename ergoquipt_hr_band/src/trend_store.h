@@ -0,0 +1,79 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "config.h"
+
+// Min/max/mean of one metric over a bucket or a query slot. count = 0 means
+// no valid reading fell in it.
+struct TrendStat {
+  uint16_t min = 0;
+  uint16_t max = 0;
+  uint16_t mean = 0;
+  uint32_t count = 0;
+};
+
+// Vitals trends at three resolutions. The 1 Hz tick lands in the 1 s tier;
+// each closed minute is folded into the 1 min tier and each closed hour into
+// the 1 h tier, so a range query reads the coarsest tier that still gives
+// every output slot its own data, and its cost follows the number of points
+// asked for rather than the length of the range. Tiers live in PSRAM and
+// survive page changes and soft sleep; times are millis().
+class TrendStore {
+ public:
+  void begin();
+  // Vitals without their valid flag are left out of the stats; motion
+  // always counts.
+  void append(uint32_t nowMs, const VitalData &data, uint16_t motionX1000);
+  // Splits [fromMs, toMs) into `points` equal slots and fills one stat per
+  // slot. Returns the slot width in ms, or 0 if nothing could be read.
+  uint32_t query(TrendMetric metric, uint32_t fromMs, uint32_t toMs, TrendStat *out,
+                 size_t points) const;
+  // One stat over the whole range.
+  TrendStat summarize(TrendMetric metric, uint32_t fromMs, uint32_t toMs) const;
+
+ private:
+  static constexpr size_t kTierCount = 3;
+  static constexpr size_t kMetricCount = static_cast<size_t>(TrendMetric::Count);
+
+  struct Bucket {
+    uint32_t startMs = 0;
+    TrendStat stats[kMetricCount];
+  };
+
+  // The bucket a tier is still filling.
+  struct OpenBucket {
+    bool open = false;
+    uint32_t startMs = 0;
+    uint16_t min[kMetricCount];
+    uint16_t max[kMetricCount];
+    uint32_t sum[kMetricCount];
+    uint32_t count[kMetricCount];
+
+    void start(uint32_t bucketStartMs);
+    void add(const Bucket &bucket);
+    Bucket close() const;
+  };
+
+  struct Tier {
+    Bucket *buckets = nullptr;
+    uint32_t capacity = 0;
+    // Buckets ever pushed; the oldest kept is head - min(head, capacity).
+    uint32_t head = 0;
+    uint32_t bucketMs = 0;
+    OpenBucket pending;
+
+    void push(const Bucket &bucket);
+    uint32_t size() const;
+    const Bucket &at(uint32_t index) const;
+    uint32_t firstEnding(uint32_t afterMs) const;
+  };
+
+  void lock() const;
+  void unlock() const;
+  void roll(uint32_t nowMs);
+  size_t pickTier(uint32_t slotMs) const;
+
+  Tier tiers_[kTierCount];
+  SemaphoreHandle_t mutex_ = nullptr;
+};
@@ -0,0 +1,36 @@
+#include "ui_events.h"
+
+namespace {
+
+QueueHandle_t g_events = nullptr;
+
+}  // namespace
+
+void uiEventsBegin() {
+  if (g_events == nullptr) {
+    g_events = xQueueCreate(cfg::kUiEventQueueDepth, sizeof(UiEvent));
+  }
+}
+
+void uiPostEvent(UiEvent event) {
+  if (g_events != nullptr) {
+    xQueueSend(g_events, &event, 0);
+  }
+}
+
+bool IRAM_ATTR uiPostEventFromIsr(UiEvent event) {
+  BaseType_t woken = pdFALSE;
+  if (g_events != nullptr) {
+    xQueueSendFromISR(g_events, &event, &woken);
+  }
+  return woken == pdTRUE;
+}
+
+bool uiWaitEvent(UiEvent &event, uint32_t timeoutMs) {
+  const TickType_t ticks = timeoutMs == kUiWaitForever ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+  if (g_events == nullptr) {
+    vTaskDelay(ticks);
+    return false;
+  }
+  return xQueueReceive(g_events, &event, ticks) == pdTRUE;
+}
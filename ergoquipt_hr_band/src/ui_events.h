@@ -0,0 +1,20 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "config.h"
+
+// Change notifications for ui_task. Subsystems post what changed and the UI
+// task blocks on the queue between LVGL deadlines instead of polling every
+// manager. Posting never blocks: a full queue drops the event, which only
+// delays the refresh because the UI reads current state when it wakes.
+
+// uiWaitEvent timeout that only returns on an event.
+constexpr uint32_t kUiWaitForever = UINT32_MAX;
+
+void uiEventsBegin();
+void uiPostEvent(UiEvent event);
+// ISR variant; true when a higher-priority task was woken.
+bool uiPostEventFromIsr(UiEvent event);
+// Waits up to `timeoutMs` for the next event; 0 only drains.
+bool uiWaitEvent(UiEvent &event, uint32_t timeoutMs);
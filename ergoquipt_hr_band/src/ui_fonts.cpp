@@ -0,0 +1,50 @@
+#include "ui_fonts.h"
+
+#include "config.h"
+#include "glyph_cache_font.h"
+#include "logger.h"
+
+#if defined(ERGO_SUBSET_FONTS)
+LV_FONT_DECLARE(ergo_font_16)
+LV_FONT_DECLARE(ergo_font_20)
+LV_FONT_DECLARE(ergo_font_28)
+LV_FONT_DECLARE(ergo_font_48)
+#define ERGO_FONT(size) (&ergo_font_##size)
+#else
+#define ERGO_FONT(size) (&lv_font_montserrat_##size)
+#endif
+
+namespace {
+
+constexpr char kHeroGlyphs[] = "0123456789-";
+constexpr char kValueGlyphs[] = "0123456789-%ms";
+
+GlyphCacheFont g_heroFont;
+GlyphCacheFont g_valueFont;
+
+}  // namespace
+
+void uiFontsBegin() {
+  g_heroFont.begin(ERGO_FONT(48), cfg::kUiGlyphCache ? kHeroGlyphs : "");
+  g_valueFont.begin(ERGO_FONT(28), cfg::kUiGlyphCache ? kValueGlyphs : "");
+  if (cfg::kUiGlyphCache) {
+    LOG_INFO(Ui, "Fonts: %u B of cached numeral glyphs",
+             static_cast<unsigned>(g_heroFont.cachedBytes() + g_valueFont.cachedBytes()));
+  }
+}
+
+const lv_font_t *uiFont(UiFont font) {
+  switch (font) {
+    case UiFont::Small:
+      return &lv_font_montserrat_14;
+    case UiFont::Body:
+      return ERGO_FONT(16);
+    case UiFont::Title:
+      return ERGO_FONT(20);
+    case UiFont::Value:
+      return g_valueFont.font() != nullptr ? g_valueFont.font() : ERGO_FONT(28);
+    case UiFont::Hero:
+      return g_heroFont.font() != nullptr ? g_heroFont.font() : ERGO_FONT(48);
+  }
+  return &lv_font_montserrat_14;
+}
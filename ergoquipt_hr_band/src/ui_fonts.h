@@ -0,0 +1,18 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Text sizes the UI uses. Built with ERGO_SUBSET_FONTS, the sizes above 14
+// come from tables tools/fonts/build_fonts.py cuts down to the glyphs in
+// the UI sources; otherwise from LVGL's full Montserrat builds.
+enum class UiFont : uint8_t {
+  Small,  // 14
+  Body,   // 16
+  Title,  // 20
+  Value,  // 28, the SpO2/RRI/HRV values
+  Hero,   // 48, the heart rate
+};
+
+// Sets up the glyph caches for the numerals redrawn every second.
+void uiFontsBegin();
+const lv_font_t *uiFont(UiFont font);
@@ -1,24 +1,34 @@
 #include "ui_manager.h"
 
-#include <Arduino_GFX_Library.h>
 #include <Wire.h>
-#include <esp_heap_caps.h>
+#include <esp_timer.h>
 
 #include <algorithm>
 #include <cstdio>
 #include <cstring>
 
+#include <recording_format.h>
+
+#include "display_panel.h"
+#include "logger.h"
 #include "logo_asset.h"
+#include "ui_events.h"
+#include "ui_fonts.h"
 
 namespace {
 
-Arduino_DataBus *g_bus = nullptr;
-Arduino_GFX *g_gfx = nullptr;
+DisplayPanel g_panel;
 lv_disp_draw_buf_t g_drawBuf;
-lv_color_t *g_buf1 = nullptr;
-lv_color_t *g_buf2 = nullptr;
-
-constexpr size_t kDrawBufferLines = 40;
+// Panel stats taken each perf window, summed for the periodic log line.
+DisplayStats g_logDisplayStats;
+constexpr uint8_t kDirtyStatus = 1U << 0;
+constexpr uint8_t kDirtyVitals = 1U << 1;
+constexpr uint8_t kPageDevice = 3;
+constexpr uint8_t kPageWave = 4;
+constexpr uint32_t kTrendRangesMs[] = {5U * 60U * 1000U, 60U * 60U * 1000U,
+                                       24U * 60U * 60U * 1000U, 7U * 24U * 60U * 60U * 1000U};
+const char *const kTrendRangeNames[] = {"5 min", "1 hour", "24 hours", "7 days"};
+constexpr uint8_t kTrendRangeCount = sizeof(kTrendRangesMs) / sizeof(kTrendRangesMs[0]);
 constexpr uint8_t kFt3168RegNumTouches = 0x02;
 constexpr uint8_t kFt3168RegXHigh = 0x03;
 
@@ -88,26 +98,61 @@ bool readTouchPoint(uint16_t &x, uint16_t &y) {
   return true;
 }
 
-void displayFlush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *colorP) {
-  const uint16_t width = static_cast<uint16_t>(area->x2 - area->x1 + 1);
-  const uint16_t height = static_cast<uint16_t>(area->y2 - area->y1 + 1);
-
-  g_gfx->draw16bitRGBBitmap(area->x1, area->y1,
-                            reinterpret_cast<uint16_t *>(colorP), width, height);
-  lv_disp_flush_ready(disp);
+struct TouchPoint {
+  uint16_t x = 0;
+  uint16_t y = 0;
+  bool pressed = false;
+};
+
+// Set by the FT3168 interrupt, cleared when ui_task reads the controller.
+volatile bool g_touchPending = false;
+// Points ui_task read after an interrupt, waiting for LVGL's read callback.
+// Both ends run on ui_task.
+TouchPoint g_touchQueue[cfg::kTouchQueueDepth];
+size_t g_touchHead = 0;
+size_t g_touchCount = 0;
+// Last point read from the controller and last one handed to LVGL.
+TouchPoint g_touchRead;
+TouchPoint g_touchReported;
+
+void queueTouch(const TouchPoint &point) {
+  if (g_touchCount == cfg::kTouchQueueDepth) {
+    // Keep the newest state; losing a move in between is harmless.
+    g_touchQueue[(g_touchHead + g_touchCount - 1U) % cfg::kTouchQueueDepth] = point;
+    return;
+  }
+  g_touchQueue[(g_touchHead + g_touchCount) % cfg::kTouchQueueDepth] = point;
+  ++g_touchCount;
 }
 
+// Never touches I2C: replays the points read after interrupts and otherwise
+// repeats the last state. The read timer only runs while a touch is in
+// progress or points are queued.
 void touchRead(lv_indev_drv_t *drv, lv_indev_data_t *data) {
-  uint16_t x = 0;
-  uint16_t y = 0;
-  if (readTouchPoint(x, y)) {
-    data->state = LV_INDEV_STATE_PRESSED;
-    data->point.x = x;
-    data->point.y = y;
-  } else {
-    data->state = LV_INDEV_STATE_RELEASED;
+  if (g_touchCount > 0U) {
+    g_touchReported = g_touchQueue[g_touchHead];
+    g_touchHead = (g_touchHead + 1U) % cfg::kTouchQueueDepth;
+    --g_touchCount;
+  }
+  data->point.x = static_cast<lv_coord_t>(g_touchReported.x);
+  data->point.y = static_cast<lv_coord_t>(g_touchReported.y);
+  data->state = g_touchReported.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+  data->continue_reading = g_touchCount > 0U;
+  if (!g_touchReported.pressed && g_touchCount == 0U) {
+    lv_timer_pause(drv->read_timer);
+  }
+}
+
+// The controller pulses INT for every report while a finger is down; only
+// the first edge before ui_task gets round to reading posts an event.
+void IRAM_ATTR onTouchInterrupt() {
+  if (g_touchPending) {
+    return;
+  }
+  g_touchPending = true;
+  if (uiPostEventFromIsr(UiEvent::Input)) {
+    portYIELD_FROM_ISR();
   }
-  (void)drv;
 }
 
 lv_obj_t *createCard(lv_obj_t *parent, lv_coord_t width, lv_coord_t height) {
@@ -133,7 +178,7 @@ lv_obj_t *createCardTitle(lv_obj_t *card, const char *title, const char *icon,
   lv_label_set_text(label, text);
   lv_obj_align(label, LV_ALIGN_TOP_LEFT, 0, 0);
   lv_obj_set_style_text_color(label, color, 0);
-  lv_obj_set_style_text_font(label, &lv_font_montserrat_16, 0);
+  lv_obj_set_style_text_font(label, uiFont(UiFont::Body), 0);
   return label;
 }
 
@@ -147,7 +192,7 @@ lv_obj_t *createNavButton(lv_obj_t *parent, const char *text) {
   lv_obj_t *label = lv_label_create(button);
   lv_label_set_text(label, text);
   lv_obj_center(label);
-  lv_obj_set_style_text_font(label, &lv_font_montserrat_16, 0);
+  lv_obj_set_style_text_font(label, uiFont(UiFont::Body), 0);
   lv_obj_set_style_text_color(label, lv_color_hex(0xAAB4C3), 0);
   return button;
 }
@@ -159,7 +204,7 @@ lv_obj_t *createTrendChart(lv_obj_t *card, lv_color_t color,
   lv_obj_set_size(chart, 132, 48);
   lv_obj_align(chart, LV_ALIGN_BOTTOM_MID, 0, 0);
   lv_chart_set_type(chart, LV_CHART_TYPE_LINE);
-  lv_chart_set_point_count(chart, cfg::kTrendBufferSize);
+  lv_chart_set_point_count(chart, cfg::kTrendChartPoints);
   lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, minValue, maxValue);
   lv_obj_set_style_bg_opa(chart, LV_OPA_TRANSP, 0);
   lv_obj_set_style_border_width(chart, 0, 0);
@@ -169,53 +214,97 @@ lv_obj_t *createTrendChart(lv_obj_t *card, lv_color_t color,
   return chart;
 }
 
-}  // namespace
+void addDisplayStats(DisplayStats &total, const DisplayStats &window) {
+  total.flushes += window.flushes;
+  total.flushBytes += window.flushBytes;
+  total.flushUsTotal += window.flushUsTotal;
+  total.flushUsMax = std::max(total.flushUsMax, window.flushUsMax);
+  total.submitUsTotal += window.submitUsTotal;
+  total.waitUsTotal += window.waitUsTotal;
+}
 
-void UiManager::begin() {
-  pinMode(cfg::kTouchIntPin, INPUT_PULLUP);
+// "ui_task" -> "ui" for the overlay's stack list.
+void appendTaskStack(char *text, size_t size, const TaskStackStat &task) {
+  char name[cfg::kPerfTaskNameBytes];
+  strncpy(name, task.name, sizeof(name) - 1U);
+  name[sizeof(name) - 1U] = '\0';
+  char *suffix = strstr(name, "_task");
+  if (suffix != nullptr && suffix[5] == '\0') {
+    *suffix = '\0';
+  }
+  const size_t length = strlen(text);
+  snprintf(text + length, size - length, "%s%s:%lu.%luK", length > 0U ? "  " : "", name,
+           static_cast<unsigned long>(task.minFreeBytes / 1024U),
+           static_cast<unsigned long>((task.minFreeBytes % 1024U) * 10U / 1024U));
+}
 
-  g_bus = new Arduino_ESP32QSPI(cfg::kDisplayCsPin, cfg::kDisplaySckPin,
-                                cfg::kDisplayD0Pin, cfg::kDisplayD1Pin,
-                                cfg::kDisplayD2Pin, cfg::kDisplayD3Pin);
-  g_gfx = new Arduino_SH8601(g_bus, -1, 0, cfg::kDisplayWidth,
-                             cfg::kDisplayHeight);
+// One chart point per slot mean; empty slots leave a gap in the line.
+void fillTrendChart(lv_obj_t *chart, lv_chart_series_t *series, const TrendStore &store,
+                    TrendMetric metric, uint32_t rangeMs, uint32_t nowMs, uint16_t divisor) {
+  TrendStat stats[cfg::kTrendChartPoints];
+  store.query(metric, nowMs - rangeMs, nowMs, stats, cfg::kTrendChartPoints);
+  for (uint16_t i = 0; i < cfg::kTrendChartPoints; ++i) {
+    lv_chart_set_value_by_id(chart, series, i,
+                             stats[i].count > 0U ? static_cast<lv_coord_t>(stats[i].mean / divisor)
+                                                 : LV_CHART_POINT_NONE);
+  }
+  lv_chart_refresh(chart);
+}
 
-  g_gfx->begin();
-  g_gfx->fillScreen(0x0000);
-  static_cast<Arduino_SH8601 *>(g_gfx)->setBrightness(220);
+}  // namespace
 
-  lv_init();
+void UiManager::begin() {
+  pinMode(cfg::kTouchIntPin, INPUT_PULLUP);
 
-  const size_t pixels = cfg::kDisplayWidth * kDrawBufferLines;
-  const size_t bytes = pixels * sizeof(lv_color_t);
-  g_buf1 = static_cast<lv_color_t *>(ps_malloc(bytes));
-  g_buf2 = static_cast<lv_color_t *>(ps_malloc(bytes));
-  if (g_buf1 == nullptr || g_buf2 == nullptr) {
-    g_buf1 = static_cast<lv_color_t *>(heap_caps_malloc(bytes, MALLOC_CAP_DMA));
-    g_buf2 = static_cast<lv_color_t *>(heap_caps_malloc(bytes, MALLOC_CAP_DMA));
+  if (!g_panel.begin()) {
+    LOG_ERROR(Ui, "Display: SH8601 QSPI init failed");
+    return;
   }
 
-  lv_disp_draw_buf_init(&g_drawBuf, g_buf1, g_buf2, pixels);
+  lv_init();
 
   static lv_disp_drv_t dispDrv;
   lv_disp_drv_init(&dispDrv);
   dispDrv.hor_res = cfg::kDisplayWidth;
   dispDrv.ver_res = cfg::kDisplayHeight;
-  dispDrv.flush_cb = displayFlush;
-  dispDrv.draw_buf = &g_drawBuf;
-  lv_disp_drv_register(&dispDrv);
+  if (!g_panel.attach(dispDrv, g_drawBuf)) {
+    LOG_ERROR(Ui, "Display: no DMA RAM for draw buffers");
+    return;
+  }
 
   static lv_indev_drv_t indevDrv;
   lv_indev_drv_init(&indevDrv);
   indevDrv.type = LV_INDEV_TYPE_POINTER;
   indevDrv.read_cb = touchRead;
   lv_indev_drv_register(&indevDrv);
+  touchTimer_ = indevDrv.read_timer;
+  attachInterrupt(digitalPinToInterrupt(cfg::kTouchIntPin), onTouchInterrupt, FALLING);
 
+  uiFontsBegin();
   createScreen();
   lastLvTickMs_ = millis();
+  lastStatsMs_ = lastLvTickMs_;
+  lastPerfMs_ = lastLvTickMs_;
+  dirty_ = kDirtyStatus | kDirtyVitals;
   initialized_ = true;
+  // The panel comes up dark; the first tick draws the screen and only then
+  // raises the brightness, the same way as after a wake.
+  resumePending_ = displayOn_;
 }
 
+void UiManager::setWaveformSource(const WaveformRing *source) {
+  waveform_.setSource(source);
+}
+
+void UiManager::setTrendStore(const TrendStore *store) {
+  trendStore_ = store;
+  if (initialized_) {
+    refreshTrendCharts(millis());
+  }
+}
+
+void UiManager::setPerfMonitor(PerfMonitor *perf) { perf_ = perf; }
+
 void UiManager::createScreen() {
   screen_ = lv_obj_create(nullptr);
   lv_obj_set_style_bg_color(screen_, lv_color_hex(0x000000), 0);
@@ -231,52 +320,59 @@ void UiManager::createScreen() {
   createTrends();
   createDevicePage();
   createRecordPage();
+  createWavePage();
   setPage(0);
   lv_scr_load(screen_);
 }
 
 void UiManager::createHeader() {
   logoImg_ = lv_img_create(screen_);
-  lv_img_set_src(logoImg_, &ergo_logo_img);
+  const lv_img_dsc_t *logo = imageAsset(ergo_logo);
+  if (logo != nullptr) {
+    lv_img_set_src(logoImg_, logo);
+  }
   lv_obj_align(logoImg_, LV_ALIGN_TOP_LEFT, 0, 0);
 
   timeLabel_ = lv_label_create(screen_);
   lv_label_set_text(timeLabel_, "--:--:--");
   lv_obj_align(timeLabel_, LV_ALIGN_TOP_RIGHT, 0, 0);
   lv_obj_set_style_text_color(timeLabel_, lv_color_hex(0xF4F8FC), 0);
-  lv_obj_set_style_text_font(timeLabel_, &lv_font_montserrat_20, 0);
+  lv_obj_set_style_text_font(timeLabel_, uiFont(UiFont::Title), 0);
 
   dateLabel_ = lv_label_create(screen_);
   lv_label_set_text(dateLabel_, "RTC not set");
   lv_obj_align(dateLabel_, LV_ALIGN_TOP_RIGHT, -78, 26);
   lv_obj_set_style_text_color(dateLabel_, lv_color_hex(0x6F7C8D), 0);
-  lv_obj_set_style_text_font(dateLabel_, &lv_font_montserrat_16, 0);
+  lv_obj_set_style_text_font(dateLabel_, uiFont(UiFont::Body), 0);
 
   bleLabel_ = lv_label_create(screen_);
   lv_label_set_text(bleLabel_, LV_SYMBOL_BLUETOOTH);
   lv_obj_align(bleLabel_, LV_ALIGN_TOP_RIGHT, -54, 26);
   lv_obj_set_style_text_color(bleLabel_, lv_color_hex(0x566070), 0);
-  lv_obj_set_style_text_font(bleLabel_, &lv_font_montserrat_20, 0);
+  lv_obj_set_style_text_font(bleLabel_, uiFont(UiFont::Title), 0);
 
   batteryLabel_ = lv_label_create(screen_);
   lv_label_set_text(batteryLabel_, LV_SYMBOL_BATTERY_FULL " 0%");
   lv_obj_align(batteryLabel_, LV_ALIGN_TOP_RIGHT, 0, 28);
   lv_obj_set_style_text_color(batteryLabel_, lv_color_hex(0xD9DEE5), 0);
-  lv_obj_set_style_text_font(batteryLabel_, &lv_font_montserrat_16, 0);
+  lv_obj_set_style_text_font(batteryLabel_, uiFont(UiFont::Body), 0);
 }
 
 void UiManager::createNavigation() {
   navDashboard_ = createNavButton(screen_, "Today");
+  navWave_ = createNavButton(screen_, "Wave");
   navTrends_ = createNavButton(screen_, "Trends");
   navRecord_ = createNavButton(screen_, "Record");
   navDevice_ = createNavButton(screen_, "Device");
-  lv_obj_set_size(navDashboard_, 78, 34);
-  lv_obj_set_size(navTrends_, 78, 34);
-  lv_obj_set_size(navRecord_, 78, 34);
-  lv_obj_set_size(navDevice_, 78, 34);
+  lv_obj_set_size(navDashboard_, 64, 34);
+  lv_obj_set_size(navWave_, 64, 34);
+  lv_obj_set_size(navTrends_, 64, 34);
+  lv_obj_set_size(navRecord_, 64, 34);
+  lv_obj_set_size(navDevice_, 64, 34);
   lv_obj_align(navDashboard_, LV_ALIGN_TOP_LEFT, 0, 52);
-  lv_obj_align(navTrends_, LV_ALIGN_TOP_LEFT, 84, 52);
-  lv_obj_align(navRecord_, LV_ALIGN_TOP_LEFT, 168, 52);
+  lv_obj_align(navWave_, LV_ALIGN_TOP_LEFT, 68, 52);
+  lv_obj_align(navTrends_, LV_ALIGN_TOP_LEFT, 136, 52);
+  lv_obj_align(navRecord_, LV_ALIGN_TOP_LEFT, 204, 52);
   lv_obj_align(navDevice_, LV_ALIGN_TOP_RIGHT, 0, 52);
 
   lv_obj_add_event_cb(navDashboard_, [](lv_event_t *event) {
@@ -289,7 +385,10 @@ void UiManager::createNavigation() {
     static_cast<UiManager *>(lv_event_get_user_data(event))->setPage(2);
   }, LV_EVENT_CLICKED, this);
   lv_obj_add_event_cb(navDevice_, [](lv_event_t *event) {
-    static_cast<UiManager *>(lv_event_get_user_data(event))->setPage(3);
+    static_cast<UiManager *>(lv_event_get_user_data(event))->setPage(kPageDevice);
+  }, LV_EVENT_CLICKED, this);
+  lv_obj_add_event_cb(navWave_, [](lv_event_t *event) {
+    static_cast<UiManager *>(lv_event_get_user_data(event))->setPage(kPageWave);
   }, LV_EVENT_CLICKED, this);
 }
 
@@ -310,13 +409,13 @@ void UiManager::createDashboard() {
   lv_label_set_text(hrValueLabel_, "--");
   lv_obj_align(hrValueLabel_, LV_ALIGN_LEFT_MID, 0, 16);
   lv_obj_set_style_text_color(hrValueLabel_, lv_color_hex(0xFFFFFF), 0);
-  lv_obj_set_style_text_font(hrValueLabel_, &lv_font_montserrat_48, 0);
+  lv_obj_set_style_text_font(hrValueLabel_, uiFont(UiFont::Hero), 0);
 
   heartLabel_ = lv_label_create(hero);
   lv_label_set_text(heartLabel_, "bpm");
   lv_obj_align_to(heartLabel_, hrValueLabel_, LV_ALIGN_OUT_RIGHT_BOTTOM, 8, -8);
   lv_obj_set_style_text_color(heartLabel_, lv_color_hex(0x7B8796), 0);
-  lv_obj_set_style_text_font(heartLabel_, &lv_font_montserrat_20, 0);
+  lv_obj_set_style_text_font(heartLabel_, uiFont(UiFont::Title), 0);
 
   heroHrTrendChart_ = createTrendChart(hero, lv_color_hex(0xFF5A6B), &heroHrSeries_, 45, 180);
   lv_obj_set_size(heroHrTrendChart_, 132, 58);
@@ -329,7 +428,7 @@ void UiManager::createDashboard() {
   lv_label_set_text(spo2ValueLabel_, "--%");
   lv_obj_align(spo2ValueLabel_, LV_ALIGN_BOTTOM_LEFT, 0, -2);
   lv_obj_set_style_text_color(spo2ValueLabel_, lv_color_hex(0xFFFFFF), 0);
-  lv_obj_set_style_text_font(spo2ValueLabel_, &lv_font_montserrat_28, 0);
+  lv_obj_set_style_text_font(spo2ValueLabel_, uiFont(UiFont::Value), 0);
 
   lv_obj_t *rriCard = createCard(pageDashboard_, 104, 122);
   lv_obj_align(rriCard, LV_ALIGN_TOP_MID, 0, 154);
@@ -338,7 +437,7 @@ void UiManager::createDashboard() {
   lv_label_set_text(rriValueLabel_, "--");
   lv_obj_align(rriValueLabel_, LV_ALIGN_BOTTOM_LEFT, 0, -2);
   lv_obj_set_style_text_color(rriValueLabel_, lv_color_hex(0xFFFFFF), 0);
-  lv_obj_set_style_text_font(rriValueLabel_, &lv_font_montserrat_28, 0);
+  lv_obj_set_style_text_font(rriValueLabel_, uiFont(UiFont::Value), 0);
 
   lv_obj_t *hrvCard = createCard(pageDashboard_, 104, 122);
   lv_obj_align(hrvCard, LV_ALIGN_TOP_RIGHT, 0, 154);
@@ -347,7 +446,7 @@ void UiManager::createDashboard() {
   lv_label_set_text(hrvValueLabel_, "--");
   lv_obj_align(hrvValueLabel_, LV_ALIGN_BOTTOM_LEFT, 0, -2);
   lv_obj_set_style_text_color(hrvValueLabel_, lv_color_hex(0xFFFFFF), 0);
-  lv_obj_set_style_text_font(hrvValueLabel_, &lv_font_montserrat_28, 0);
+  lv_obj_set_style_text_font(hrvValueLabel_, uiFont(UiFont::Value), 0);
 
   statusLabel_ = lv_label_create(pageDashboard_);
   lv_label_set_text(statusLabel_, "Booting sensor...");
@@ -356,7 +455,7 @@ void UiManager::createDashboard() {
   lv_obj_align(statusLabel_, LV_ALIGN_BOTTOM_MID, 0, 0);
   lv_obj_set_style_text_align(statusLabel_, LV_TEXT_ALIGN_CENTER, 0);
   lv_obj_set_style_text_color(statusLabel_, lv_color_hex(0x8E99A8), 0);
-  lv_obj_set_style_text_font(statusLabel_, &lv_font_montserrat_16, 0);
+  lv_obj_set_style_text_font(statusLabel_, uiFont(UiFont::Body), 0);
 }
 
 void UiManager::createTrends() {
@@ -382,6 +481,25 @@ void UiManager::createTrends() {
   spo2TrendChart_ = createTrendChart(cards[1], lv_color_hex(0x41C7F5), &spo2Series_, 85, 100);
   rriTrendChart_ = createTrendChart(cards[2], lv_color_hex(0xFFC857), &rriSeries_, 300, 1400);
   hrvTrendChart_ = createTrendChart(cards[3], lv_color_hex(0x5EE27A), &hrvSeries_, 0, 180);
+
+  lv_obj_t *rangeButton = lv_btn_create(pageTrends_);
+  lv_obj_set_size(rangeButton, 160, 24);
+  lv_obj_align(rangeButton, LV_ALIGN_BOTTOM_MID, 0, 0);
+  lv_obj_set_style_radius(rangeButton, 12, 0);
+  lv_obj_set_style_bg_color(rangeButton, lv_color_hex(0x111722), 0);
+  lv_obj_set_style_border_width(rangeButton, 1, 0);
+  lv_obj_set_style_border_color(rangeButton, lv_color_hex(0x243244), 0);
+  trendRangeLabel_ = lv_label_create(rangeButton);
+  lv_label_set_text_static(trendRangeLabel_, kTrendRangeNames[trendRange_]);
+  lv_obj_center(trendRangeLabel_);
+  lv_obj_set_style_text_font(trendRangeLabel_, uiFont(UiFont::Small), 0);
+  lv_obj_set_style_text_color(trendRangeLabel_, lv_color_hex(0xAAB4C3), 0);
+  lv_obj_add_event_cb(rangeButton, [](lv_event_t *event) {
+    auto *ui = static_cast<UiManager *>(lv_event_get_user_data(event));
+    ui->trendRange_ = static_cast<uint8_t>((ui->trendRange_ + 1U) % kTrendRangeCount);
+    lv_label_set_text_static(ui->trendRangeLabel_, kTrendRangeNames[ui->trendRange_]);
+    ui->refreshTrendCharts(millis());
+  }, LV_EVENT_CLICKED, this);
 }
 
 void UiManager::createDevicePage() {
@@ -393,7 +511,7 @@ void UiManager::createDevicePage() {
   lv_obj_set_style_pad_all(pageDevice_, 0, 0);
   lv_obj_clear_flag(pageDevice_, LV_OBJ_FLAG_SCROLLABLE);
 
-  lv_obj_t *deviceCard = createCard(pageDevice_, 336, 154);
+  lv_obj_t *deviceCard = createCard(pageDevice_, 336, 190);
   lv_obj_align(deviceCard, LV_ALIGN_TOP_MID, 0, 0);
   createCardTitle(deviceCard, "Device", LV_SYMBOL_SETTINGS, lv_color_hex(0x41C7F5));
   deviceInfoLabel_ = lv_label_create(deviceCard);
@@ -402,19 +520,55 @@ void UiManager::createDevicePage() {
   lv_obj_set_width(deviceInfoLabel_, 306);
   lv_obj_align(deviceInfoLabel_, LV_ALIGN_TOP_LEFT, 0, 30);
   lv_obj_set_style_text_color(deviceInfoLabel_, lv_color_hex(0xDDE6F3), 0);
-  lv_obj_set_style_text_font(deviceInfoLabel_, &lv_font_montserrat_16, 0);
-
-  lv_obj_t *rtcCard = createCard(pageDevice_, 336, 166);
+  lv_obj_set_style_text_font(deviceInfoLabel_, uiFont(UiFont::Body), 0);
+  bleStreamLabel_ = lv_label_create(deviceCard);
+  lv_label_set_text(bleStreamLabel_, "Stream: not subscribed");
+  lv_label_set_long_mode(bleStreamLabel_, LV_LABEL_LONG_WRAP);
+  lv_obj_set_width(bleStreamLabel_, 306);
+  lv_obj_align(bleStreamLabel_, LV_ALIGN_TOP_LEFT, 0, 126);
+  lv_obj_set_style_text_color(bleStreamLabel_, lv_color_hex(0x9EABB9), 0);
+  lv_obj_set_style_text_font(bleStreamLabel_, uiFont(UiFont::Small), 0);
+
+  lv_obj_t *rtcCard = createCard(pageDevice_, 336, 142);
   lv_obj_align(rtcCard, LV_ALIGN_BOTTOM_MID, 0, 0);
   createCardTitle(rtcCard, "Set RTC", LV_SYMBOL_EDIT, lv_color_hex(0xFFC857));
   rtcHelpLabel_ = lv_label_create(rtcCard);
   lv_label_set_text(rtcHelpLabel_,
-                    "Serial command:\nRTC=YYYY-MM-DD HH:MM:SS\n\nExample:\nRTC=2026-05-30 14:05:00");
+                    "Serial command:\nRTC=YYYY-MM-DD HH:MM:SS\nExample:\nRTC=2026-05-30 14:05:00");
   lv_label_set_long_mode(rtcHelpLabel_, LV_LABEL_LONG_WRAP);
   lv_obj_set_width(rtcHelpLabel_, 306);
   lv_obj_align(rtcHelpLabel_, LV_ALIGN_TOP_LEFT, 0, 30);
   lv_obj_set_style_text_color(rtcHelpLabel_, lv_color_hex(0xDDE6F3), 0);
-  lv_obj_set_style_text_font(rtcHelpLabel_, &lv_font_montserrat_16, 0);
+  lv_obj_set_style_text_font(rtcHelpLabel_, uiFont(UiFont::Body), 0);
+
+  perfButton_ = lv_btn_create(deviceCard);
+  lv_obj_set_size(perfButton_, 64, 26);
+  lv_obj_align(perfButton_, LV_ALIGN_TOP_RIGHT, 0, -4);
+  lv_obj_set_style_radius(perfButton_, 13, 0);
+  lv_obj_set_style_bg_color(perfButton_, lv_color_hex(0x111722), 0);
+  lv_obj_set_style_border_width(perfButton_, 1, 0);
+  lv_obj_set_style_border_color(perfButton_, lv_color_hex(0x243244), 0);
+  lv_obj_t *perfButtonLabel = lv_label_create(perfButton_);
+  lv_label_set_text(perfButtonLabel, "Perf");
+  lv_obj_center(perfButtonLabel);
+  lv_obj_set_style_text_font(perfButtonLabel, uiFont(UiFont::Small), 0);
+  lv_obj_add_event_cb(perfButton_, [](lv_event_t *event) {
+    auto *ui = static_cast<UiManager *>(lv_event_get_user_data(event));
+    ui->setPerfOverlay(!ui->perfOverlay_);
+  }, LV_EVENT_CLICKED, this);
+
+  // Covers the stream text and the RTC card while shown.
+  perfCard_ = createCard(pageDevice_, 336, 230);
+  lv_obj_align(perfCard_, LV_ALIGN_BOTTOM_MID, 0, 0);
+  createCardTitle(perfCard_, "Performance", LV_SYMBOL_REFRESH, lv_color_hex(0xB98CFF));
+  perfLabel_ = lv_label_create(perfCard_);
+  lv_label_set_text(perfLabel_, "Collecting...");
+  lv_label_set_long_mode(perfLabel_, LV_LABEL_LONG_WRAP);
+  lv_obj_set_width(perfLabel_, 306);
+  lv_obj_align(perfLabel_, LV_ALIGN_TOP_LEFT, 0, 30);
+  lv_obj_set_style_text_color(perfLabel_, lv_color_hex(0xDDE6F3), 0);
+  lv_obj_set_style_text_font(perfLabel_, uiFont(UiFont::Small), 0);
+  lv_obj_add_flag(perfCard_, LV_OBJ_FLAG_HIDDEN);
 }
 
 void UiManager::createRecordPage() {
@@ -437,13 +591,13 @@ void UiManager::createRecordPage() {
   lv_obj_set_width(recordStatusLabel_, 306);
   lv_obj_align(recordStatusLabel_, LV_ALIGN_TOP_LEFT, 0, 30);
   lv_obj_set_style_text_color(recordStatusLabel_, lv_color_hex(0xDDE6F3), 0);
-  lv_obj_set_style_text_font(recordStatusLabel_, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(recordStatusLabel_, uiFont(UiFont::Small), 0);
 
   lv_obj_t *modeLabel = lv_label_create(recordCard);
   lv_label_set_text(modeLabel, "Filtering mode");
   lv_obj_align(modeLabel, LV_ALIGN_TOP_LEFT, 0, 116);
   lv_obj_set_style_text_color(modeLabel, lv_color_hex(0x9EABB9), 0);
-  lv_obj_set_style_text_font(modeLabel, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(modeLabel, uiFont(UiFont::Small), 0);
 
   const char *labels[] = {"M0", "M1", "M2", "M3"};
   for (uint8_t i = 0; i < 4; ++i) {
@@ -458,7 +612,7 @@ void UiManager::createRecordPage() {
     lv_obj_t *label = lv_label_create(modeButtons_[i]);
     lv_label_set_text(label, labels[i]);
     lv_obj_center(label);
-    lv_obj_set_style_text_font(label, &lv_font_montserrat_16, 0);
+    lv_obj_set_style_text_font(label, uiFont(UiFont::Body), 0);
     lv_obj_add_event_cb(modeButtons_[i], [](lv_event_t *event) {
       auto *ui = static_cast<UiManager *>(lv_event_get_user_data(event));
       lv_obj_t *target = lv_event_get_target(event);
@@ -466,6 +620,7 @@ void UiManager::createRecordPage() {
         if (ui->modeButtons_[index] == target) {
           ui->pendingFilteringMode_ = static_cast<FilteringMode>(index);
           ui->filteringModePending_ = true;
+          uiPostEvent(UiEvent::Request);
           break;
         }
       }
@@ -480,32 +635,96 @@ void UiManager::createRecordPage() {
   recordButtonLabel_ = lv_label_create(recordButton_);
   lv_label_set_text(recordButtonLabel_, "Start Recording");
   lv_obj_center(recordButtonLabel_);
-  lv_obj_set_style_text_font(recordButtonLabel_, &lv_font_montserrat_16, 0);
+  lv_obj_set_style_text_font(recordButtonLabel_, uiFont(UiFont::Body), 0);
   lv_obj_add_event_cb(recordButton_, [](lv_event_t *event) {
     static_cast<UiManager *>(lv_event_get_user_data(event))->recordingTogglePending_ = true;
+    uiPostEvent(UiEvent::Request);
   }, LV_EVENT_CLICKED, this);
 
   lv_obj_t *infoCard = createCard(pageRecord_, 336, 42);
   lv_obj_align(infoCard, LV_ALIGN_BOTTOM_MID, 0, 0);
-  lv_obj_t *infoLabel = lv_label_create(infoCard);
-  lv_label_set_text(infoLabel,
-                    "CSV: mode + PPG/IMU diagnostics. BLE unchanged.");
-  lv_label_set_long_mode(infoLabel, LV_LABEL_LONG_WRAP);
-  lv_obj_set_width(infoLabel, 306);
-  lv_obj_align(infoLabel, LV_ALIGN_TOP_LEFT, 0, 0);
-  lv_obj_set_style_text_color(infoLabel, lv_color_hex(0x9EABB9), 0);
-  lv_obj_set_style_text_font(infoLabel, &lv_font_montserrat_14, 0);
-}
-
-void UiManager::tick(const VitalData &data, bool bleConnected,
-                     uint8_t batteryPercent, const RtcSnapshot &rtc,
-                     const char *bleDeviceName,
-                     const RecordingSnapshot &recording,
-                     FilteringMode filteringMode) {
+  recordStatsLabel_ = lv_label_create(infoCard);
+  lv_label_set_text(recordStatsLabel_,
+                    "CSV vitals + compressed .erg PPG/IMU stream.");
+  lv_label_set_long_mode(recordStatsLabel_, LV_LABEL_LONG_WRAP);
+  lv_obj_set_width(recordStatsLabel_, 306);
+  lv_obj_align(recordStatsLabel_, LV_ALIGN_TOP_LEFT, 0, 0);
+  lv_obj_set_style_text_color(recordStatsLabel_, lv_color_hex(0x9EABB9), 0);
+  lv_obj_set_style_text_font(recordStatsLabel_, uiFont(UiFont::Small), 0);
+}
+
+void UiManager::createWavePage() {
+  pageWave_ = lv_obj_create(screen_);
+  lv_obj_set_size(pageWave_, 336, 340);
+  lv_obj_align(pageWave_, LV_ALIGN_TOP_MID, 0, 92);
+  lv_obj_set_style_bg_opa(pageWave_, LV_OPA_TRANSP, 0);
+  lv_obj_set_style_border_width(pageWave_, 0, 0);
+  lv_obj_set_style_pad_all(pageWave_, 0, 0);
+  lv_obj_clear_flag(pageWave_, LV_OBJ_FLAG_SCROLLABLE);
+
+  lv_obj_t *waveCard = createCard(pageWave_, 336, 340);
+  lv_obj_align(waveCard, LV_ALIGN_TOP_MID, 0, 0);
+  createCardTitle(waveCard, "Pulse Wave", "IR", lv_color_hex(0xFF5A6B));
+
+  waveHrLabel_ = lv_label_create(waveCard);
+  lv_label_set_text(waveHrLabel_, "-- bpm");
+  lv_obj_align(waveHrLabel_, LV_ALIGN_TOP_RIGHT, 0, 0);
+  lv_obj_set_style_text_color(waveHrLabel_, lv_color_hex(0xFFFFFF), 0);
+  lv_obj_set_style_text_font(waveHrLabel_, uiFont(UiFont::Body), 0);
+
+  waveform_.create(waveCard);
+  lv_obj_align(waveform_.object(), LV_ALIGN_TOP_MID, 0, 34);
+
+  waveStatsLabel_ = lv_label_create(waveCard);
+  lv_label_set_text(waveStatsLabel_, "");
+  lv_label_set_long_mode(waveStatsLabel_, LV_LABEL_LONG_WRAP);
+  lv_obj_set_width(waveStatsLabel_, 306);
+  lv_obj_align(waveStatsLabel_, LV_ALIGN_BOTTOM_LEFT, 0, 0);
+  lv_obj_set_style_text_color(waveStatsLabel_, lv_color_hex(0x9EABB9), 0);
+  lv_obj_set_style_text_font(waveStatsLabel_, uiFont(UiFont::Small), 0);
+}
+
+void UiManager::handleEvent(UiEvent event) {
+  switch (event) {
+    case UiEvent::Vitals:
+      dirty_ |= kDirtyStatus | kDirtyVitals;
+      break;
+    case UiEvent::Ble:
+    case UiEvent::Recording:
+    case UiEvent::Power:
+      dirty_ |= kDirtyStatus;
+      break;
+    // Only wakes the task; tick() reads the controller.
+    case UiEvent::Input:
+    case UiEvent::Request:
+      break;
+  }
+}
+
+uint32_t UiManager::tick(const VitalData &data, bool bleConnected,
+                         uint8_t batteryPercent, const RtcSnapshot &rtc,
+                         const char *bleDeviceName,
+                         const BleStreamStats &bleStream,
+                         const RecordingSnapshot &recording,
+                         FilteringMode filteringMode) {
   if (!initialized_) {
-    return;
+    return cfg::kUiIdleWakeMs;
+  }
+  if (!displayOn_) {
+    // LVGL is frozen and the controller goes unread; an interrupt only asks
+    // for a wake.
+    if (g_touchPending) {
+      g_touchPending = false;
+      if (cfg::kTouchWakesDisplay) {
+        wakeRequested_ = true;
+        swallowTouch_ = true;
+        return 0;
+      }
+    }
+    return kUiWaitForever;
   }
 
+  const int64_t passStartUs = esp_timer_get_time();
   const uint32_t nowMs = millis();
   const uint32_t elapsedMs = nowMs - lastLvTickMs_;
   if (elapsedMs > 0U) {
@@ -513,32 +732,121 @@ void UiManager::tick(const VitalData &data, bool bleConnected,
     lastLvTickMs_ = nowMs;
   }
 
-  lv_timer_handler();
+  if (displayOn_ && dirty_ != 0U) {
+    const bool vitals = (dirty_ & kDirtyVitals) != 0U;
+    updateUi(data, bleConnected, batteryPercent, rtc, bleDeviceName, bleStream,
+             recording, filteringMode, vitals);
+    if (vitals) {
+      const bool pulseState = ((nowMs / 500U) % 2U) == 0U;
+      lv_obj_set_style_text_color(heartLabel_,
+                                  pulseState ? lv_color_hex(0xFF6B7C)
+                                             : lv_color_hex(0x9F283C),
+                                  0);
+    }
+    dirty_ = 0;
+  }
 
-  if (!displayOn_) {
-    return;
+  uint32_t waitMs = serviceTouch(nowMs);
+  if (displayOn_ && activePage_ == kPageWave) {
+    waitMs = std::min(waitMs, pumpWaveform(nowMs));
   }
 
-  if ((nowMs - lastRefreshMs_) < cfg::kUiRefreshPeriodMs) {
-    return;
+  const uint32_t submits = g_panel.submits();
+  const int64_t handlerStartUs = esp_timer_get_time();
+  if (resumePending_) {
+    // Draw everything in one pass while the panel is still dark.
+    resumePending_ = false;
+    lv_obj_invalidate(screen_);
+    lv_refr_now(nullptr);
+    g_panel.setBrightness(cfg::kDisplayBrightness);
+  }
+  const uint32_t lvglIdleMs = lv_timer_handler();
+  if (g_panel.submits() != submits) {
+    const uint32_t frameUs = static_cast<uint32_t>(esp_timer_get_time() - handlerStartUs);
+    ++frames_;
+    frameUsTotal_ += frameUs;
+    frameUsMax_ = std::max(frameUsMax_, frameUs);
+    ++perfFrames_;
+    perfFrameUsTotal_ += frameUs;
+    perfFrameUsMax_ = std::max(perfFrameUsMax_, frameUs);
   }
-  lastRefreshMs_ = nowMs;
+  if (esp_timer_get_time() - passStartUs > static_cast<int64_t>(cfg::kUiFrameBudgetMs) * 1000) {
+    ++missedDeadlines_;
+  }
+  if ((nowMs - lastPerfMs_) >= cfg::kPerfPeriodMs) {
+    samplePerf(nowMs);
+  }
+  if ((nowMs - lastStatsMs_) >= cfg::kDisplayStatsPeriodMs) {
+    lastStatsMs_ = nowMs;
+    logDisplayStats();
+  }
+  return std::min(lvglIdleMs, waitMs);
+}
 
-  updateUi(data, bleConnected, batteryPercent, rtc, bleDeviceName, recording,
-           filteringMode);
+// Runs at the wave page's frame rate no matter what else woke the task.
+// Returns the time left until the next frame is due.
+uint32_t UiManager::pumpWaveform(uint32_t nowMs) {
+  const uint32_t sinceFrameMs = nowMs - lastWavePumpMs_;
+  if (sinceFrameMs < cfg::kWaveformFrameMs) {
+    return cfg::kWaveformFrameMs - sinceFrameMs;
+  }
+  lastWavePumpMs_ = nowMs;
+  waveform_.pump(nowMs);
+
+  if ((nowMs - lastWaveStatsMs_) >= 1000U) {
+    const uint32_t periodMs = nowMs - lastWaveStatsMs_;
+    lastWaveStatsMs_ = nowMs;
+    waveStats_ = waveform_.takeStats();
+    char text[96];
+    snprintf(text, sizeof(text), "%lu fps  %u Hz  draw %lu.%lu ms  lost %lu",
+             static_cast<unsigned long>((waveStats_.frames * 1000U) / periodMs),
+             static_cast<unsigned>(1000U / (cfg::kSensorTaskPeriodMs * cfg::kWaveformDecimation)),
+             static_cast<unsigned long>(waveStats_.drawUsMax / 1000U),
+             static_cast<unsigned long>((waveStats_.drawUsMax % 1000U) / 100U),
+             static_cast<unsigned long>(waveStats_.dropped));
+    lv_label_set_text(waveStatsLabel_, text);
+  }
+  return cfg::kWaveformFrameMs;
+}
 
-  const bool pulseState = ((nowMs / 500U) % 2U) == 0U;
-  lv_obj_set_style_text_color(heartLabel_,
-                              pulseState ? lv_color_hex(0xFF6B7C)
-                                         : lv_color_hex(0x9F283C),
-                              0);
+// The deferred half of the touch driver: reads the controller after an
+// interrupt, at most once per read period while a finger is down, plus once
+// more when a held touch goes quiet in case its release report was lost.
+// Returns the time until the next read could be due.
+uint32_t UiManager::serviceTouch(uint32_t nowMs) {
+  const bool held = g_touchRead.pressed;
+  const uint32_t sinceReadMs = nowMs - lastTouchReadMs_;
+  const uint32_t nextReadMs = g_touchPending ? cfg::kTouchReadPeriodMs : cfg::kTouchReleaseCheckMs;
+  if (held ? sinceReadMs < nextReadMs : !g_touchPending) {
+    return held ? nextReadMs - sinceReadMs : cfg::kUiIdleWakeMs;
+  }
+  // Cleared before the read so an edge during it schedules another one.
+  g_touchPending = false;
+  lastTouchReadMs_ = nowMs;
+  ++touchReads_;
+
+  TouchPoint point = g_touchRead;
+  point.pressed = readTouchPoint(point.x, point.y);
+  const bool changed = point.pressed || g_touchRead.pressed;
+  g_touchRead = point;
+  if (swallowTouch_) {
+    swallowTouch_ = point.pressed;
+  } else if (changed) {
+    queueTouch(point);
+    if (touchTimer_ != nullptr) {
+      lv_timer_resume(touchTimer_);
+      lv_timer_ready(touchTimer_);
+    }
+  }
+  return point.pressed ? cfg::kTouchReadPeriodMs : cfg::kUiIdleWakeMs;
 }
 
 void UiManager::updateUi(const VitalData &data, bool bleConnected,
                          uint8_t batteryPercent, const RtcSnapshot &rtc,
                          const char *bleDeviceName,
+                         const BleStreamStats &bleStream,
                          const RecordingSnapshot &recording,
-                         FilteringMode filteringMode) {
+                         FilteringMode filteringMode, bool vitals) {
   if (lastSnapshot_.rtcValid != rtc.valid ||
       strcmp(lastSnapshot_.timeText, rtc.timeText) != 0 ||
       strcmp(lastSnapshot_.dateText, rtc.dateText) != 0) {
@@ -568,9 +876,15 @@ void UiManager::updateUi(const VitalData &data, bool bleConnected,
     lastSnapshot_.batteryPercent = batteryPercent;
   }
 
+  updateStreamUi(bleStream);
   updateRecordingUi(recording, filteringMode);
 
-  if (memcmp(&lastSnapshot_.data, &data, sizeof(VitalData)) == 0) {
+  // Vitals and trend points only move on the 1 Hz tick; the charts scroll
+  // with time even while the values hold.
+  if (vitals) {
+    refreshTrendCharts(millis());
+  }
+  if (!vitals || memcmp(&lastSnapshot_.data, &data, sizeof(VitalData)) == 0) {
     return;
   }
 
@@ -578,6 +892,9 @@ void UiManager::updateUi(const VitalData &data, bool bleConnected,
   char hrText[16];
   snprintf(hrText, sizeof(hrText), vitalsValid && data.hr > 0 ? "%u" : "--", data.hr);
   lv_label_set_text(hrValueLabel_, hrText);
+  char waveHrText[24];
+  snprintf(waveHrText, sizeof(waveHrText), "%s bpm", hrText);
+  lv_label_set_text(waveHrLabel_, waveHrText);
 
   if (vitalsValid && data.spo2_x100 > 0U) {
     char text[20];
@@ -592,7 +909,6 @@ void UiManager::updateUi(const VitalData &data, bool bleConnected,
   setMetricValue(hrvValueLabel_, "ms", data.hrv,
                  (data.status & cfg::kStatusHrvValid) != 0U);
   updateStatusText(data);
-  updateTrendCharts(data);
 
   char deviceText[160];
   snprintf(deviceText, sizeof(deviceText),
@@ -606,28 +922,85 @@ void UiManager::updateUi(const VitalData &data, bool bleConnected,
   lastSnapshot_.data = data;
 }
 
+void UiManager::updateStreamUi(const BleStreamStats &bleStream) {
+  static const char *const kPhyNames[] = {"?", "1M", "2M", "Coded"};
+  static const char *const kProfileNames[] = {"auto", "eco", "fast"};
+  char text[sizeof(lastSnapshot_.bleStreamText)];
+  const char *phy = kPhyNames[bleStream.phy < 4U ? bleStream.phy : 0U];
+  const unsigned long kbps = bleStream.bytesPerSecond / 1000U;
+  const unsigned long kbpsTenths = (bleStream.bytesPerSecond / 100U) % 10U;
+  int length = 0;
+  if (!bleStream.subscribed) {
+    length = snprintf(text, sizeof(text), "Stream off | %lu.%lu kB/s", kbps, kbpsTenths);
+  } else if (ergo::streamSamplesPerFrame(bleStream.mtu) == 0U) {
+    length = snprintf(text, sizeof(text), "Stream: MTU %u too small", bleStream.mtu);
+  } else {
+    length = snprintf(text, sizeof(text), "Stream %lu.%lu kB/s %lu sps | lost %lu+%lu",
+                      kbps, kbpsTenths,
+                      static_cast<unsigned long>(bleStream.samplesPerSecond),
+                      static_cast<unsigned long>(bleStream.samplesDropped),
+                      static_cast<unsigned long>(bleStream.notifyErrors));
+  }
+  // Connection interval is in 1.25 ms units.
+  const unsigned long intervalTenthsMs = bleStream.connInterval * 125UL / 10UL;
+  const uint8_t profile = static_cast<uint8_t>(bleStream.connProfile);
+  if (length > 0 && static_cast<size_t>(length) < sizeof(text)) {
+    snprintf(text + length, sizeof(text) - static_cast<size_t>(length),
+             "\nMTU %u DLE %u %s | %lu.%lums L%u %s", bleStream.mtu, bleStream.txOctets,
+             phy, intervalTenthsMs / 10UL, intervalTenthsMs % 10UL, bleStream.connLatency,
+             kProfileNames[profile < 3U ? profile : 0U]);
+  }
+  if (strcmp(text, lastSnapshot_.bleStreamText) == 0) {
+    return;
+  }
+  lv_label_set_text(bleStreamLabel_, text);
+  strncpy(lastSnapshot_.bleStreamText, text, sizeof(lastSnapshot_.bleStreamText));
+}
+
 void UiManager::updateRecordingUi(const RecordingSnapshot &recording,
                                   FilteringMode filteringMode) {
   const bool modeChanged = lastSnapshot_.filteringMode != filteringMode;
   if (lastSnapshot_.recording == recording.recording &&
       lastSnapshot_.sdReady == recording.sdReady &&
       lastSnapshot_.rowsWritten == recording.rowsWritten &&
+      lastSnapshot_.rawBytesWritten == recording.rawBytesWritten &&
       !modeChanged &&
       strcmp(lastSnapshot_.recordFileName, recording.fileName) == 0 &&
       strcmp(lastSnapshot_.recordStatusText, recording.statusText) == 0) {
     return;
   }
 
-  char text[180];
+  const uint32_t rawInputBytes = recording.rawFramesWritten * ergo::kRawFrameBytes;
+  const uint32_t ratioX10 =
+      recording.rawBytesWritten > 0U
+          ? static_cast<uint32_t>((static_cast<uint64_t>(rawInputBytes) * 10U) /
+                                  recording.rawBytesWritten)
+          : 0U;
+  const ergo::IntervalSummary &session = recording.session;
+  char text[220];
   snprintf(text, sizeof(text),
-           "SD: %s | Mode: %s | %s\nFile: %s\nRows: %lu | %s",
+           "SD: %s | Mode: %s | %s\nFile: %s\nRows: %lu | Raw: %lu KB x%lu.%lu\n"
+           "HR %u (%u-%u) | SpO2 %u%% | valid %u%%",
            recording.sdReady ? "ready" : "not ready",
            filteringModeName(filteringMode),
-           recording.recording ? "recording" : "idle",
+           recording.statusText,
            recording.fileName[0] != '\0' ? recording.fileName : "-",
            static_cast<unsigned long>(recording.rowsWritten),
-           recording.statusText);
+           static_cast<unsigned long>(recording.rawBytesWritten / 1024U),
+           static_cast<unsigned long>(ratioX10 / 10U),
+           static_cast<unsigned long>(ratioX10 % 10U),
+           session.hr.mean, session.hr.min, session.hr.max,
+           session.spo2.mean / 100U, session.validPercent());
   lv_label_set_text(recordStatusLabel_, text);
+
+  if (recording.filesWritten > 0U) {
+    snprintf(text, sizeof(text), "Write max %lu.%lu ms, %lu slow | Free %llu MB",
+             static_cast<unsigned long>(recording.appendMaxUs / 1000U),
+             static_cast<unsigned long>((recording.appendMaxUs / 100U) % 10U),
+             static_cast<unsigned long>(recording.appendsOverBudget),
+             static_cast<unsigned long long>(recording.freeMb));
+    lv_label_set_text(recordStatsLabel_, text);
+  }
   lv_label_set_text(recordButtonLabel_,
                     recording.recording ? "Stop Recording" : "Start Recording");
   lv_obj_set_style_bg_color(recordButton_,
@@ -646,6 +1019,7 @@ void UiManager::updateRecordingUi(const RecordingSnapshot &recording,
   lastSnapshot_.sdReady = recording.sdReady;
   lastSnapshot_.filteringMode = filteringMode;
   lastSnapshot_.rowsWritten = recording.rowsWritten;
+  lastSnapshot_.rawBytesWritten = recording.rawBytesWritten;
   strncpy(lastSnapshot_.recordFileName, recording.fileName,
           sizeof(lastSnapshot_.recordFileName));
   strncpy(lastSnapshot_.recordStatusText, recording.statusText,
@@ -680,17 +1054,21 @@ void UiManager::setMetricValue(lv_obj_t *label, const char *suffix, uint16_t val
   lv_label_set_text(label, text);
 }
 
-void UiManager::updateTrendCharts(const VitalData &data) {
-  const bool vitalsValid = (data.status & cfg::kStatusVitalsValid) != 0U;
-  const bool rriValid = (data.status & cfg::kStatusRriValid) != 0U;
-  const bool hrvValid = (data.status & cfg::kStatusHrvValid) != 0U;
-  lv_chart_set_next_value(hrTrendChart_, hrSeries_, vitalsValid ? data.hr : 0);
-  lv_chart_set_next_value(heroHrTrendChart_, heroHrSeries_, vitalsValid ? data.hr : 0);
-  lv_chart_set_next_value(spo2TrendChart_, spo2Series_,
-                          vitalsValid ? data.spo2_x100 / 100U : 0);
-  lv_chart_set_next_value(rriTrendChart_, rriSeries_, rriValid ? data.rri : 0);
-  lv_chart_set_next_value(hrvTrendChart_, hrvSeries_, hrvValid ? data.hrv : 0);
-  ++trendCount_;
+void UiManager::refreshTrendCharts(uint32_t nowMs) {
+  if (trendStore_ == nullptr) {
+    return;
+  }
+  if (activePage_ == 0) {
+    fillTrendChart(heroHrTrendChart_, heroHrSeries_, *trendStore_, TrendMetric::Hr,
+                   cfg::kTrendChartPoints * 1000U, nowMs, 1);
+  } else if (activePage_ == 1) {
+    const uint32_t rangeMs = kTrendRangesMs[trendRange_];
+    fillTrendChart(hrTrendChart_, hrSeries_, *trendStore_, TrendMetric::Hr, rangeMs, nowMs, 1);
+    fillTrendChart(spo2TrendChart_, spo2Series_, *trendStore_, TrendMetric::Spo2, rangeMs,
+                   nowMs, 100);
+    fillTrendChart(rriTrendChart_, rriSeries_, *trendStore_, TrendMetric::Rri, rangeMs, nowMs, 1);
+    fillTrendChart(hrvTrendChart_, hrvSeries_, *trendStore_, TrendMetric::Hrv, rangeMs, nowMs, 1);
+  }
 }
 
 void UiManager::setPage(uint8_t page) {
@@ -710,16 +1088,26 @@ void UiManager::setPage(uint8_t page) {
   } else {
     lv_obj_add_flag(pageRecord_, LV_OBJ_FLAG_HIDDEN);
   }
-  if (page == 3) {
+  if (page == kPageDevice) {
     lv_obj_clear_flag(pageDevice_, LV_OBJ_FLAG_HIDDEN);
   } else {
     lv_obj_add_flag(pageDevice_, LV_OBJ_FLAG_HIDDEN);
   }
+  if (page == kPageWave) {
+    lv_obj_clear_flag(pageWave_, LV_OBJ_FLAG_HIDDEN);
+    waveform_.restart();
+  } else {
+    lv_obj_add_flag(pageWave_, LV_OBJ_FLAG_HIDDEN);
+  }
 
   lv_obj_set_style_bg_color(navDashboard_, lv_color_hex(page == 0 ? 0x159BDE : 0x111722), 0);
   lv_obj_set_style_bg_color(navTrends_, lv_color_hex(page == 1 ? 0x159BDE : 0x111722), 0);
   lv_obj_set_style_bg_color(navRecord_, lv_color_hex(page == 2 ? 0x159BDE : 0x111722), 0);
-  lv_obj_set_style_bg_color(navDevice_, lv_color_hex(page == 3 ? 0x159BDE : 0x111722), 0);
+  lv_obj_set_style_bg_color(navDevice_,
+                            lv_color_hex(page == kPageDevice ? 0x159BDE : 0x111722), 0);
+  lv_obj_set_style_bg_color(navWave_,
+                            lv_color_hex(page == kPageWave ? 0x159BDE : 0x111722), 0);
+  refreshTrendCharts(millis());
 }
 
 bool UiManager::takeRecordingToggleRequest() {
@@ -737,11 +1125,191 @@ bool UiManager::takeFilteringModeRequest(FilteringMode &mode) {
   return pending;
 }
 
+// Off pauses every LVGL timer and stops reading touch; on lets the next tick
+// rebuild the screen before the brightness comes back.
 void UiManager::setDisplayOn(bool on) {
+  if (on == displayOn_) {
+    return;
+  }
   displayOn_ = on;
-  if (g_gfx != nullptr) {
-    static_cast<Arduino_SH8601 *>(g_gfx)->setBrightness(on ? 220 : 0);
+  if (on) {
+    dirty_ |= kDirtyStatus | kDirtyVitals;
+    // The ring has lapped the trace while the panel was dark.
+    waveform_.restart();
+  }
+  if (!initialized_) {
+    return;
+  }
+  if (on) {
+    // Frozen time is not replayed into LVGL or the perf window.
+    const uint32_t nowMs = millis();
+    lastLvTickMs_ = nowMs;
+    lastPerfMs_ = nowMs;
+    perfFrames_ = 0;
+    perfFrameUsTotal_ = 0;
+    perfFrameUsMax_ = 0;
+    missedDeadlines_ = 0;
+    lv_timer_enable(true);
+    resumePending_ = true;
+    if (swallowTouch_) {
+      // The waking tap may already be over, and the controller only
+      // interrupts again on the next touch: read it once so the release
+      // is seen and the next tap gets through.
+      g_touchPending = true;
+    }
+  } else {
+    g_panel.setBrightness(0);
+    lv_timer_enable(false);
+    resetTouch();
+    resumePending_ = false;
+  }
+}
+
+bool UiManager::takeWakeRequest() {
+  const bool requested = wakeRequested_;
+  wakeRequested_ = false;
+  return requested;
+}
+
+// Drops queued points and reports a release so no press is left hanging in
+// LVGL across a display-off period.
+void UiManager::resetTouch() {
+  g_touchHead = 0;
+  g_touchCount = 0;
+  g_touchRead = TouchPoint{};
+  g_touchReported = TouchPoint{};
+  swallowTouch_ = false;
+  if (touchTimer_ != nullptr) {
+    lv_timer_pause(touchTimer_);
+  }
+}
+
+// Closes one perf window: publishes the UI counters and, while the overlay
+// is on screen, redraws it with the heap and stack figures read now.
+void UiManager::samplePerf(uint32_t nowMs) {
+  const DisplayStats display = g_panel.takeStats();
+  addDisplayStats(g_logDisplayStats, display);
+
+  UiPerfStats stats;
+  stats.periodMs = nowMs - lastPerfMs_;
+  stats.frames = perfFrames_;
+  stats.renderUsAvg = perfFrames_ > 0U ? perfFrameUsTotal_ / perfFrames_ : 0U;
+  stats.renderUsMax = perfFrameUsMax_;
+  stats.flushUsAvg = display.flushes > 0U ? display.flushUsTotal / display.flushes : 0U;
+  stats.flushUsMax = display.flushUsMax;
+  stats.missedDeadlines = missedDeadlines_;
+  lv_mem_monitor_t memory;
+  lv_mem_monitor(&memory);
+  stats.lvglUsedBytes = memory.total_size - memory.free_size;
+  stats.lvglMaxUsedBytes = memory.max_used;
+  stats.lvglTotalBytes = memory.total_size;
+  stats.lvglFragPct = memory.frag_pct;
+
+  lastPerfMs_ = nowMs;
+  perfFrames_ = 0;
+  perfFrameUsTotal_ = 0;
+  perfFrameUsMax_ = 0;
+  missedDeadlines_ = 0;
+
+  if (perf_ != nullptr) {
+    perf_->publishUi(stats);
+  }
+  if (perfOverlay_ && displayOn_ && activePage_ == kPageDevice) {
+    PerfSnapshot snapshot;
+    if (perf_ != nullptr) {
+      snapshot = perf_->snapshot();
+    } else {
+      snapshot.ui = stats;
+    }
+    updatePerfOverlay(snapshot);
+  }
+}
+
+void UiManager::setPerfOverlay(bool visible) {
+  perfOverlay_ = visible;
+  lv_obj_set_style_bg_color(perfButton_, lv_color_hex(visible ? 0x159BDE : 0x111722), 0);
+  if (visible) {
+    lv_obj_clear_flag(perfCard_, LV_OBJ_FLAG_HIDDEN);
+  } else {
+    lv_obj_add_flag(perfCard_, LV_OBJ_FLAG_HIDDEN);
+  }
+}
+
+void UiManager::updatePerfOverlay(const PerfSnapshot &snapshot) {
+  const UiPerfStats &ui = snapshot.ui;
+  const uint32_t fpsX10 = ui.periodMs > 0U ? ui.frames * 10000U / ui.periodMs : 0U;
+  char tasks[256] = "";
+  for (uint8_t i = 0; i < snapshot.taskCount; ++i) {
+    appendTaskStack(tasks, sizeof(tasks), snapshot.tasks[i]);
+  }
+  char text[512];
+  snprintf(text, sizeof(text),
+           "%lu.%lu fps  missed %lu (>%lu ms)\n"
+           "Render avg %lu.%lu max %lu.%lu ms\n"
+           "Flush avg %lu.%lu max %lu.%lu ms\n"
+           "LVGL %lu/%lu KB  peak %lu KB  frag %u%%\n"
+           "Internal %lu KB  min %lu  block %lu\n"
+           "PSRAM %lu KB free\n"
+           "Stack free: %s",
+           static_cast<unsigned long>(fpsX10 / 10U), static_cast<unsigned long>(fpsX10 % 10U),
+           static_cast<unsigned long>(ui.missedDeadlines),
+           static_cast<unsigned long>(cfg::kUiFrameBudgetMs),
+           static_cast<unsigned long>(ui.renderUsAvg / 1000U),
+           static_cast<unsigned long>((ui.renderUsAvg % 1000U) / 100U),
+           static_cast<unsigned long>(ui.renderUsMax / 1000U),
+           static_cast<unsigned long>((ui.renderUsMax % 1000U) / 100U),
+           static_cast<unsigned long>(ui.flushUsAvg / 1000U),
+           static_cast<unsigned long>((ui.flushUsAvg % 1000U) / 100U),
+           static_cast<unsigned long>(ui.flushUsMax / 1000U),
+           static_cast<unsigned long>((ui.flushUsMax % 1000U) / 100U),
+           static_cast<unsigned long>(ui.lvglUsedBytes / 1024U),
+           static_cast<unsigned long>(ui.lvglTotalBytes / 1024U),
+           static_cast<unsigned long>(ui.lvglMaxUsedBytes / 1024U), ui.lvglFragPct,
+           static_cast<unsigned long>(snapshot.internalFreeBytes / 1024U),
+           static_cast<unsigned long>(snapshot.internalMinFreeBytes / 1024U),
+           static_cast<unsigned long>(snapshot.internalLargestBlock / 1024U),
+           static_cast<unsigned long>(snapshot.psramFreeBytes / 1024U),
+           snapshot.taskCount > 0U ? tasks : "-");
+  lv_label_set_text(perfLabel_, text);
+}
+
+// Frame time is one lv_timer_handler pass that redrew something; flush time
+// runs from the flush callback to the DMA transfer-complete interrupt.
+void UiManager::logDisplayStats() {
+  const DisplayStats stats = g_logDisplayStats;
+  g_logDisplayStats = DisplayStats{};
+  if (frames_ > 0U && stats.flushes > 0U) {
+    LOG_DEBUG(Ui,
+              "Display: %lu frames avg=%luus max=%luus, %lu flushes %luKB avg=%luus "
+              "max=%luus submit=%luus, waited %luus",
+              static_cast<unsigned long>(frames_),
+              static_cast<unsigned long>(frameUsTotal_ / frames_),
+              static_cast<unsigned long>(frameUsMax_),
+              static_cast<unsigned long>(stats.flushes),
+              static_cast<unsigned long>(stats.flushBytes / 1024U),
+              static_cast<unsigned long>(stats.flushUsTotal / stats.flushes),
+              static_cast<unsigned long>(stats.flushUsMax),
+              static_cast<unsigned long>(stats.submitUsTotal / stats.flushes),
+              static_cast<unsigned long>(stats.waitUsTotal));
+  }
+  if (touchReads_ > 0U) {
+    LOG_DEBUG(Ui, "Touch: %lu controller reads", static_cast<unsigned long>(touchReads_));
+  }
+  if (activePage_ == kPageWave && waveStats_.frames > 0U) {
+    LOG_DEBUG(Ui,
+              "Wave: %lu frames/s, %lu samples, draw avg=%luus max=%luus, %lu full "
+              "redraws, %lu lost",
+              static_cast<unsigned long>(waveStats_.frames),
+              static_cast<unsigned long>(waveStats_.samples),
+              static_cast<unsigned long>(waveStats_.drawUsTotal / waveStats_.frames),
+              static_cast<unsigned long>(waveStats_.drawUsMax),
+              static_cast<unsigned long>(waveStats_.fullRedraws),
+              static_cast<unsigned long>(waveStats_.dropped));
   }
+  frames_ = 0;
+  frameUsTotal_ = 0;
+  frameUsMax_ = 0;
+  touchReads_ = 0;
 }
 
 void UiManager::toggleDisplay() { setDisplayOn(!displayOn_); }
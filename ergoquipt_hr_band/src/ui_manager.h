@@ -3,21 +3,36 @@
 #include <Arduino.h>
 #include <lvgl.h>
 
+#include "ble_manager.h"
 #include "config.h"
+#include "perf_monitor.h"
 #include "recording_manager.h"
 #include "rtc_manager.h"
+#include "trend_store.h"
+#include "waveform_view.h"
 
 class UiManager {
  public:
   void begin();
-  void tick(const VitalData &data, bool bleConnected, uint8_t batteryPercent,
-            const RtcSnapshot &rtc, const char *bleDeviceName,
-            const RecordingSnapshot &recording, FilteringMode filteringMode);
+  void setWaveformSource(const WaveformRing *source);
+  void setTrendStore(const TrendStore *store);
+  // Receives the UI's frame and LVGL memory counters once per perf window.
+  void setPerfMonitor(PerfMonitor *perf);
+  // Marks what the next tick has to redraw.
+  void handleEvent(UiEvent event);
+  // Applies pending changes and runs LVGL. Returns how long ui_task may
+  // block before LVGL needs it again; kUiWaitForever while the display is off.
+  uint32_t tick(const VitalData &data, bool bleConnected, uint8_t batteryPercent,
+                const RtcSnapshot &rtc, const char *bleDeviceName,
+                const BleStreamStats &bleStream, const RecordingSnapshot &recording,
+                FilteringMode filteringMode);
   bool takeRecordingToggleRequest();
   bool takeFilteringModeRequest(FilteringMode &mode);
   void setDisplayOn(bool on);
   void toggleDisplay();
   bool displayOn() const;
+  // True once after a touch arrived with the display off.
+  bool takeWakeRequest();
 
  private:
   void createScreen();
@@ -27,16 +42,27 @@ class UiManager {
   void createTrends();
   void createDevicePage();
   void createRecordPage();
+  void createWavePage();
   void updateUi(const VitalData &data, bool bleConnected, uint8_t batteryPercent,
                 const RtcSnapshot &rtc, const char *bleDeviceName,
-                const RecordingSnapshot &recording, FilteringMode filteringMode);
+                const BleStreamStats &bleStream, const RecordingSnapshot &recording,
+                FilteringMode filteringMode, bool vitals);
+  uint32_t serviceTouch(uint32_t nowMs);
+  void resetTouch();
+  void updateStreamUi(const BleStreamStats &bleStream);
   void updateRecordingUi(const RecordingSnapshot &recording,
                          FilteringMode filteringMode);
   void updateStatusText(const VitalData &data);
-  void updateTrendCharts(const VitalData &data);
+  // Redraws the charts on the visible page from the trend store.
+  void refreshTrendCharts(uint32_t nowMs);
   void setPage(uint8_t page);
   void setMetricValue(lv_obj_t *label, const char *suffix, uint16_t value,
                       bool valid);
+  uint32_t pumpWaveform(uint32_t nowMs);
+  void samplePerf(uint32_t nowMs);
+  void setPerfOverlay(bool visible);
+  void updatePerfOverlay(const PerfSnapshot &snapshot);
+  void logDisplayStats();
 
   struct Snapshot {
     VitalData data{};
@@ -47,23 +73,50 @@ class UiManager {
     bool sdReady = false;
     FilteringMode filteringMode = FilteringMode::M2MotionAdaptive;
     uint32_t rowsWritten = 0;
+    uint32_t rawBytesWritten = 0;
     char timeText[9] = "";
     char dateText[11] = "";
     char recordFileName[40] = "";
     char recordStatusText[96] = "";
+    char bleStreamText[96] = "";
   };
 
   Snapshot lastSnapshot_{};
   bool initialized_ = false;
   bool displayOn_ = true;
+  // Set at boot and on wake: the next tick redraws the whole screen before
+  // the panel lights up.
+  bool resumePending_ = false;
+  bool wakeRequested_ = false;
+  // The touch that woke the display is held back from LVGL until released.
+  bool swallowTouch_ = false;
   bool recordingTogglePending_ = false;
   bool filteringModePending_ = false;
   FilteringMode pendingFilteringMode_ = FilteringMode::M2MotionAdaptive;
   uint8_t activePage_ = 0;
-  uint32_t lastRefreshMs_ = 0;
+  uint8_t dirty_ = 0;
   uint32_t lastLvTickMs_ = 0;
-  uint32_t trendCount_ = 0;
+  uint8_t trendRange_ = 0;
+  const TrendStore *trendStore_ = nullptr;
+  uint32_t lastStatsMs_ = 0;
+  uint32_t frames_ = 0;
+  uint32_t frameUsTotal_ = 0;
+  uint32_t frameUsMax_ = 0;
+  PerfMonitor *perf_ = nullptr;
+  bool perfOverlay_ = false;
+  uint32_t lastPerfMs_ = 0;
+  uint32_t perfFrames_ = 0;
+  uint32_t perfFrameUsTotal_ = 0;
+  uint32_t perfFrameUsMax_ = 0;
+  uint32_t missedDeadlines_ = 0;
+  uint32_t lastTouchReadMs_ = 0;
+  uint32_t touchReads_ = 0;
+  uint32_t lastWavePumpMs_ = 0;
+  uint32_t lastWaveStatsMs_ = 0;
+  WaveformStats waveStats_{};
+  WaveformView waveform_;
 
+  lv_timer_t *touchTimer_ = nullptr;
   lv_obj_t *screen_ = nullptr;
   lv_obj_t *logoImg_ = nullptr;
   lv_obj_t *timeLabel_ = nullptr;
@@ -76,17 +129,26 @@ class UiManager {
   lv_obj_t *pageTrends_ = nullptr;
   lv_obj_t *pageDevice_ = nullptr;
   lv_obj_t *pageRecord_ = nullptr;
+  lv_obj_t *pageWave_ = nullptr;
   lv_obj_t *navDashboard_ = nullptr;
   lv_obj_t *navTrends_ = nullptr;
   lv_obj_t *navDevice_ = nullptr;
   lv_obj_t *navRecord_ = nullptr;
+  lv_obj_t *navWave_ = nullptr;
   lv_obj_t *hrValueLabel_ = nullptr;
   lv_obj_t *spo2ValueLabel_ = nullptr;
   lv_obj_t *rriValueLabel_ = nullptr;
   lv_obj_t *hrvValueLabel_ = nullptr;
+  lv_obj_t *waveHrLabel_ = nullptr;
+  lv_obj_t *waveStatsLabel_ = nullptr;
   lv_obj_t *deviceInfoLabel_ = nullptr;
+  lv_obj_t *bleStreamLabel_ = nullptr;
   lv_obj_t *rtcHelpLabel_ = nullptr;
+  lv_obj_t *perfButton_ = nullptr;
+  lv_obj_t *perfCard_ = nullptr;
+  lv_obj_t *perfLabel_ = nullptr;
   lv_obj_t *recordStatusLabel_ = nullptr;
+  lv_obj_t *recordStatsLabel_ = nullptr;
   lv_obj_t *recordButton_ = nullptr;
   lv_obj_t *recordButtonLabel_ = nullptr;
   lv_obj_t *modeButtons_[4] = {nullptr};
@@ -95,6 +157,7 @@ class UiManager {
   lv_chart_series_t *spo2Series_ = nullptr;
   lv_chart_series_t *rriSeries_ = nullptr;
   lv_chart_series_t *hrvSeries_ = nullptr;
+  lv_obj_t *trendRangeLabel_ = nullptr;
   lv_obj_t *hrTrendChart_ = nullptr;
   lv_obj_t *heroHrTrendChart_ = nullptr;
   lv_obj_t *spo2TrendChart_ = nullptr;
@@ -0,0 +1,426 @@
+#include "usb_link.h"
+
+#include <esp_timer.h>
+#include <recording_format.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "logger.h"
+
+namespace {
+
+int16_t toMilliG(float g) {
+  return static_cast<int16_t>(constrain(lroundf(g * 1000.0f), -32768L, 32767L));
+}
+
+uint16_t toX1000(float value) {
+  return static_cast<uint16_t>(constrain(lroundf(value * 1000.0f), 0L, 65535L));
+}
+
+}  // namespace
+
+void UsbLink::begin(const char *deviceName) {
+  deviceName_ = deviceName != nullptr ? deviceName : "";
+  txMutex_ = xSemaphoreCreateMutex();
+  LOG_INFO(System, "USB: console ready, commands RTC=..., LOG=...; binary protocol v%u",
+           ergo::kUsbProtocolVersion);
+}
+
+void UsbLink::setSensor(const SensorManager *sensor) { sensor_ = sensor; }
+
+void UsbLink::setRtc(RtcManager *rtc) { rtc_ = rtc; }
+
+void UsbLink::setPerfMonitor(const PerfMonitor *perf) { perf_ = perf; }
+
+bool UsbLink::binaryMode() const { return binary_; }
+
+bool UsbLink::capturing() const { return capturing_; }
+
+void UsbLink::poll() {
+  const uint32_t startUs = micros();
+  readPort();
+  if (binary_ && !Serial) {
+    LOG_INFO(System, "USB: host disconnected");
+    leaveBinary();
+  }
+  if (!capturing_) {
+    return;
+  }
+
+  const uint32_t nowMs = millis();
+  if (pumpSamples()) {
+    sendDiagnostics();
+  } else if (nowMs - pendingSince_ >= cfg::kUsbHostTimeoutMs) {
+    LOG_WARN(System, "USB: host stopped reading, capture stopped");
+    leaveBinary();
+    return;
+  }
+  if (nowMs - lastCountersMs_ >= cfg::kUsbCountersPeriodMs) {
+    sendCounters(nowMs);
+    sendPerf();
+  }
+
+  const uint32_t elapsedUs = micros() - startUs;
+  lockTx();
+  if (elapsedUs > counters_.pumpMaxUs) {
+    counters_.pumpMaxUs = elapsedUs;
+  }
+  unlockTx();
+}
+
+void UsbLink::readPort() {
+  while (Serial.available() > 0) {
+    const uint8_t byte = static_cast<uint8_t>(Serial.read());
+    if (decoder_.push(byte)) {
+      handleFrame();
+      lineLength_ = 0;
+      lineOverflow_ = false;
+      continue;
+    }
+    if (binary_) {
+      continue;
+    }
+    // Text mode. A zero byte ends a frame, so whatever text came before it
+    // was part of one.
+    if (byte == 0U) {
+      lineLength_ = 0;
+      lineOverflow_ = false;
+    } else if (byte == '\n' || byte == '\r') {
+      if (lineLength_ > 0U && !lineOverflow_) {
+        handleLine();
+      }
+      lineLength_ = 0;
+      lineOverflow_ = false;
+    } else if (lineLength_ < cfg::kUsbCommandMaxBytes) {
+      line_[lineLength_++] = static_cast<char>(byte);
+    } else {
+      lineOverflow_ = true;
+    }
+  }
+}
+
+void UsbLink::handleLine() {
+  line_[lineLength_] = '\0';
+  const char *line = line_;
+  while (*line == ' ' || *line == '\t') {
+    ++line;
+  }
+  runCommand(line);
+}
+
+ergo::UsbStatus UsbLink::runCommand(const char *line) {
+  if (RtcManager::isCommand(line)) {
+    return rtc_ != nullptr && rtc_->handleCommand(line) ? ergo::UsbStatus::Ok
+                                                         : ergo::UsbStatus::Failed;
+  }
+  if (logCommand(line)) {
+    return ergo::UsbStatus::Ok;
+  }
+  return ergo::UsbStatus::Unknown;
+}
+
+ergo::UsbStatus UsbLink::setRtc(const uint8_t *payload, size_t size) {
+  ergo::UsbDateTime time;
+  if (!ergo::parseUsbDateTime(payload, size, time)) {
+    return ergo::UsbStatus::Malformed;
+  }
+  if (rtc_ == nullptr || !rtc_->setDateTime(time.year, time.month, time.day, time.hour,
+                                            time.minute, time.second)) {
+    LOG_WARN(Rtc, "RTC set over USB failed");
+    return ergo::UsbStatus::Failed;
+  }
+  LOG_INFO(Rtc, "RTC set over USB: %04u-%02u-%02u %02u:%02u:%02u", time.year, time.month,
+           time.day, time.hour, time.minute, time.second);
+  return ergo::UsbStatus::Ok;
+}
+
+void UsbLink::handleFrame() {
+  const ergo::UsbMessage type = decoder_.type();
+  if (type == ergo::UsbMessage::Hello) {
+    enterBinary();
+    sendInfo();
+    return;
+  }
+  // Frames only count once a host said Hello.
+  if (!binary_) {
+    return;
+  }
+
+  const uint16_t sequence = decoder_.sequence();
+  ergo::UsbStatus status = ergo::UsbStatus::Ok;
+  switch (type) {
+    case ergo::UsbMessage::Command: {
+      char command[cfg::kUsbCommandMaxBytes + 1];
+      const size_t size = decoder_.payloadSize();
+      if (size == 0U || size > cfg::kUsbCommandMaxBytes) {
+        status = ergo::UsbStatus::Malformed;
+        break;
+      }
+      memcpy(command, decoder_.payload(), size);
+      command[size] = '\0';
+      status = runCommand(command);
+      break;
+    }
+    case ergo::UsbMessage::SetRtc:
+      status = setRtc(decoder_.payload(), decoder_.payloadSize());
+      break;
+    case ergo::UsbMessage::StartCapture:
+      if (sensor_ == nullptr) {
+        status = ergo::UsbStatus::Failed;
+      } else {
+        startCapture();
+      }
+      break;
+    case ergo::UsbMessage::StopCapture:
+      if (capturing_) {
+        capturing_ = false;
+        LOG_INFO(System, "USB: capture stopped");
+      }
+      break;
+    case ergo::UsbMessage::Bye:
+      sendAck(type, sequence, status);
+      leaveBinary();
+      return;
+    default:
+      status = ergo::UsbStatus::Unknown;
+      break;
+  }
+  sendAck(type, sequence, status);
+}
+
+void UsbLink::enterBinary() {
+  capturing_ = false;
+  pendingSize_ = 0;
+  if (!binary_) {
+    binary_ = true;
+    logSetSink(&UsbLink::logSink, this);
+    LOG_INFO(System, "USB: host attached, binary protocol");
+  }
+}
+
+void UsbLink::leaveBinary() {
+  capturing_ = false;
+  pendingSize_ = 0;
+  if (binary_) {
+    binary_ = false;
+    logSetSink(nullptr, nullptr);
+    LOG_INFO(System, "USB: text console");
+  }
+}
+
+void UsbLink::startCapture() {
+  sampleCursor_ = sensor_->rawSamples().head();
+  pendingSize_ = 0;
+  lockTx();
+  counters_ = ergo::UsbCounters();
+  unlockTx();
+  rxFramesBase_ = decoder_.frames();
+  rxErrorsBase_ = decoder_.errors();
+  lastCountersMs_ = millis();
+  capturing_ = true;
+  LOG_INFO(System, "USB: capture started at sample %lu",
+           static_cast<unsigned long>(sampleCursor_));
+}
+
+bool UsbLink::pumpSamples() {
+  const RawSampleRing &ring = sensor_->rawSamples();
+  for (;;) {
+    if (pendingSize_ > 0U) {
+      if (!sendFrame(ergo::UsbMessage::Samples, pending_, pendingSize_, false)) {
+        lockTx();
+        ++counters_.txStalls;
+        unlockTx();
+        return false;
+      }
+      lockTx();
+      counters_.samplesSent +=
+          static_cast<uint32_t>((pendingSize_ - ergo::kUsbSamplesHeaderSize) /
+                                ergo::kUsbSampleSize);
+      unlockTx();
+      pendingSize_ = 0;
+    }
+
+    RawSample samples[ergo::kUsbMaxSamplesPerFrame];
+    uint32_t dropped = 0;
+    const size_t count =
+        ring.read(sampleCursor_, samples, ergo::kUsbMaxSamplesPerFrame, &dropped);
+    if (dropped > 0U) {
+      lockTx();
+      counters_.samplesDropped += dropped;
+      unlockTx();
+    }
+    if (count == 0U) {
+      return true;
+    }
+
+    ergo::serializeUsbSamplesHeader(sampleCursor_ - static_cast<uint32_t>(count), pending_);
+    for (size_t i = 0; i < count; ++i) {
+      ergo::StreamSample sample;
+      sample.timestampMs = samples[i].timestampMs;
+      sample.ir = samples[i].ir;
+      sample.red = samples[i].red;
+      sample.accelXmg = samples[i].accelXmg;
+      sample.accelYmg = samples[i].accelYmg;
+      sample.accelZmg = samples[i].accelZmg;
+      ergo::serializeUsbSample(
+          sample, pending_ + ergo::kUsbSamplesHeaderSize + i * ergo::kUsbSampleSize);
+    }
+    pendingSize_ = ergo::kUsbSamplesHeaderSize + count * ergo::kUsbSampleSize;
+    pendingSince_ = millis();
+  }
+}
+
+void UsbLink::sendDiagnostics() {
+  const VitalData vitals = sensor_->latest();
+  const SensorDiagnostics diagnostics = sensor_->diagnostics();
+  ergo::UsbDiagnostics out;
+  out.timestampMs = millis();
+  out.hr = vitals.hr;
+  out.spo2X100 = vitals.spo2_x100;
+  out.rriMs = vitals.rri;
+  out.hrvMs = vitals.hrv;
+  out.status = vitals.status;
+  out.flags = (diagnostics.imuReady ? ergo::kUsbDiagImuReady : 0U) |
+              (diagnostics.fingerPresent ? ergo::kUsbDiagFingerPresent : 0U) |
+              (diagnostics.peakDetected ? ergo::kUsbDiagPeakDetected : 0U) |
+              (diagnostics.rriAccepted ? ergo::kUsbDiagRriAccepted : 0U);
+  out.motionState = diagnostics.motionState;
+  out.irRaw = diagnostics.irRaw;
+  out.redRaw = diagnostics.redRaw;
+  out.irFiltered = diagnostics.irFiltered;
+  out.accelXmg = toMilliG(diagnostics.accelX);
+  out.accelYmg = toMilliG(diagnostics.accelY);
+  out.accelZmg = toMilliG(diagnostics.accelZ);
+  out.accelMagnitudeMg = toX1000(diagnostics.accelMagnitude);
+  out.motionX1000 = toX1000(diagnostics.motionScore);
+
+  uint8_t payload[ergo::kUsbDiagnosticsSize];
+  ergo::serializeUsbDiagnostics(out, payload);
+  sendFrame(ergo::UsbMessage::Diagnostics, payload, sizeof(payload), true);
+}
+
+void UsbLink::sendCounters(uint32_t nowMs) {
+  lastCountersMs_ = nowMs;
+  lockTx();
+  ergo::UsbCounters counters = counters_;
+  unlockTx();
+  counters.uptimeUs = static_cast<uint64_t>(esp_timer_get_time());
+  const uint32_t backlog = sensor_->rawSamples().head() - sampleCursor_;
+  // The ring keeps one slot back from readers.
+  counters.samplesBacklog = backlog < cfg::kRawSampleRingSize
+                                ? backlog
+                                : static_cast<uint32_t>(cfg::kRawSampleRingSize) - 1U;
+  counters.rxFrames = decoder_.frames() - rxFramesBase_;
+  counters.rxErrors = decoder_.errors() - rxErrorsBase_;
+  counters.logDropped = 0;
+  for (size_t i = 0; i < static_cast<size_t>(LogModule::Count); ++i) {
+    counters.logDropped += logDropped(static_cast<LogModule>(i));
+  }
+  counters.freeHeap = ESP.getFreeHeap();
+  counters.minFreeHeap = ESP.getMinFreeHeap();
+
+  uint8_t payload[ergo::kUsbCountersSize];
+  ergo::serializeUsbCounters(counters, payload);
+  sendFrame(ergo::UsbMessage::Counters, payload, sizeof(payload), true);
+}
+
+void UsbLink::sendPerf() {
+  if (perf_ == nullptr) {
+    return;
+  }
+  const PerfSnapshot snapshot = perf_->snapshot();
+  ergo::UsbPerf out;
+  out.timestampMs = snapshot.timestampMs;
+  out.periodMs = snapshot.ui.periodMs;
+  out.frames = snapshot.ui.frames;
+  out.renderUsAvg = snapshot.ui.renderUsAvg;
+  out.renderUsMax = snapshot.ui.renderUsMax;
+  out.flushUsAvg = snapshot.ui.flushUsAvg;
+  out.flushUsMax = snapshot.ui.flushUsMax;
+  out.missedDeadlines = snapshot.ui.missedDeadlines;
+  out.lvglUsedBytes = snapshot.ui.lvglUsedBytes;
+  out.lvglMaxUsedBytes = snapshot.ui.lvglMaxUsedBytes;
+  out.lvglTotalBytes = snapshot.ui.lvglTotalBytes;
+  out.lvglFragPct = snapshot.ui.lvglFragPct;
+  out.internalFreeBytes = snapshot.internalFreeBytes;
+  out.internalMinFreeBytes = snapshot.internalMinFreeBytes;
+  out.internalLargestBlock = snapshot.internalLargestBlock;
+  out.psramFreeBytes = snapshot.psramFreeBytes;
+  out.taskCount = static_cast<uint8_t>(
+      std::min<size_t>(snapshot.taskCount, ergo::kUsbMaxPerfTasks));
+  for (uint8_t i = 0; i < out.taskCount; ++i) {
+    strncpy(out.tasks[i].name, snapshot.tasks[i].name, sizeof(out.tasks[i].name) - 1U);
+    out.tasks[i].minFreeBytes = snapshot.tasks[i].minFreeBytes;
+  }
+
+  uint8_t payload[ergo::kUsbMaxPerfSize];
+  const size_t size = ergo::serializeUsbPerf(out, payload);
+  sendFrame(ergo::UsbMessage::Perf, payload, size, true);
+}
+
+void UsbLink::sendInfo() {
+  uint8_t payload[ergo::kUsbInfoHeaderSize + 32];
+  payload[0] = ergo::kUsbProtocolVersion;
+  ergo::writeLe32(payload + 1, millis());
+  size_t nameLength = strlen(deviceName_);
+  if (nameLength > sizeof(payload) - ergo::kUsbInfoHeaderSize) {
+    nameLength = sizeof(payload) - ergo::kUsbInfoHeaderSize;
+  }
+  memcpy(payload + ergo::kUsbInfoHeaderSize, deviceName_, nameLength);
+  sendFrame(ergo::UsbMessage::Info, payload, ergo::kUsbInfoHeaderSize + nameLength, true);
+}
+
+void UsbLink::sendAck(ergo::UsbMessage request, uint16_t sequence,
+                      ergo::UsbStatus status) {
+  ergo::UsbAck ack;
+  ack.request = request;
+  ack.requestSequence = sequence;
+  ack.status = status;
+  uint8_t payload[ergo::kUsbAckSize];
+  ergo::serializeUsbAck(ack, payload);
+  sendFrame(ergo::UsbMessage::Ack, payload, sizeof(payload), true);
+}
+
+bool UsbLink::sendFrame(ergo::UsbMessage type, const uint8_t *payload, size_t size,
+                        bool dropIfFull) {
+  const size_t worstCase = ergo::cobsMaxEncodedSize(size + ergo::kUsbFrameOverhead) + 1U;
+  bool sent = false;
+  lockTx();
+  if (Serial.availableForWrite() >= static_cast<int>(worstCase)) {
+    const size_t encoded =
+        ergo::encodeUsbFrame(type, txSequence_, payload, size, txBuffer_, sizeof(txBuffer_));
+    if (encoded > 0U) {
+      Serial.write(txBuffer_, encoded);
+      ++txSequence_;
+      ++counters_.framesSent;
+      counters_.bytesSent += static_cast<uint32_t>(encoded);
+      sent = true;
+    }
+  }
+  if (!sent && dropIfFull) {
+    ++counters_.framesDropped;
+  }
+  unlockTx();
+  return sent;
+}
+
+void UsbLink::lockTx() {
+  if (txMutex_ != nullptr) {
+    xSemaphoreTake(txMutex_, portMAX_DELAY);
+  }
+}
+
+void UsbLink::unlockTx() {
+  if (txMutex_ != nullptr) {
+    xSemaphoreGive(txMutex_);
+  }
+}
+
+void UsbLink::logSink(const uint8_t *line, size_t length, void *context) {
+  auto *link = static_cast<UsbLink *>(context);
+  while (length > 0U && (line[length - 1U] == '\n' || line[length - 1U] == '\r')) {
+    --length;
+  }
+  link->sendFrame(ergo::UsbMessage::Log, line, length, true);
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Arduino.h>
+#include <usb_protocol.h>
+
+#include "config.h"
+#include "perf_monitor.h"
+#include "rtc_manager.h"
+#include "sensor_manager.h"
+
+// USB CDC console. In text mode it runs RTC=/LOG= command lines; a host that
+// sends Hello switches it to the framed protocol in usb_protocol.h, which
+// carries the same commands and streams raw samples, diagnostics, counters
+// and perf snapshots for bench captures. Only usb_task reads the port;
+// frames are written by usb_task and, for log lines, by log_task.
+class UsbLink {
+ public:
+  void begin(const char *deviceName);
+  void setSensor(const SensorManager *sensor);
+  void setRtc(RtcManager *rtc);
+  void setPerfMonitor(const PerfMonitor *perf);
+  // Handles what the host sent and, while capturing, sends what the sensor
+  // produced since the last call. Never waits on the port.
+  void poll();
+  bool binaryMode() const;
+  bool capturing() const;
+
+ private:
+  void readPort();
+  void handleLine();
+  void handleFrame();
+  ergo::UsbStatus runCommand(const char *line);
+  ergo::UsbStatus setRtc(const uint8_t *payload, size_t size);
+  void enterBinary();
+  void leaveBinary();
+  void startCapture();
+  // False while a samples frame is still waiting for room.
+  bool pumpSamples();
+  void sendDiagnostics();
+  void sendCounters(uint32_t nowMs);
+  void sendPerf();
+  void sendInfo();
+  void sendAck(ergo::UsbMessage request, uint16_t sequence, ergo::UsbStatus status);
+  // Sends one frame if the CDC buffer has room for it. Otherwise returns
+  // false and, with `dropIfFull`, counts it in framesDropped.
+  bool sendFrame(ergo::UsbMessage type, const uint8_t *payload, size_t size,
+                 bool dropIfFull);
+  void lockTx();
+  void unlockTx();
+  static void logSink(const uint8_t *line, size_t length, void *context);
+
+  const SensorManager *sensor_ = nullptr;
+  RtcManager *rtc_ = nullptr;
+  const PerfMonitor *perf_ = nullptr;
+  const char *deviceName_ = "";
+  SemaphoreHandle_t txMutex_ = nullptr;
+  ergo::UsbFrameDecoder decoder_;
+  char line_[cfg::kUsbCommandMaxBytes + 1] = {};
+  size_t lineLength_ = 0;
+  bool lineOverflow_ = false;
+  bool binary_ = false;
+  bool capturing_ = false;
+  // Guarded by txMutex_.
+  uint16_t txSequence_ = 0;
+  uint8_t txBuffer_[ergo::kUsbMaxEncodedFrame];
+  ergo::UsbCounters counters_;
+  // A samples frame the CDC buffer had no room for, resent before anything
+  // else is read from the ring.
+  uint8_t pending_[ergo::kUsbMaxPayload];
+  size_t pendingSize_ = 0;
+  uint32_t pendingSince_ = 0;
+  uint32_t sampleCursor_ = 0;
+  uint32_t rxFramesBase_ = 0;
+  uint32_t rxErrorsBase_ = 0;
+  uint32_t lastCountersMs_ = 0;
+};
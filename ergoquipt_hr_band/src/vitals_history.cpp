@@ -0,0 +1,257 @@
+#include "vitals_history.h"
+
+#include <SD_MMC.h>
+
+#include <crc32.h>
+#include <recording_format.h>
+
+#include "logger.h"
+
+namespace {
+
+constexpr uint8_t kSpillMagic[4] = {'E', 'R', 'G', 'H'};
+constexpr uint16_t kSpillVersion = 1;
+constexpr size_t kSpillHeaderSize = 32;
+constexpr size_t kPageBytes = ergo::kHistoryPageRecords * ergo::kVitalsRecordSize;
+
+uint32_t slotOffset(uint32_t page) {
+  return static_cast<uint32_t>(kSpillHeaderSize) +
+         (page % cfg::kHistorySpillPages) * static_cast<uint32_t>(kPageBytes);
+}
+
+}  // namespace
+
+void VitalsHistory::begin(bool sdReady) {
+  spillMutex_ = xSemaphoreCreateMutex();
+  uint32_t pages = cfg::kHistoryRamPages;
+  ram_ = static_cast<ergo::VitalsRecord *>(
+      ps_malloc(pages * ergo::kHistoryPageRecords * sizeof(ergo::VitalsRecord)));
+  if (ram_ == nullptr) {
+    pages = cfg::kHistoryFallbackPages;
+    ram_ = static_cast<ergo::VitalsRecord *>(
+        malloc(pages * ergo::kHistoryPageRecords * sizeof(ergo::VitalsRecord)));
+  }
+  ramCapacity_ = ram_ != nullptr ? pages * ergo::kHistoryPageRecords : 0U;
+
+  const bool spilling = sdReady && openSpillFile();
+  // Rows from the partial page before a reboot may already be on a phone;
+  // skip that page so a sequence number never means two different rows.
+  nextSequence_ = spillNextPage_ > 0U ? (spillNextPage_ + 1U) * ergo::kHistoryPageRecords
+                                      : 0U;
+  ramOldest_ = nextSequence_;
+  LOG_INFO(History, "History: %lu rows in RAM, spill %s, next seq=%lu",
+                    static_cast<unsigned long>(ramCapacity_), spilling ? "on" : "off",
+                    static_cast<unsigned long>(nextSequence_));
+}
+
+bool VitalsHistory::openSpillFile() {
+  bool valid = false;
+  if (SD_MMC.exists(cfg::kHistoryPath)) {
+    File file = SD_MMC.open(cfg::kHistoryPath, FILE_READ);
+    uint8_t header[kSpillHeaderSize];
+    if (file && file.read(header, sizeof(header)) == sizeof(header) &&
+        memcmp(header, kSpillMagic, sizeof(kSpillMagic)) == 0 &&
+        ergo::readLe16(header + 4) == kSpillVersion &&
+        ergo::readLe16(header + 6) == ergo::kVitalsRecordSize &&
+        ergo::readLe16(header + 8) == ergo::kHistoryPageRecords &&
+        ergo::readLe32(header + 12) == cfg::kHistorySpillPages &&
+        ergo::readLe32(header + 28) == ergo::crc32(header, 28)) {
+      spillFirstPage_ = ergo::readLe32(header + 16);
+      spillNextPage_ = ergo::readLe32(header + 20);
+      valid = spillFirstPage_ <= spillNextPage_;
+    }
+    file.close();
+  }
+
+  if (!valid) {
+    spillFirstPage_ = 0;
+    spillNextPage_ = 0;
+    File created = SD_MMC.open(cfg::kHistoryPath, FILE_WRITE);
+    if (!created) {
+      return false;
+    }
+    created.close();
+  }
+  spillFile_ = SD_MMC.open(cfg::kHistoryPath, "r+");
+  return spillFile_ && (valid || writeSpillHeader());
+}
+
+bool VitalsHistory::writeSpillHeader() {
+  uint8_t header[kSpillHeaderSize] = {0};
+  memcpy(header, kSpillMagic, sizeof(kSpillMagic));
+  ergo::writeLe16(header + 4, kSpillVersion);
+  ergo::writeLe16(header + 6, ergo::kVitalsRecordSize);
+  ergo::writeLe16(header + 8, ergo::kHistoryPageRecords);
+  ergo::writeLe32(header + 12, cfg::kHistorySpillPages);
+  ergo::writeLe32(header + 16, spillFirstPage_);
+  ergo::writeLe32(header + 20, spillNextPage_);
+  ergo::writeLe32(header + 28, ergo::crc32(header, 28));
+  return spillFile_.seek(0) && spillFile_.write(header, sizeof(header)) == sizeof(header);
+}
+
+void VitalsHistory::append(const VitalData &data, uint8_t batteryPercent,
+                           const RtcSnapshot &rtc) {
+  if (ram_ == nullptr) {
+    return;
+  }
+  ergo::VitalsRecord record;
+  record.timestampMs = millis();
+  record.rtcSeconds = rtcSeconds(rtc);
+  record.hr = data.hr;
+  record.spo2X100 = data.spo2_x100;
+  record.rri = data.rri;
+  record.hrv = data.hrv;
+  record.status = data.status;
+  record.batteryPercent = batteryPercent;
+
+  portENTER_CRITICAL(&dataMux_);
+  record.sequence = nextSequence_;
+  ram_[nextSequence_ % ramCapacity_] = record;
+  ++nextSequence_;
+  if (nextSequence_ - ramOldest_ > ramCapacity_) {
+    ramOldest_ = nextSequence_ - ramCapacity_;
+  }
+  portEXIT_CRITICAL(&dataMux_);
+}
+
+void VitalsHistory::spill() {
+  if (!spillFile_ || ram_ == nullptr) {
+    return;
+  }
+  xSemaphoreTake(spillMutex_, portMAX_DELAY);
+  for (;;) {
+    uint32_t page = spillNextPage_;
+    bool ready = false;
+    portENTER_CRITICAL(&dataMux_);
+    // Pages that left RAM before the card could take them are lost.
+    const uint32_t firstInRam =
+        (ramOldest_ + ergo::kHistoryPageRecords - 1U) / ergo::kHistoryPageRecords;
+    page = page > firstInRam ? page : firstInRam;
+    if ((page + 1U) * ergo::kHistoryPageRecords <= nextSequence_) {
+      const uint32_t first = page * ergo::kHistoryPageRecords;
+      for (uint32_t i = 0; i < ergo::kHistoryPageRecords; ++i) {
+        ergo::serializeVitalsRecord(ram_[(first + i) % ramCapacity_],
+                                    pageBuffer_ + i * ergo::kVitalsRecordSize);
+      }
+      ready = true;
+    }
+    portEXIT_CRITICAL(&dataMux_);
+    if (!ready) {
+      break;
+    }
+
+    cachedPage_ = UINT32_MAX;
+    if (page + 1U - spillFirstPage_ > cfg::kHistorySpillPages) {
+      spillFirstPage_ = page + 1U - cfg::kHistorySpillPages;
+    }
+    if (!spillFile_.seek(slotOffset(page)) ||
+        spillFile_.write(pageBuffer_, kPageBytes) != kPageBytes) {
+      LOG_WARN(History, "History: spill write failed");
+      break;
+    }
+    spillNextPage_ = page + 1U;
+    writeSpillHeader();
+    spillFile_.flush();
+  }
+  xSemaphoreGive(spillMutex_);
+}
+
+size_t VitalsHistory::read(uint32_t &sequence, ergo::VitalsRecord *out,
+                           size_t maxCount) {
+  if (ram_ == nullptr || maxCount == 0U) {
+    return 0;
+  }
+  for (;;) {
+    portENTER_CRITICAL(&dataMux_);
+    const uint32_t ramOldest = ramOldest_;
+    if (sequence >= ramOldest) {
+      const uint32_t available =
+          sequence < nextSequence_ ? nextSequence_ - sequence : 0U;
+      const size_t count = available < maxCount ? available : maxCount;
+      for (size_t i = 0; i < count; ++i) {
+        out[i] = ram_[(sequence + i) % ramCapacity_];
+      }
+      portEXIT_CRITICAL(&dataMux_);
+      return count;
+    }
+    portEXIT_CRITICAL(&dataMux_);
+
+    const size_t count = readSpilled(sequence, out, maxCount);
+    if (count > 0U) {
+      return count;
+    }
+    // Nothing older survives; continue with what RAM still holds.
+    sequence = ramOldest;
+  }
+}
+
+size_t VitalsHistory::readSpilled(uint32_t &sequence, ergo::VitalsRecord *out,
+                                  size_t maxCount) {
+  if (spillMutex_ == nullptr) {
+    return 0;
+  }
+  xSemaphoreTake(spillMutex_, portMAX_DELAY);
+  size_t count = 0;
+  if (spillFile_) {
+    uint32_t page = sequence / ergo::kHistoryPageRecords;
+    if (page < spillFirstPage_) {
+      page = spillFirstPage_;
+      sequence = page * ergo::kHistoryPageRecords;
+    }
+    while (count == 0U && page < spillNextPage_) {
+      if (loadPage(page)) {
+        // Slots of skipped pages still hold older rows; the sequence check
+        // rejects them.
+        for (uint32_t i = sequence % ergo::kHistoryPageRecords;
+             i < ergo::kHistoryPageRecords && count < maxCount; ++i) {
+          ergo::VitalsRecord record;
+          ergo::parseVitalsRecord(pageBuffer_ + i * ergo::kVitalsRecordSize, record);
+          if (record.sequence != page * ergo::kHistoryPageRecords + i) {
+            break;
+          }
+          out[count++] = record;
+        }
+      }
+      if (count == 0U) {
+        ++page;
+        sequence = page * ergo::kHistoryPageRecords;
+      }
+    }
+  }
+  xSemaphoreGive(spillMutex_);
+  return count;
+}
+
+bool VitalsHistory::loadPage(uint32_t page) {
+  if (cachedPage_ == page) {
+    return true;
+  }
+  cachedPage_ = UINT32_MAX;
+  if (!spillFile_.seek(slotOffset(page)) ||
+      spillFile_.read(pageBuffer_, kPageBytes) != kPageBytes) {
+    return false;
+  }
+  cachedPage_ = page;
+  return true;
+}
+
+uint32_t VitalsHistory::nextSequence() const {
+  portENTER_CRITICAL(const_cast<portMUX_TYPE *>(&dataMux_));
+  const uint32_t next = nextSequence_;
+  portEXIT_CRITICAL(const_cast<portMUX_TYPE *>(&dataMux_));
+  return next;
+}
+
+uint32_t VitalsHistory::oldestSequence() const {
+  portENTER_CRITICAL(const_cast<portMUX_TYPE *>(&dataMux_));
+  const uint32_t oldest = ramOldest_;
+  portEXIT_CRITICAL(const_cast<portMUX_TYPE *>(&dataMux_));
+  if (spillMutex_ == nullptr) {
+    return oldest;
+  }
+  xSemaphoreTake(spillMutex_, portMAX_DELAY);
+  const uint32_t spilled = spillFirstPage_ * ergo::kHistoryPageRecords;
+  const bool hasSpilled = spillFile_ && spillFirstPage_ < spillNextPage_;
+  xSemaphoreGive(spillMutex_);
+  return hasSpilled && spilled < oldest ? spilled : oldest;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include <vitals_sync.h>
+
+#include "config.h"
+#include "rtc_manager.h"
+
+// Store-and-forward history of the 1 Hz vitals rows. Recent pages live in a
+// PSRAM ring; completed pages are copied to a fixed-size ring file on the SD
+// card so a central can catch up on anything since its last sync, including
+// rows from before a reboot.
+class VitalsHistory {
+ public:
+  // `sdReady` enables the spill file; sequence numbers then resume after the
+  // last page it holds.
+  void begin(bool sdReady);
+  void append(const VitalData &data, uint8_t batteryPercent, const RtcSnapshot &rtc);
+  // Writes completed pages to the spill file. Blocks on SD I/O.
+  void spill();
+  // Copies up to `maxCount` consecutive records starting at `sequence`, or at
+  // the first stored record after it, and moves `sequence` to the first
+  // record copied. Returns 0 when `sequence` is at the live edge.
+  size_t read(uint32_t &sequence, ergo::VitalsRecord *out, size_t maxCount);
+  uint32_t nextSequence() const;
+  uint32_t oldestSequence() const;
+
+ private:
+  bool openSpillFile();
+  bool writeSpillHeader();
+  bool loadPage(uint32_t page);
+  size_t readSpilled(uint32_t &sequence, ergo::VitalsRecord *out, size_t maxCount);
+
+  ergo::VitalsRecord *ram_ = nullptr;
+  uint32_t ramCapacity_ = 0;
+  uint32_t ramOldest_ = 0;
+  uint32_t nextSequence_ = 0;
+  portMUX_TYPE dataMux_ = portMUX_INITIALIZER_UNLOCKED;
+
+  // Pages [spillFirstPage_, spillNextPage_) are in the file at slot
+  // page % kHistorySpillPages.
+  File spillFile_;
+  SemaphoreHandle_t spillMutex_ = nullptr;
+  uint32_t spillFirstPage_ = 0;
+  uint32_t spillNextPage_ = 0;
+  uint32_t cachedPage_ = UINT32_MAX;
+  uint8_t pageBuffer_[ergo::kHistoryPageRecords * ergo::kVitalsRecordSize] = {0};
+};
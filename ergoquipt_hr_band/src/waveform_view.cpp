@@ -0,0 +1,263 @@
+#include "waveform_view.h"
+
+#include <esp_timer.h>
+
+#include <algorithm>
+#include <climits>
+
+namespace {
+
+constexpr uint16_t kColumns = cfg::kWaveformColumns;
+// Columns blanked ahead of the sweep so old and new data don't touch.
+constexpr uint16_t kEraseGap = 12;
+// Beat markers are drawn this far either side of their column.
+constexpr lv_coord_t kMarkerHalf = 3;
+constexpr lv_coord_t kMarkerLift = 10;
+constexpr size_t kReadChunk = 32;
+// A flat trace still gets this many counts of vertical range.
+constexpr int32_t kMinSpan = 200;
+// Rescale when the data uses less than this share of the range.
+constexpr int32_t kShrinkPercent = 40;
+constexpr uint32_t kRescaleHoldMs = 250;
+
+}  // namespace
+
+void WaveformView::create(lv_obj_t *parent) {
+  obj_ = lv_obj_create(parent);
+  lv_obj_set_size(obj_, kColumns, cfg::kWaveformHeight);
+  lv_obj_set_style_radius(obj_, 0, 0);
+  lv_obj_set_style_border_width(obj_, 0, 0);
+  lv_obj_set_style_pad_all(obj_, 0, 0);
+  // Opaque, so LVGL starts redrawing a strip here instead of at the card.
+  lv_obj_set_style_bg_color(obj_, lv_color_hex(0x0E121A), 0);
+  lv_obj_set_style_bg_opa(obj_, LV_OPA_COVER, 0);
+  lv_obj_clear_flag(obj_, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_clear_flag(obj_, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_add_event_cb(obj_, onDraw, LV_EVENT_DRAW_MAIN, this);
+}
+
+lv_obj_t *WaveformView::object() const { return obj_; }
+
+void WaveformView::setSource(const WaveformRing *source) {
+  source_ = source;
+  restart();
+}
+
+void WaveformView::restart() {
+  cursor_ = source_ != nullptr ? source_->head() : 0U;
+  writeIndex_ = 0;
+  wrapped_ = false;
+  pendingCount_ = 0;
+  lastScaleMs_ = 0;
+  if (obj_ != nullptr) {
+    lv_obj_invalidate(obj_);
+  }
+}
+
+size_t WaveformView::pump(uint32_t nowMs) {
+  if (source_ == nullptr || obj_ == nullptr) {
+    return 0;
+  }
+
+  const uint16_t start = writeIndex_;
+  size_t added = 0;
+  WaveformSample samples[kReadChunk];
+  size_t count = 0;
+  while ((count = source_->read(cursor_, samples, kReadChunk, &stats_.dropped)) > 0U) {
+    stats_.samples += count;
+    for (size_t i = 0; i < count; ++i) {
+      const uint16_t before = writeIndex_;
+      append(samples[i]);
+      if (writeIndex_ != before) {
+        ++added;
+      }
+    }
+  }
+  if (added == 0U) {
+    return 0;
+  }
+
+  ++stats_.frames;
+  if (updateScale(nowMs) || added >= kColumns) {
+    lv_obj_invalidate(obj_);
+    ++stats_.fullRedraws;
+  } else {
+    invalidateColumns(static_cast<int32_t>(start) - kMarkerHalf,
+                      static_cast<int32_t>(added) + kEraseGap + (2 * kMarkerHalf) + 1);
+  }
+  return added;
+}
+
+WaveformStats WaveformView::takeStats() {
+  const WaveformStats stats = stats_;
+  stats_ = WaveformStats{};
+  return stats;
+}
+
+// Folds kWaveformDecimation samples into one column, keeping the extremes so
+// a decimated trace still shows the full pulse height.
+void WaveformView::append(const WaveformSample &sample) {
+  if (pendingCount_ == 0U) {
+    pending_.low = sample.ac;
+    pending_.high = sample.ac;
+    pending_.flags = 0;
+  } else {
+    pending_.low = std::min(pending_.low, sample.ac);
+    pending_.high = std::max(pending_.high, sample.ac);
+  }
+  pending_.last = sample.ac;
+  pending_.flags |= sample.flags;
+  if (++pendingCount_ < cfg::kWaveformDecimation) {
+    return;
+  }
+
+  pendingCount_ = 0;
+  columns_[writeIndex_] = pending_;
+  if (++writeIndex_ == kColumns) {
+    writeIndex_ = 0;
+    wrapped_ = true;
+  }
+}
+
+bool WaveformView::drawable(uint16_t index) const {
+  if (!wrapped_) {
+    return index < writeIndex_;
+  }
+  const uint16_t ahead = static_cast<uint16_t>((index + kColumns - writeIndex_) % kColumns);
+  return ahead >= kEraseGap;
+}
+
+void WaveformView::invalidateColumns(int32_t first, int32_t count) {
+  if (count >= kColumns) {
+    lv_obj_invalidate(obj_);
+    return;
+  }
+  first = ((first % kColumns) + kColumns) % kColumns;
+
+  lv_area_t coords;
+  lv_obj_get_coords(obj_, &coords);
+  lv_area_t strip = coords;
+  const int32_t tail = std::min<int32_t>(count, kColumns - first);
+  strip.x1 = static_cast<lv_coord_t>(coords.x1 + first);
+  strip.x2 = static_cast<lv_coord_t>(coords.x1 + first + tail - 1);
+  lv_obj_invalidate_area(obj_, &strip);
+  if (tail < count) {
+    strip.x1 = coords.x1;
+    strip.x2 = static_cast<lv_coord_t>(coords.x1 + (count - tail) - 1);
+    lv_obj_invalidate_area(obj_, &strip);
+  }
+}
+
+// Fits the range to what is on screen, with headroom above for the beat
+// markers. Held for a moment between moves so a single artefact doesn't make
+// the plot pump.
+bool WaveformView::updateScale(uint32_t nowMs) {
+  if (lastScaleMs_ != 0U && (nowMs - lastScaleMs_) < kRescaleHoldMs) {
+    return false;
+  }
+
+  int32_t low = INT32_MAX;
+  int32_t high = INT32_MIN;
+  for (uint16_t i = 0; i < kColumns; ++i) {
+    if (drawable(i)) {
+      low = std::min(low, columns_[i].low);
+      high = std::max(high, columns_[i].high);
+    }
+  }
+  if (low > high) {
+    return false;
+  }
+
+  const int32_t span = std::max(high - low, kMinSpan);
+  const int32_t range = scaleHigh_ - scaleLow_;
+  const bool clipped = low < scaleLow_ || high > scaleHigh_;
+  const bool loose = (span * 100) < (range * kShrinkPercent);
+  if (lastScaleMs_ != 0U && !clipped && !loose) {
+    return false;
+  }
+
+  const int32_t middle = low + ((high - low) / 2);
+  scaleLow_ = middle - ((span * 6) / 10);
+  scaleHigh_ = middle + ((span * 8) / 10);
+  lastScaleMs_ = nowMs;
+  return true;
+}
+
+lv_coord_t WaveformView::toY(int32_t value) const {
+  const int32_t clamped = std::min(std::max(value, scaleLow_), scaleHigh_);
+  const int64_t offset = static_cast<int64_t>(scaleHigh_ - clamped) * (cfg::kWaveformHeight - 1);
+  return static_cast<lv_coord_t>(offset / (scaleHigh_ - scaleLow_));
+}
+
+void WaveformView::onDraw(lv_event_t *event) {
+  auto *view = static_cast<WaveformView *>(lv_event_get_user_data(event));
+  const int64_t startUs = esp_timer_get_time();
+  view->draw(lv_event_get_draw_ctx(event));
+  const uint32_t drawUs = static_cast<uint32_t>(esp_timer_get_time() - startUs);
+  view->stats_.drawUsTotal += drawUs;
+  view->stats_.drawUsMax = std::max(view->stats_.drawUsMax, drawUs);
+}
+
+// Only the columns under the clip area are visited: a strip invalidated by
+// pump() costs a handful of small rectangles per band.
+void WaveformView::draw(lv_draw_ctx_t *drawCtx) {
+  lv_area_t coords;
+  lv_obj_get_coords(obj_, &coords);
+  lv_area_t clip;
+  if (!_lv_area_intersect(&clip, drawCtx->clip_area, &coords)) {
+    return;
+  }
+
+  lv_draw_rect_dsc_t axis;
+  lv_draw_rect_dsc_init(&axis);
+  axis.bg_color = lv_color_hex(0x1D2733);
+  lv_area_t area;
+  area.x1 = clip.x1;
+  area.x2 = clip.x2;
+  area.y1 = static_cast<lv_coord_t>(coords.y1 + toY(0));
+  area.y2 = area.y1;
+  lv_draw_rect(drawCtx, &axis, &area);
+
+  lv_draw_rect_dsc_t trace;
+  lv_draw_rect_dsc_init(&trace);
+  lv_draw_rect_dsc_t marker;
+  lv_draw_rect_dsc_init(&marker);
+  marker.radius = kMarkerHalf;
+
+  const int32_t first = std::max<int32_t>(clip.x1 - coords.x1 - kMarkerHalf, 0);
+  const int32_t last = std::min<int32_t>(clip.x2 - coords.x1 + kMarkerHalf, kColumns - 1);
+  for (int32_t i = first; i <= last; ++i) {
+    const uint16_t index = static_cast<uint16_t>(i);
+    if (!drawable(index)) {
+      continue;
+    }
+    const Column &column = columns_[index];
+    int32_t low = column.low;
+    int32_t high = column.high;
+    const uint16_t previous = index == 0U ? kColumns - 1U : index - 1U;
+    if (drawable(previous)) {
+      low = std::min(low, columns_[previous].last);
+      high = std::max(high, columns_[previous].last);
+    }
+
+    area.x1 = static_cast<lv_coord_t>(coords.x1 + i);
+    area.x2 = area.x1;
+    area.y1 = static_cast<lv_coord_t>(coords.y1 + toY(high));
+    area.y2 = std::min<lv_coord_t>(static_cast<lv_coord_t>(coords.y1 + toY(low) + 1), coords.y2);
+    trace.bg_color = lv_color_hex((column.flags & cfg::kWaveformFinger) != 0U ? 0xFF5A6B
+                                                                              : 0x566070);
+    lv_draw_rect(drawCtx, &trace, &area);
+
+    if ((column.flags & (cfg::kWaveformPeak | cfg::kWaveformBeat)) != 0U) {
+      const lv_coord_t markerY = static_cast<lv_coord_t>(area.y1 - kMarkerLift);
+      lv_area_t dot = {static_cast<lv_coord_t>(area.x1 - kMarkerHalf),
+                       static_cast<lv_coord_t>(markerY - kMarkerHalf),
+                       static_cast<lv_coord_t>(area.x1 + kMarkerHalf),
+                       static_cast<lv_coord_t>(markerY + kMarkerHalf)};
+      // Accepted beats in white; peaks the RR check threw out stay grey.
+      marker.bg_color = lv_color_hex((column.flags & cfg::kWaveformBeat) != 0U ? 0xF4F8FC
+                                                                               : 0x6F7C8D);
+      lv_draw_rect(drawCtx, &marker, &dot);
+    }
+  }
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#include "config.h"
+#include "sensor_manager.h"
+
+struct WaveformStats {
+  // Pumps that added at least one column.
+  uint32_t frames = 0;
+  uint32_t samples = 0;
+  // Samples the sensor overwrote before the view read them.
+  uint32_t dropped = 0;
+  uint32_t fullRedraws = 0;
+  // Time spent in the draw callback, summed over the bands LVGL renders.
+  uint32_t drawUsTotal = 0;
+  uint32_t drawUsMax = 0;
+};
+
+// Sweeping PPG trace: one column per displayed sample, written left to right
+// with a short erased gap ahead of the write position. Samples come from the
+// sensor's waveform ring through this view's own cursor, and each frame only
+// invalidates the columns that changed, so LVGL re-renders a strip a few
+// pixels wide rather than the whole plot. The Y scale follows the signal and
+// only forces a full redraw when it has to move.
+class WaveformView {
+ public:
+  void create(lv_obj_t *parent);
+  lv_obj_t *object() const;
+  void setSource(const WaveformRing *source);
+  // Clears the plot and starts the sweep at the newest sample.
+  void restart();
+  // Moves what the sensor produced since the last call onto the plot.
+  // Returns the number of columns added.
+  size_t pump(uint32_t nowMs);
+  // Returns the stats gathered since the previous call.
+  WaveformStats takeStats();
+
+ private:
+  struct Column {
+    int32_t low = 0;
+    int32_t high = 0;
+    int32_t last = 0;
+    uint8_t flags = 0;
+  };
+
+  static void onDraw(lv_event_t *event);
+  void draw(lv_draw_ctx_t *drawCtx);
+  void append(const WaveformSample &sample);
+  bool drawable(uint16_t index) const;
+  void invalidateColumns(int32_t first, int32_t count);
+  bool updateScale(uint32_t nowMs);
+  lv_coord_t toY(int32_t value) const;
+
+  lv_obj_t *obj_ = nullptr;
+  const WaveformRing *source_ = nullptr;
+  uint32_t cursor_ = 0;
+  Column columns_[cfg::kWaveformColumns];
+  uint16_t writeIndex_ = 0;
+  bool wrapped_ = false;
+  Column pending_;
+  uint8_t pendingCount_ = 0;
+  int32_t scaleLow_ = -100;
+  int32_t scaleHigh_ = 100;
+  uint32_t lastScaleMs_ = 0;
+  WaveformStats stats_;
+};
@@ -0,0 +1,181 @@
+"""Converts the UI's PNG assets into RLE-compressed LVGL image tables.
+
+Runs before every PlatformIO build (extra_scripts in platformio.ini) and only
+rewrites an output that is older than its PNG or this script. It can also be
+run by hand from ergoquipt_hr_band/:
+
+    python tools/assets/build_assets.py
+
+The format is decoded by src/image_asset.cpp: a control byte n < 0x80 is
+followed by n + 1 literal pixels, n >= 0x80 by one pixel repeated n - 0x7E
+times. Pixels are RGB565 in LV_COLOR_16_SWAP byte order, followed by an
+alpha byte when the PNG has an alpha channel.
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+# (PNG under tools/assets, generated source, header it includes, symbol)
+ASSETS = [
+    ("ergo_logo.png", "src/logo_asset.cpp", "logo_asset.h", "ergo_logo"),
+]
+
+# Must match -DLV_COLOR_16_SWAP in platformio.ini.
+SWAP_565 = True
+
+MAX_LITERAL = 128
+MAX_REPEAT = 129
+BYTES_PER_LINE = 18
+
+
+def read_png(path):
+    """Returns (width, height, has_alpha, rows of (r, g, b, a) tuples)."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s: not a PNG" % path)
+    pos = 8
+    idat = b""
+    header = None
+    while pos < len(data):
+        (length,) = struct.unpack(">I", data[pos:pos + 4])
+        kind = data[pos + 4:pos + 8]
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", body)
+        elif kind == b"IDAT":
+            idat += body
+        pos += 12 + length
+    width, height, depth, color_type, _, _, interlace = header
+    if depth != 8 or color_type not in (2, 6) or interlace != 0:
+        raise ValueError("%s: only 8-bit RGB/RGBA, non-interlaced" % path)
+    channels = 4 if color_type == 6 else 3
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        kind = raw[start]
+        line = bytearray(raw[start + 1:start + 1 + stride])
+        for x in range(stride):
+            left = line[x - channels] if x >= channels else 0
+            up = previous[x]
+            up_left = previous[x - channels] if x >= channels else 0
+            if kind == 1:
+                line[x] = (line[x] + left) & 0xFF
+            elif kind == 2:
+                line[x] = (line[x] + up) & 0xFF
+            elif kind == 3:
+                line[x] = (line[x] + ((left + up) >> 1)) & 0xFF
+            elif kind == 4:
+                p = left + up - up_left
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - up_left)
+                predictor = left if pa <= pb and pa <= pc else (up if pb <= pc else up_left)
+                line[x] = (line[x] + predictor) & 0xFF
+        rows.append([tuple(line[i:i + channels]) + ((255,) if channels == 3 else ())
+                     for i in range(0, stride, channels)])
+        previous = line
+    return width, height, channels == 4, rows
+
+
+def to_lvgl(rows, has_alpha):
+    pixels = []
+    for row in rows:
+        for r, g, b, a in row:
+            value = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+            pixel = struct.pack(">H" if SWAP_565 else "<H", value)
+            pixels.append(pixel + bytes([a]) if has_alpha else pixel)
+    return pixels
+
+
+def rle(pixels):
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            del literal[:MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            for pixel in chunk:
+                out.extend(pixel)
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < MAX_REPEAT and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            flush_literal()
+            out.append(0x7E + run)
+            out.extend(pixels[i])
+        else:
+            literal.append(pixels[i])
+        i += run
+    flush_literal()
+    return bytes(out)
+
+
+def generate(project_dir, png_name, output, header, symbol):
+    png_path = os.path.join(project_dir, "tools", "assets", png_name)
+    width, height, has_alpha, rows = read_png(png_path)
+    pixels = to_lvgl(rows, has_alpha)
+    packed = rle(pixels)
+    pixel_bytes = 3 if has_alpha else 2
+    raw_size = width * height * pixel_bytes
+
+    lines = [
+        "// Generated by tools/assets/build_assets.py from tools/assets/%s." % png_name,
+        "// Do not edit; change the PNG and rebuild.",
+        '#include "%s"' % header,
+        "",
+        "// %ux%u RGB565%s%s, RLE: %u -> %u bytes." % (
+            width, height, " (bytes swapped)" if SWAP_565 else "",
+            " + alpha" if has_alpha else "", raw_size, len(packed)),
+        "static const uint8_t %s_data[] = {" % symbol,
+    ]
+    for start in range(0, len(packed), BYTES_PER_LINE):
+        chunk = packed[start:start + BYTES_PER_LINE]
+        lines.append("  " + " ".join("0x%02X," % b for b in chunk))
+    lines += [
+        "};",
+        "",
+        "const CompressedImage %s = {" % symbol,
+        "  %u, %u, %s, %u," % (width, height,
+                               "LV_IMG_CF_TRUE_COLOR_ALPHA" if has_alpha
+                               else "LV_IMG_CF_TRUE_COLOR", pixel_bytes),
+        "  %s_data, sizeof(%s_data)," % (symbol, symbol),
+        "};",
+        "",
+    ]
+    with open(os.path.join(project_dir, output), "w", newline="\n") as f:
+        f.write("\n".join(lines))
+    print("assets: %s %ux%u %u -> %u bytes" % (png_name, width, height, raw_size, len(packed)))
+
+
+def stale(project_dir, png_name, output, script):
+    output_path = os.path.join(project_dir, output)
+    if not os.path.exists(output_path):
+        return True
+    built = os.path.getmtime(output_path)
+    sources = [os.path.join(project_dir, "tools", "assets", png_name), script]
+    return any(os.path.getmtime(source) > built for source in sources)
+
+
+def build(project_dir, force=False):
+    script = os.path.join(project_dir, "tools", "assets", "build_assets.py")
+    for png_name, output, header, symbol in ASSETS:
+        if force or stale(project_dir, png_name, output, script):
+            generate(project_dir, png_name, output, header, symbol)
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO's SCons
+    build(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        build(os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__)))),
+              force="--force" in sys.argv)
@@ -0,0 +1,145 @@
+#include "ble_central.h"
+
+#include <algorithm>
+
+#include "heart_rate_measurement.h"
+#include "vitals_payload.h"
+
+namespace ergo {
+
+namespace {
+
+const char *const kChannelNames[kBleChannelCount] = {"vitals", "hrs",  "stream",
+                                                     "sync",   "file", "version"};
+
+}  // namespace
+
+double LatencyStats::meanMs() const {
+  if (samples_.empty()) {
+    return 0.0;
+  }
+  uint64_t total = 0;
+  for (const uint64_t sample : samples_) {
+    total += sample;
+  }
+  return static_cast<double>(total) / static_cast<double>(samples_.size()) / 1000.0;
+}
+
+double LatencyStats::percentileMs(double fraction) const {
+  if (samples_.empty()) {
+    return 0.0;
+  }
+  if (!sorted_) {
+    std::sort(samples_.begin(), samples_.end());
+    sorted_ = true;
+  }
+  const size_t index = std::min(samples_.size() - 1U,
+                                static_cast<size_t>(fraction * (samples_.size() - 1U) + 0.5));
+  return static_cast<double>(samples_[index]) / 1000.0;
+}
+
+void SimCentral::receive(BleChannel channel, const uint8_t *data, size_t size,
+                         uint64_t queuedUs, uint64_t deliveredUs) {
+  CentralChannelStats &stats = channels_[static_cast<size_t>(channel)];
+  ++stats.notifications;
+  stats.bytes += size;
+  stats.link.add(deliveredUs - queuedUs);
+  switch (channel) {
+    case BleChannel::Vitals:
+      receiveVitals(data, size, deliveredUs);
+      break;
+    case BleChannel::HeartRate:
+      receiveHeartRate(data, size);
+      break;
+    case BleChannel::Stream:
+      receiveStream(data, size, deliveredUs);
+      break;
+    case BleChannel::Sync:
+    case BleChannel::File:
+    case BleChannel::Version:
+      break;
+  }
+}
+
+void SimCentral::receiveVitals(const uint8_t *data, size_t size, uint64_t deliveredUs) {
+  CentralChannelStats &stats = channels_[static_cast<size_t>(BleChannel::Vitals)];
+  if (size == kVitalsPayloadV1Size) {
+    // v1 carries no history sequence, only the reading itself.
+    VitalsReading reading;
+    uint8_t sequence = 0;
+    if (!decodeVitalsPayloadV1(data, size, reading, sequence)) {
+      ++stats.malformed;
+      return;
+    }
+    ++v1Payloads_;
+    if (v2Payloads_ > 0U) {
+      ++v1AfterV2_;
+    }
+    ++readings_;
+    return;
+  }
+  VitalsPayloadHeader header;
+  VitalsReading readings[kVitalsPayloadV2MaxReadings];
+  if (!decodeVitalsPayloadV2(data, size, header, readings, kVitalsPayloadV2MaxReadings)) {
+    ++stats.malformed;
+    return;
+  }
+  ++v2Payloads_;
+  if (vitalsStarted_ && header.firstSequence - nextReading_ < 0x80000000U) {
+    readingsLost_ += header.firstSequence - nextReading_;
+  }
+  vitalsStarted_ = true;
+  nextReading_ = header.firstSequence + header.count;
+  readings_ += header.count;
+  const uint64_t producedUs = firstReadingUs_ + header.firstSequence * readingPeriodUs_;
+  stats.age.add(deliveredUs > producedUs ? deliveredUs - producedUs : 0U);
+}
+
+void SimCentral::receiveHeartRate(const uint8_t *data, size_t size) {
+  HeartRateMeasurement measurement;
+  uint16_t rr1024[256];
+  size_t rrCount = 0;
+  if (!parseHeartRateMeasurement(data, size, measurement, rr1024, 256, rrCount)) {
+    ++channels_[static_cast<size_t>(BleChannel::HeartRate)].malformed;
+    return;
+  }
+  rrIntervals_ += rrCount;
+}
+
+void SimCentral::receiveStream(const uint8_t *data, size_t size, uint64_t deliveredUs) {
+  CentralChannelStats &stats = channels_[static_cast<size_t>(BleChannel::Stream)];
+  StreamFrameHeader header;
+  if (!parseStreamHeader(data, size, header) ||
+      (size - kStreamHeaderSize) % kStreamSampleSize != 0U) {
+    ++stats.malformed;
+    return;
+  }
+  stream_.accept(header, (size - kStreamHeaderSize) / kStreamSampleSize);
+  const uint64_t producedUs = static_cast<uint64_t>(header.firstSampleMs) * 1000U;
+  stats.age.add(deliveredUs > producedUs ? deliveredUs - producedUs : 0U);
+}
+
+void SimCentral::print(FILE *out, double seconds) const {
+  for (size_t i = 0; i < kBleChannelCount; ++i) {
+    const CentralChannelStats &stats = channels_[i];
+    if (stats.notifications == 0U) {
+      continue;
+    }
+    fprintf(out,
+            "  %-6s %7llu notify %9.1f B/s  link p50/p99/max %.1f/%.1f/%.1f ms",
+            kChannelNames[i], static_cast<unsigned long long>(stats.notifications),
+            seconds > 0.0 ? static_cast<double>(stats.bytes) / seconds : 0.0,
+            stats.link.percentileMs(0.5), stats.link.percentileMs(0.99),
+            stats.link.percentileMs(1.0));
+    if (stats.age.count() > 0U) {
+      fprintf(out, "  age p50/p99 %.1f/%.1f ms", stats.age.percentileMs(0.5),
+              stats.age.percentileMs(0.99));
+    }
+    if (stats.malformed > 0U) {
+      fprintf(out, "  %llu malformed", static_cast<unsigned long long>(stats.malformed));
+    }
+    fprintf(out, "\n");
+  }
+}
+
+}  // namespace ergo
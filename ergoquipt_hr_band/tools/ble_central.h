@@ -0,0 +1,87 @@
+#pragma once
+
+// Host central for LoopbackLink: decodes what the device notifies on the
+// vitals, Heart Rate Measurement and stream characteristics and keeps
+// per-channel throughput, latency and loss figures.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "ble_transport.h"
+#include "stream_format.h"
+
+namespace ergo {
+
+// Percentiles over every sample, in microseconds.
+class LatencyStats {
+ public:
+  void add(uint64_t us) { samples_.push_back(us); }
+  size_t count() const { return samples_.size(); }
+  double meanMs() const;
+  // `fraction` in [0, 1].
+  double percentileMs(double fraction) const;
+
+ private:
+  mutable std::vector<uint64_t> samples_;
+  mutable bool sorted_ = false;
+};
+
+struct CentralChannelStats {
+  uint64_t notifications = 0;
+  uint64_t bytes = 0;
+  uint64_t malformed = 0;
+  // From notify() on the device to delivery.
+  LatencyStats link;
+  // From when the oldest data in the notification was produced to delivery.
+  LatencyStats age;
+};
+
+class SimCentral {
+ public:
+  // History sequence n of the v2 payload was produced at
+  // firstReadingUs + n * readingPeriodUs.
+  SimCentral(uint64_t firstReadingUs, uint64_t readingPeriodUs)
+      : firstReadingUs_(firstReadingUs), readingPeriodUs_(readingPeriodUs) {}
+
+  void receive(BleChannel channel, const uint8_t *data, size_t size, uint64_t queuedUs,
+               uint64_t deliveredUs);
+
+  const CentralChannelStats &channel(BleChannel channel) const {
+    return channels_[static_cast<size_t>(channel)];
+  }
+  uint64_t readings() const { return readings_; }
+  // Vitals notifications per payload format, and v1 ones that still came
+  // after the first v2 one.
+  uint64_t v1Payloads() const { return v1Payloads_; }
+  uint64_t v2Payloads() const { return v2Payloads_; }
+  uint64_t v1AfterV2() const { return v1AfterV2_; }
+  // Readings missing from the history sequence.
+  uint64_t readingsLost() const { return readingsLost_; }
+  uint64_t rrIntervals() const { return rrIntervals_; }
+  const StreamGapTracker &stream() const { return stream_; }
+
+  // One line per channel that saw traffic.
+  void print(FILE *out, double seconds) const;
+
+ private:
+  void receiveVitals(const uint8_t *data, size_t size, uint64_t deliveredUs);
+  void receiveHeartRate(const uint8_t *data, size_t size);
+  void receiveStream(const uint8_t *data, size_t size, uint64_t deliveredUs);
+
+  uint64_t firstReadingUs_;
+  uint64_t readingPeriodUs_;
+  CentralChannelStats channels_[kBleChannelCount];
+  bool vitalsStarted_ = false;
+  uint32_t nextReading_ = 0;
+  uint64_t readings_ = 0;
+  uint64_t v1Payloads_ = 0;
+  uint64_t v2Payloads_ = 0;
+  uint64_t v1AfterV2_ = 0;
+  uint64_t readingsLost_ = 0;
+  uint64_t rrIntervals_ = 0;
+  StreamGapTracker stream_;
+};
+
+}  // namespace ergo
@@ -0,0 +1,117 @@
+#include "ble_loopback.h"
+
+#include <utility>
+
+namespace ergo {
+
+namespace {
+
+// T_IFS between packets.
+constexpr uint64_t kIfsUs = 150;
+// Preamble (1 byte on LE 1M, 2 on LE 2M) is added per PHY; access address,
+// header, MIC and CRC are fixed.
+constexpr size_t kPduOverheadBytes = 4U + 2U + 4U + 3U;
+// L2CAP and ATT notification headers.
+constexpr size_t kNotifyHeaderBytes = 4U + 3U;
+
+}  // namespace
+
+LoopbackLink::LoopbackLink(const LoopbackConfig &config)
+    : config_(config), nextEventUs_(config.intervalUs), rng_(config.seed | 1U) {}
+
+void LoopbackLink::subscribe(BleChannel channel, bool enabled) {
+  subscribed_[static_cast<size_t>(channel)] = enabled;
+}
+
+void LoopbackLink::write(BleChannel channel, const uint8_t *data, size_t size) {
+  Packet packet;
+  packet.channel = channel;
+  packet.data.assign(data, data + size);
+  writes_.push_back(std::move(packet));
+}
+
+bool LoopbackLink::notify(BleChannel channel, const uint8_t *data, size_t size) {
+  if (!subscribed(channel) || size + 3U > config_.mtu || queue_.size() >= config_.stackQueue) {
+    ++stats_.refused;
+    return false;
+  }
+  Packet packet;
+  packet.channel = channel;
+  packet.data.assign(data, data + size);
+  packet.queuedUs = nowUs_;
+  queue_.push_back(std::move(packet));
+  if (queue_.size() > stats_.maxQueued) {
+    stats_.maxQueued = queue_.size();
+  }
+  return true;
+}
+
+bool LoopbackLink::subscribed(BleChannel channel) const {
+  return subscribed_[static_cast<size_t>(channel)];
+}
+
+uint64_t LoopbackLink::airtimeUs(size_t size) const {
+  const size_t preamble = config_.phy >= 2U ? 2U : 1U;
+  const uint64_t bitsPerUs = config_.phy >= 2U ? 2U : 1U;
+  const uint64_t emptyUs = (preamble + kPduOverheadBytes) * 8U / bitsPerUs;
+  size_t remaining = kNotifyHeaderBytes + size;
+  uint64_t total = 0;
+  while (remaining > 0U) {
+    const size_t payload = remaining < config_.dataLength ? remaining : config_.dataLength;
+    total += (preamble + kPduOverheadBytes + payload) * 8U / bitsPerUs + kIfsUs + emptyUs +
+             kIfsUs;
+    remaining -= payload;
+  }
+  return total;
+}
+
+void LoopbackLink::runEvent() {
+  const uint64_t startUs = nextEventUs_;
+  nextEventUs_ += config_.intervalUs;
+  ++stats_.events;
+
+  // The central speaks first; its writes cost airtime like notifications.
+  uint64_t usedUs = 0;
+  while (!writes_.empty()) {
+    Packet packet = std::move(writes_.front());
+    writes_.pop_front();
+    usedUs += airtimeUs(packet.data.size());
+    ++stats_.writes;
+    if (writeHandler_) {
+      writeHandler_(packet.channel, packet.data.data(), packet.data.size());
+    }
+  }
+
+  while (!queue_.empty()) {
+    const uint64_t packetUs = airtimeUs(queue_.front().data.size());
+    // The first packet always goes out; later ones must end before the next
+    // event's anchor.
+    if (usedUs > 0U && usedUs + packetUs + kIfsUs > config_.intervalUs) {
+      break;
+    }
+    usedUs += packetUs;
+    Packet packet = std::move(queue_.front());
+    queue_.pop_front();
+    ++stats_.notifications;
+    stats_.bytes += packet.data.size();
+    if (config_.corruptPct > 0.0 && !packet.data.empty() &&
+        static_cast<double>(nextRandom() % 1000000U) < config_.corruptPct * 10000.0) {
+      packet.data[nextRandom() % packet.data.size()] ^=
+          static_cast<uint8_t>(1U << (nextRandom() % 8U));
+      ++stats_.corrupted;
+    }
+    if (receiver_) {
+      receiver_(packet.channel, packet.data.data(), packet.data.size(), packet.queuedUs,
+                startUs + usedUs);
+    }
+  }
+}
+
+uint32_t LoopbackLink::nextRandom() {
+  rng_ ^= rng_ << 13U;
+  rng_ ^= rng_ >> 17U;
+  rng_ ^= rng_ << 5U;
+  return rng_;
+}
+
+}  // namespace ergo
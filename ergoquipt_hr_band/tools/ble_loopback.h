@@ -0,0 +1,104 @@
+#pragma once
+
+// In-process stand-in for the BLE stack and radio behind ergo::BleTransport,
+// for running the device's data paths against a simulated central on the
+// host. Time is driven by the caller in microseconds.
+//
+// notify() queues the notification in a bounded stack queue and fails when
+// it is full, like the ESP32 stack does. Every connection event first hands
+// the central's writes to the device, then sends queued notifications while
+// their link-layer packets (plus the central's empty replies) fit in the
+// interval. Airtime follows the PHY and the data length: a notification
+// longer than one link-layer payload is split into several packets.
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include "ble_transport.h"
+
+namespace ergo {
+
+struct LoopbackConfig {
+  uint32_t intervalUs = 15000;
+  uint16_t mtu = 247;
+  // 1 = LE 1M, 2 = LE 2M.
+  uint8_t phy = 2;
+  // Link-layer payload bytes: 251 with data length extension, 27 without.
+  uint16_t dataLength = 251;
+  // Notifications the device stack holds before notify() fails.
+  size_t stackQueue = 16;
+  // Share of delivered notifications with one bit flipped, in percent.
+  double corruptPct = 0.0;
+  uint32_t seed = 0x2545F491U;
+};
+
+struct LoopbackStats {
+  uint64_t events = 0;
+  uint64_t notifications = 0;
+  uint64_t bytes = 0;
+  // notify() calls the queue or the MTU turned away.
+  uint64_t refused = 0;
+  uint64_t corrupted = 0;
+  uint64_t writes = 0;
+  size_t maxQueued = 0;
+};
+
+class LoopbackLink : public BleTransport {
+ public:
+  // `queuedUs` is when the device called notify(), `deliveredUs` when the
+  // last packet of the notification reached the central.
+  using Receiver = std::function<void(BleChannel channel, const uint8_t *data, size_t size,
+                                      uint64_t queuedUs, uint64_t deliveredUs)>;
+  using WriteHandler = std::function<void(BleChannel channel, const uint8_t *data, size_t size)>;
+
+  explicit LoopbackLink(const LoopbackConfig &config);
+
+  // Central side.
+  void setReceiver(Receiver receiver) { receiver_ = std::move(receiver); }
+  void subscribe(BleChannel channel, bool enabled);
+  // Reaches the device at the next connection event.
+  void write(BleChannel channel, const uint8_t *data, size_t size);
+
+  // Device side.
+  void setWriteHandler(WriteHandler handler) { writeHandler_ = std::move(handler); }
+  // Timestamp for the notifications queued from now on.
+  void setNow(uint64_t nowUs) { nowUs_ = nowUs; }
+  bool notify(BleChannel channel, const uint8_t *data, size_t size) override;
+  bool subscribed(BleChannel channel) const override;
+
+  // Runs the connection event due at nextEventUs().
+  void runEvent();
+  uint64_t nextEventUs() const { return nextEventUs_; }
+  size_t queued() const { return queue_.size(); }
+
+  // Airtime of one notification with `size` ATT payload bytes, including
+  // the central's empty replies and the inter-frame spaces.
+  uint64_t airtimeUs(size_t size) const;
+  const LoopbackConfig &config() const { return config_; }
+  const LoopbackStats &stats() const { return stats_; }
+
+ private:
+  struct Packet {
+    BleChannel channel = BleChannel::Vitals;
+    std::vector<uint8_t> data;
+    uint64_t queuedUs = 0;
+  };
+
+  uint32_t nextRandom();
+
+  LoopbackConfig config_;
+  Receiver receiver_;
+  WriteHandler writeHandler_;
+  bool subscribed_[kBleChannelCount] = {};
+  std::deque<Packet> queue_;
+  std::deque<Packet> writes_;
+  uint64_t nowUs_ = 0;
+  uint64_t nextEventUs_ = 0;
+  uint32_t rng_ = 0;
+  LoopbackStats stats_;
+};
+
+}  // namespace ergo
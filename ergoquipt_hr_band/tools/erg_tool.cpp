@@ -0,0 +1,1364 @@
+// Host-side companion for the band's recordings (.csv vitals + .erg raw).
+//
+// Build (from ergoquipt_hr_band/):
+//   g++ -std=c++17 -O2 -Ilib/ergo_protocol/src -Itools -o .pio/erg_tool
+//       tools/*.cpp lib/ergo_protocol/src/*.cpp
+//
+// Usage:
+//   erg_tool decode <file.erg>                raw samples as CSV on stdout
+//   erg_tool index <file.erg>                 session summary and per-minute index
+//   erg_tool journal <REC.jnl>                commit records left by the recorder
+//   erg_tool slice [--raw] <from_s> <to_s> <recording>...
+//                                             vitals (or raw) rows in a time window
+//   erg_tool stats [<from_s> <to_s>] <recording>...
+//                                             summary statistics
+//   erg_tool columns <out_dir> <recording>... one little-endian file per column
+//   erg_tool bench [blocks]                   codec ratio and MB/s on this host
+//   erg_tool reader-bench [MB] [dir]          reader throughput on synthetic files
+//   erg_tool payload-decode <hex>             one v2 vitals notification
+//   erg_tool payload-fuzz [iterations] [seed] v2 payload round-trip and
+//                                             corrupt-input checks
+//   erg_tool file-sim <file> [interval_ms] [window] [corrupt_pct] [mtu]
+//                                             BLE download of a file, KB/s
+//   erg_tool central-sim [seconds] [interval_ms] [mtu] [batch] [phy] [data_length]
+//                                             live BLE data paths against a
+//                                             simulated central: throughput,
+//                                             latency and loss per channel
+//   erg_tool usb-capture <port> <out_base> [seconds]
+//                                             lossless bench capture over USB
+//                                             to <out_base>.erg + .diag.csv
+//   erg_tool usb-cmd <port> <line>            console command (RTC=..., LOG=...)
+//   erg_tool usb-rtc <port>                   set the band's RTC to host time
+//
+// A <recording> is a base path or either file of a .csv/.erg pair; pass
+// rotated files in sequence order. Times are seconds since the start of the
+// first recording.
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ble_central.h"
+#include "ble_loopback.h"
+#include "codec_benchmark.h"
+#include "crc32.h"
+#include "file_transfer.h"
+#include "heart_rate_measurement.h"
+#include "recording_format.h"
+#include "recording_reader.h"
+#include "sample_codec.h"
+#include "stream_format.h"
+#include "usb_capture.h"
+#include "vitals_payload.h"
+
+namespace {
+
+uint32_t hostMicros() {
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return static_cast<uint32_t>(
+      duration_cast<microseconds>(steady_clock::now() - start).count());
+}
+
+double hostSeconds() {
+  using namespace std::chrono;
+  return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+bool readFile(const char *path, std::vector<uint8_t> &data) {
+  FILE *file = fopen(path, "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  uint8_t chunk[65536];
+  size_t count = 0;
+  while ((count = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    data.insert(data.end(), chunk, chunk + count);
+  }
+  fclose(file);
+  return true;
+}
+
+using Recordings = std::vector<std::unique_ptr<ergo::Recording>>;
+
+bool openRecordings(int argc, char **argv, Recordings &recordings) {
+  for (int i = 0; i < argc; ++i) {
+    auto recording = std::make_unique<ergo::Recording>();
+    if (!recording->open(argv[i])) {
+      fprintf(stderr, "cannot open recording %s\n", argv[i]);
+      return false;
+    }
+    // A glob such as REC000042_* names both files of one pair.
+    const bool seen = std::any_of(
+        recordings.begin(), recordings.end(),
+        [&](const auto &other) { return other->baseName() == recording->baseName(); });
+    if (!seen) {
+      recordings.push_back(std::move(recording));
+    }
+  }
+  return !recordings.empty();
+}
+
+// Converts a [from_s, to_s] window relative to the first recording into
+// device millis.
+void windowMs(const Recordings &recordings, double fromS, double toS,
+              uint32_t &fromMs, uint32_t &toMs) {
+  const uint32_t originMs = recordings.front()->startMs();
+  fromMs = originMs + static_cast<uint32_t>(std::max(0.0, fromS) * 1000.0);
+  toMs = toS * 1000.0 >= static_cast<double>(UINT32_MAX - originMs)
+             ? UINT32_MAX
+             : originMs + static_cast<uint32_t>(std::max(0.0, toS) * 1000.0);
+}
+
+void printFrame(const ergo::RawFrame &frame) {
+  printf("%lu,%ld,%ld,%ld,%ld,%ld\n", static_cast<unsigned long>(frame.timestampMs),
+         static_cast<long>(frame.ir), static_cast<long>(frame.red),
+         static_cast<long>(frame.accelXmg), static_cast<long>(frame.accelYmg),
+         static_cast<long>(frame.accelZmg));
+}
+
+int decode(const char *path) {
+  ergo::ErgFile file;
+  if (!file.open(path)) {
+    fprintf(stderr, "%s: not an .erg v%u recording\n", path, ergo::kRecordingVersion);
+    return 1;
+  }
+
+  printf("timestamp_ms,ir,red,acc_x_mg,acc_y_mg,acc_z_mg\n");
+  ergo::ErgFile::SampleCursor cursor = file.samples();
+  ergo::RawFrame frame;
+  uint64_t frames = 0;
+  while (cursor.next(frame)) {
+    printFrame(frame);
+    ++frames;
+  }
+  if (cursor.corrupt()) {
+    fprintf(stderr, "%s: stopped at a malformed or bad-CRC block\n", path);
+  }
+  fprintf(stderr, "%s: %llu frames\n", path, static_cast<unsigned long long>(frames));
+  return 0;
+}
+
+void printSummary(const char *label, const ergo::IntervalSummary &summary) {
+  printf("%s,%lu,%lu,%lu,%lu,%lu,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u\n", label,
+         static_cast<unsigned long>(summary.startMs),
+         static_cast<unsigned long>(summary.endMs),
+         static_cast<unsigned long>(summary.csvOffset),
+         static_cast<unsigned long>(summary.ergOffset),
+         static_cast<unsigned long>(summary.rows), summary.validPercent(),
+         summary.hr.min, summary.hr.max, summary.hr.mean, summary.spo2.min,
+         summary.spo2.max, summary.spo2.mean, summary.motion.min,
+         summary.motion.max, summary.motion.mean,
+         static_cast<unsigned>(summary.validRows));
+}
+
+// Clean recordings are read from the footer table; files without a footer
+// fall back to the Index blocks.
+int index(const char *path) {
+  ergo::ErgFile file;
+  if (!file.open(path)) {
+    fprintf(stderr, "cannot read %s\n", path);
+    return 1;
+  }
+  if (!file.hasFooter()) {
+    fprintf(stderr, "%s: no footer, scanned index blocks\n", path);
+  }
+
+  printf("interval,start_ms,end_ms,csv_offset,erg_offset,rows,valid_pct,hr_min,"
+         "hr_max,hr_mean,spo2_min,spo2_max,spo2_mean,motion_min,motion_max,"
+         "motion_mean,valid_rows\n");
+  for (size_t i = 0; i < file.index().size(); ++i) {
+    char label[24];
+    snprintf(label, sizeof(label), "%zu", i);
+    printSummary(label, file.index()[i]);
+  }
+  if (file.hasFooter()) {
+    printSummary("session", file.footer().session);
+  }
+  return 0;
+}
+
+int journal(const char *path) {
+  std::vector<uint8_t> data;
+  if (!readFile(path, data)) {
+    fprintf(stderr, "cannot read %s\n", path);
+    return 1;
+  }
+
+  printf("slot,commit,file,open,csv_bytes,erg_bytes,rows,timestamp_ms\n");
+  for (size_t slot = 0; (slot + 1U) * ergo::kCommitRecordSize <= data.size(); ++slot) {
+    ergo::CommitRecord record;
+    if (!ergo::parseCommitRecord(data.data() + slot * ergo::kCommitRecordSize,
+                                 ergo::kCommitRecordSize, record)) {
+      printf("%zu,invalid\n", slot);
+      continue;
+    }
+    printf("%zu,%lu,REC%06lu,%u,%lu,%lu,%lu,%lu\n", slot,
+           static_cast<unsigned long>(record.commitSequence),
+           static_cast<unsigned long>(record.fileSequence),
+           (record.flags & ergo::kCommitFlagOpen) != 0U ? 1U : 0U,
+           static_cast<unsigned long>(record.csvBytes),
+           static_cast<unsigned long>(record.ergBytes),
+           static_cast<unsigned long>(record.rows),
+           static_cast<unsigned long>(record.timestampMs));
+  }
+  return 0;
+}
+
+// Vitals rows are written back as the original line bytes.
+int slice(bool raw, double fromS, double toS, const Recordings &recordings) {
+  uint32_t fromMs = 0;
+  uint32_t toMs = 0;
+  windowMs(recordings, fromS, toS, fromMs, toMs);
+  if (raw) {
+    printf("timestamp_ms,ir,red,acc_x_mg,acc_y_mg,acc_z_mg\n");
+  } else if (recordings.front()->hasCsv()) {
+    const std::string_view header = recordings.front()->csv().headerLine();
+    fwrite(header.data(), 1, header.size(), stdout);
+    fputc('\n', stdout);
+  }
+
+  for (const auto &recording : recordings) {
+    if (raw && recording->hasErg()) {
+      ergo::ErgFile::SampleCursor cursor = recording->erg().samples(fromMs, toMs);
+      ergo::RawFrame frame;
+      while (cursor.next(frame)) {
+        printFrame(frame);
+      }
+    } else if (!raw && recording->hasCsv()) {
+      ergo::CsvFile::RowCursor cursor = recording->vitals(fromMs, toMs);
+      ergo::VitalsRow row;
+      while (cursor.next(row)) {
+        fwrite(row.line.data(), 1, row.line.size(), stdout);
+        fputc('\n', stdout);
+      }
+    }
+  }
+  return 0;
+}
+
+struct RunningStats {
+  uint64_t count = 0;
+  double mean = 0.0;
+  double m2 = 0.0;
+  double min = 0.0;
+  double max = 0.0;
+
+  void add(double value) {
+    min = count == 0U || value < min ? value : min;
+    max = count == 0U || value > max ? value : max;
+    ++count;
+    const double delta = value - mean;
+    mean += delta / static_cast<double>(count);
+    m2 += delta * (value - mean);
+  }
+
+  double stddev() const {
+    return count > 1U ? std::sqrt(m2 / static_cast<double>(count - 1U)) : 0.0;
+  }
+
+  void print(const char *name) const {
+    printf("%s,%llu,%.3f,%.3f,%.3f,%.3f\n", name,
+           static_cast<unsigned long long>(count), min, max, mean, stddev());
+  }
+};
+
+int stats(double fromS, double toS, const Recordings &recordings) {
+  uint32_t fromMs = 0;
+  uint32_t toMs = 0;
+  windowMs(recordings, fromS, toS, fromMs, toMs);
+
+  RunningStats hr, spo2, rri, hrv, motion, battery, ir, red, accelZ, intervalMs;
+  uint64_t rows = 0;
+  uint64_t validRows = 0;
+  uint64_t skippedRows = 0;
+  uint64_t gaps = 0;
+  uint32_t firstFrameMs = 0;
+  uint32_t lastFrameMs = 0;
+  bool haveFrame = false;
+  for (const auto &recording : recordings) {
+    if (recording->hasCsv()) {
+      ergo::CsvFile::RowCursor cursor = recording->vitals(fromMs, toMs);
+      ergo::VitalsRow row;
+      while (cursor.next(row)) {
+        ++rows;
+        battery.add(row.batteryPercent);
+        motion.add(row.diagnostics.motionScore);
+        if ((row.status & 0x01U) != 0U) {
+          ++validRows;
+          hr.add(row.hr);
+          spo2.add(row.spo2X100 / 100.0);
+        }
+        if ((row.status & 0x04U) != 0U) {
+          rri.add(row.rri);
+        }
+        if ((row.status & 0x08U) != 0U) {
+          hrv.add(row.hrv);
+        }
+      }
+      skippedRows += cursor.skipped();
+    }
+    if (recording->hasErg()) {
+      ergo::ErgFile::SampleCursor cursor = recording->erg().samples(fromMs, toMs);
+      ergo::RawFrame frame;
+      while (cursor.next(frame)) {
+        if (haveFrame) {
+          const uint32_t delta = frame.timestampMs - lastFrameMs;
+          intervalMs.add(delta);
+          gaps += delta > 100U ? 1U : 0U;
+        } else {
+          firstFrameMs = frame.timestampMs;
+          haveFrame = true;
+        }
+        lastFrameMs = frame.timestampMs;
+        ir.add(frame.ir);
+        red.add(frame.red);
+        accelZ.add(frame.accelZmg);
+      }
+    }
+  }
+
+  printf("metric,count,min,max,mean,stddev\n");
+  hr.print("hr_bpm");
+  spo2.print("spo2_pct");
+  rri.print("rri_ms");
+  hrv.print("hrv_ms");
+  motion.print("motion_score");
+  battery.print("battery_pct");
+  ir.print("raw_ir");
+  red.print("raw_red");
+  accelZ.print("raw_acc_z_mg");
+  intervalMs.print("raw_interval_ms");
+  const double durationS = haveFrame ? (lastFrameMs - firstFrameMs) / 1000.0 : 0.0;
+  printf("# rows=%llu valid=%.1f%% skipped=%llu raw_frames=%llu raw_rate=%.2fHz gaps>100ms=%llu\n",
+         static_cast<unsigned long long>(rows),
+         rows > 0U ? 100.0 * validRows / rows : 0.0,
+         static_cast<unsigned long long>(skippedRows),
+         static_cast<unsigned long long>(ir.count),
+         durationS > 0.0 ? (ir.count - 1U) / durationS : 0.0,
+         static_cast<unsigned long long>(gaps));
+  return 0;
+}
+
+// Buffered writer for one column; columns.txt lists "file dtype count" so the
+// output loads with numpy.fromfile or any columnar importer.
+class Column {
+ public:
+  Column(const std::string &dir, const char *name, const char *dtype)
+      : name_(name), dtype_(dtype) {
+    file_ = fopen((dir + "/" + name + ".bin").c_str(), "wb");
+  }
+  ~Column() {
+    if (file_ != nullptr) {
+      fclose(file_);
+    }
+  }
+
+  template <typename T>
+  void add(T value) {
+    static_assert(sizeof(T) <= 4, "columns are at most 32 bit");
+    if (file_ != nullptr) {
+      fwrite(&value, sizeof(T), 1, file_);
+    }
+    ++count_;
+  }
+
+  bool ok() const { return file_ != nullptr; }
+  void describe(FILE *manifest) const {
+    fprintf(manifest, "%s.bin %s %llu\n", name_, dtype_,
+            static_cast<unsigned long long>(count_));
+  }
+
+ private:
+  const char *name_;
+  const char *dtype_;
+  FILE *file_ = nullptr;
+  uint64_t count_ = 0;
+};
+
+int columns(const char *dir, const Recordings &recordings) {
+  mkdir(dir, 0755);
+  const std::string out(dir);
+  Column millis(out, "vitals_millis", "<u4"), hr(out, "vitals_hr", "<u2"),
+      spo2(out, "vitals_spo2_x100", "<u2"), rri(out, "vitals_rri", "<u2"),
+      hrv(out, "vitals_hrv", "<u2"), status(out, "vitals_status", "u1"),
+      battery(out, "vitals_battery_pct", "u1"),
+      irRaw(out, "diag_ir_raw", "<u4"), redRaw(out, "diag_red_raw", "<u4"),
+      irFiltered(out, "diag_ir_filtered", "<u4"),
+      accelX(out, "diag_acc_x", "<f4"), accelY(out, "diag_acc_y", "<f4"),
+      accelZ(out, "diag_acc_z", "<f4"), motion(out, "diag_motion_score", "<f4"),
+      rawMs(out, "raw_timestamp_ms", "<u4"), rawIr(out, "raw_ir", "<i4"),
+      rawRed(out, "raw_red", "<i4"), rawX(out, "raw_acc_x_mg", "<i4"),
+      rawY(out, "raw_acc_y_mg", "<i4"), rawZ(out, "raw_acc_z_mg", "<i4");
+  Column *all[] = {&millis, &hr,     &spo2,   &rri,   &hrv,   &status, &battery,
+                   &irRaw,  &redRaw, &irFiltered, &accelX, &accelY, &accelZ,
+                   &motion, &rawMs,  &rawIr,  &rawRed, &rawX,  &rawY,   &rawZ};
+  for (const Column *column : all) {
+    if (!column->ok()) {
+      fprintf(stderr, "cannot write columns to %s\n", dir);
+      return 1;
+    }
+  }
+
+  for (const auto &recording : recordings) {
+    if (recording->hasCsv()) {
+      ergo::CsvFile::RowCursor cursor = recording->vitals();
+      ergo::VitalsRow row;
+      while (cursor.next(row)) {
+        millis.add(row.millis);
+        hr.add(row.hr);
+        spo2.add(row.spo2X100);
+        rri.add(row.rri);
+        hrv.add(row.hrv);
+        status.add(row.status);
+        battery.add(row.batteryPercent);
+        irRaw.add(row.diagnostics.irRaw);
+        redRaw.add(row.diagnostics.redRaw);
+        irFiltered.add(row.diagnostics.irFiltered);
+        accelX.add(row.diagnostics.accelX);
+        accelY.add(row.diagnostics.accelY);
+        accelZ.add(row.diagnostics.accelZ);
+        motion.add(row.diagnostics.motionScore);
+      }
+    }
+    if (recording->hasErg()) {
+      ergo::ErgFile::SampleCursor cursor = recording->erg().samples();
+      ergo::RawFrame frame;
+      while (cursor.next(frame)) {
+        rawMs.add(frame.timestampMs);
+        rawIr.add(frame.ir);
+        rawRed.add(frame.red);
+        rawX.add(frame.accelXmg);
+        rawY.add(frame.accelYmg);
+        rawZ.add(frame.accelZmg);
+      }
+    }
+  }
+
+  FILE *manifest = fopen((out + "/columns.txt").c_str(), "w");
+  if (manifest == nullptr) {
+    return 1;
+  }
+  for (const Column *column : all) {
+    column->describe(manifest);
+  }
+  fclose(manifest);
+  return 0;
+}
+
+int bench(uint32_t blocks) {
+  const ergo::CodecBenchmarkResult result =
+      ergo::runCodecBenchmark(blocks, 100, hostMicros);
+  printf("codec: blocks=%u frames=%u raw=%uB encoded=%uB ratio=%.2f\n",
+         result.blocks, result.frames, result.rawBytes, result.encodedBytes,
+         static_cast<double>(result.ratio()));
+  printf("codec: encode=%.1fMB/s decode=%.1fMB/s worst_block=%uus round_trip=%s\n",
+         static_cast<double>(result.encodeMbPerSecond()),
+         static_cast<double>(result.decodeMbPerSecond()),
+         result.worstBlockEncodeUs, result.roundTripOk ? "ok" : "FAILED");
+  return result.roundTripOk ? 0 : 1;
+}
+
+void writeBlock(FILE *file, ergo::BlockType type, uint32_t timestampMs,
+                const uint8_t *payload, size_t size, uint8_t channels = 0,
+                uint16_t samples = 0) {
+  ergo::BlockHeader header;
+  header.type = type;
+  header.channels = channels;
+  header.sampleCount = samples;
+  header.firstSampleMs = timestampMs;
+  header.payloadBytes = static_cast<uint32_t>(size);
+  header.crc = ergo::blockCrc(header, payload, size);
+  uint8_t encoded[ergo::kBlockHeaderSize];
+  ergo::serializeBlockHeader(header, encoded);
+  fwrite(encoded, 1, sizeof(encoded), file);
+  fwrite(payload, 1, size, file);
+}
+
+// Writes a recording pair shaped like the firmware's output: 25 Hz raw blocks
+// of 100 frames, 1 Hz CSV rows, minute Index blocks, table and footer.
+bool writeSyntheticRecording(const std::string &base, size_t targetErgBytes) {
+  FILE *erg = fopen((base + ".erg").c_str(), "wb");
+  FILE *csv = fopen((base + ".csv").c_str(), "wb");
+  if (erg == nullptr || csv == nullptr) {
+    return false;
+  }
+
+  ergo::FileHeader fileHeader;
+  fileHeader.startMs = 1000;
+  uint8_t encodedHeader[ergo::kFileHeaderSize];
+  ergo::serializeFileHeader(fileHeader, encodedHeader);
+  fwrite(encodedHeader, 1, sizeof(encodedHeader), erg);
+  fprintf(csv,
+          "millis,date,time,filter_mode,hr,spo2_x100,rri,hrv,status,battery_pct,"
+          "ble_connected,ir_raw,red_raw,ir_filtered,acc_x,acc_y,acc_z,acc_mag,"
+          "motion_score,motion_state,imu_ready,finger_present,peak_detected,rri_accepted\n");
+
+  constexpr uint16_t kFrames = 100;
+  int32_t frames[kFrames * ergo::kRawChannelCount];
+  uint8_t payload[ergo::maxEncodedBlockSize(ergo::kRawChannelCount, kFrames)];
+  std::vector<ergo::IntervalSummary> index;
+  ergo::SummaryAccumulator minute;
+  ergo::SummaryAccumulator session;
+  minute.reset(fileHeader.startMs, static_cast<uint32_t>(ftell(csv)), ergo::kFileHeaderSize);
+  session.reset(fileHeader.startMs, static_cast<uint32_t>(ftell(csv)), ergo::kFileHeaderSize);
+  uint32_t rng = 0x2545F491U;
+  uint32_t timestampMs = fileHeader.startMs;
+  uint64_t frame = 0;
+  while (static_cast<size_t>(ftell(erg)) < targetErgBytes) {
+    for (uint16_t i = 0; i < kFrames; ++i, ++frame) {
+      rng = rng * 1664525U + 1013904223U;
+      const double t = frame / 25.0;
+      const double pulse = std::sin(6.2831853 * 1.2 * t);
+      int32_t *out = &frames[i * ergo::kRawChannelCount];
+      timestampMs += 40U;
+      out[ergo::kRawChannelTimestampMs] = static_cast<int32_t>(timestampMs);
+      out[ergo::kRawChannelIr] = 118000 + static_cast<int32_t>(1400.0 * pulse) +
+                                 static_cast<int32_t>((rng >> 8U) % 49U) - 24;
+      out[ergo::kRawChannelRed] = 96000 + static_cast<int32_t>(900.0 * pulse) +
+                                  static_cast<int32_t>((rng >> 16U) % 49U) - 24;
+      out[ergo::kRawChannelAccelXmg] = static_cast<int32_t>((rng >> 4U) % 13U) - 6;
+      out[ergo::kRawChannelAccelYmg] = static_cast<int32_t>((rng >> 12U) % 13U) - 6;
+      out[ergo::kRawChannelAccelZmg] = 1000 + static_cast<int32_t>((rng >> 20U) % 13U) - 6;
+
+      if (frame % 25U == 0U) {
+        const uint32_t nowMs = timestampMs;
+        if (nowMs - minute.summary().startMs >= 60000U) {
+          uint8_t entry[ergo::kIntervalSummarySize];
+          ergo::serializeIntervalSummary(minute.summary(), entry);
+          writeBlock(erg, ergo::BlockType::Index, minute.summary().startMs, entry,
+                     sizeof(entry));
+          index.push_back(minute.summary());
+          minute.reset(nowMs, static_cast<uint32_t>(ftell(csv)),
+                       static_cast<uint32_t>(ftell(erg)));
+        }
+        const uint16_t hr = static_cast<uint16_t>(70U + (rng >> 24U) % 10U);
+        fprintf(csv,
+                "%lu,2026-05-30,14:05:00,M2,%u,9750,857,42,0x0F,88,1,118000,96000,1400,"
+                "0.0123,-0.0045,0.9981,0.9982,0.01234,stable,1,1,0,1\n",
+                static_cast<unsigned long>(nowMs), hr);
+        minute.add(nowMs, true, hr, 9750, 12);
+        session.add(nowMs, true, hr, 9750, 12);
+      }
+    }
+    const size_t size = ergo::encodeSampleBlock(frames, ergo::kRawChannelCount, kFrames,
+                                                payload, sizeof(payload));
+    writeBlock(erg, ergo::BlockType::RawSamples,
+               static_cast<uint32_t>(frames[ergo::kRawChannelTimestampMs]), payload,
+               size, ergo::kRawChannelCount, kFrames);
+  }
+
+  ergo::FooterInfo footer;
+  footer.session = session.summary();
+  footer.indexTableOffset = static_cast<uint32_t>(ftell(erg));
+  footer.indexEntryCount = static_cast<uint32_t>(index.size());
+  std::vector<uint8_t> table(index.size() * ergo::kIntervalSummarySize);
+  for (size_t i = 0; i < index.size(); ++i) {
+    ergo::serializeIntervalSummary(index[i], table.data() + i * ergo::kIntervalSummarySize);
+  }
+  writeBlock(erg, ergo::BlockType::IndexTable, footer.session.startMs, table.data(),
+             table.size());
+  uint8_t encodedFooter[ergo::kFooterPayloadSize];
+  ergo::serializeFooter(footer, encodedFooter);
+  writeBlock(erg, ergo::BlockType::Footer, timestampMs, encodedFooter,
+             sizeof(encodedFooter));
+  fclose(erg);
+  fclose(csv);
+  return true;
+}
+
+double plainReadMbPerSecond(const std::string &path) {
+  FILE *file = fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    return 0.0;
+  }
+  static uint8_t chunk[1 << 20];
+  uint64_t total = 0;
+  const double start = hostSeconds();
+  size_t count = 0;
+  while ((count = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    total += count;
+  }
+  const double elapsed = hostSeconds() - start;
+  fclose(file);
+  return elapsed > 0.0 ? total / elapsed / 1e6 : 0.0;
+}
+
+// Page-cache-warm numbers: the second pass measures the reader, not the disk.
+int readerBench(size_t megabytes, const char *dir) {
+  const std::string base = std::string(dir) + "/REC999999_bench";
+  printf("reader: writing %zu MB synthetic recording to %s.*\n", megabytes, base.c_str());
+  if (!writeSyntheticRecording(base, megabytes * 1024U * 1024U)) {
+    fprintf(stderr, "cannot write %s\n", base.c_str());
+    return 1;
+  }
+
+  ergo::Recording recording;
+  if (!recording.open(base)) {
+    return 1;
+  }
+  const double ergMb = recording.erg().size() / 1e6;
+  const double csvMb = recording.csv().size() / 1e6;
+  printf("reader: erg=%.1fMB csv=%.1fMB index=%zu entries\n", ergMb, csvMb,
+         recording.erg().index().size());
+  printf("reader: fread erg=%.0fMB/s csv=%.0fMB/s\n",
+         plainReadMbPerSecond(base + ".erg"), plainReadMbPerSecond(base + ".csv"));
+
+  for (bool verify : {true, false}) {
+    double start = hostSeconds();
+    ergo::ErgFile::BlockCursor blocks = recording.erg().blocks(ergo::kFileHeaderSize, verify);
+    ergo::BlockView block;
+    uint64_t blockCount = 0;
+    while (blocks.next(block)) {
+      ++blockCount;
+    }
+    const double scanS = hostSeconds() - start;
+
+    start = hostSeconds();
+    ergo::ErgFile::SampleCursor samples =
+        recording.erg().samples(0, UINT32_MAX, verify);
+    ergo::RawFrame frame;
+    uint64_t frames = 0;
+    int64_t checksum = 0;
+    while (samples.next(frame)) {
+      ++frames;
+      checksum += frame.ir;
+    }
+    const double decodeS = hostSeconds() - start;
+    printf("reader: crc=%s blocks=%llu scan=%.0fMB/s samples=%llu decode=%.0fMB/s "
+           "(%.1fM frames/s)%s\n",
+           verify ? "on" : "off", static_cast<unsigned long long>(blockCount),
+           ergMb / scanS, static_cast<unsigned long long>(frames), ergMb / decodeS,
+           frames / decodeS / 1e6, checksum == 0 || samples.corrupt() ? " FAILED" : "");
+  }
+
+  const double start = hostSeconds();
+  ergo::CsvFile::RowCursor rows = recording.vitals();
+  ergo::VitalsRow row;
+  uint64_t rowCount = 0;
+  while (rows.next(row)) {
+    ++rowCount;
+  }
+  const double csvS = hostSeconds() - start;
+  printf("reader: csv rows=%llu parse=%.0fMB/s (%.1fM rows/s) skipped=%zu\n",
+         static_cast<unsigned long long>(rowCount), csvMb / csvS, rowCount / csvS / 1e6,
+         rows.skipped());
+
+  remove((base + ".erg").c_str());
+  remove((base + ".csv").c_str());
+  return 0;
+}
+
+int payloadDecode(const char *hex) {
+  std::vector<uint8_t> bytes;
+  for (const char *p = hex; p[0] != '\0' && p[1] != '\0'; p += 2) {
+    char pair[3] = {p[0], p[1], '\0'};
+    char *end = nullptr;
+    bytes.push_back(static_cast<uint8_t>(strtoul(pair, &end, 16)));
+    if (*end != '\0') {
+      fprintf(stderr, "not hex: %s\n", hex);
+      return 1;
+    }
+  }
+  ergo::VitalsPayloadHeader header;
+  ergo::VitalsReading readings[ergo::kVitalsPayloadV2MaxReadings];
+  if (!ergo::decodeVitalsPayloadV2(bytes.data(), bytes.size(), header, readings,
+                                   ergo::kVitalsPayloadV2MaxReadings)) {
+    fprintf(stderr, "not a valid v2 payload (%zu bytes)\n", bytes.size());
+    return 1;
+  }
+  printf("sequence,hr,spo2_x100,rri,hrv,status\n");
+  for (size_t i = 0; i < header.count; ++i) {
+    printf("%lu,%u,%u,%u,%u,0x%02X\n",
+           static_cast<unsigned long>(header.firstSequence + i), readings[i].hr,
+           readings[i].spo2X100, readings[i].rri, readings[i].hrv, readings[i].status);
+  }
+  return 0;
+}
+
+bool sameReading(const ergo::VitalsReading &a, const ergo::VitalsReading &b) {
+  return a.hr == b.hr && a.spo2X100 == b.spo2X100 && a.rri == b.rri && a.hrv == b.hrv &&
+         a.status == b.status;
+}
+
+// Random reading streams (stable runs, drift, jumps, extremes) must survive
+// encode/decode at any MTU, and corrupted notifications must either be
+// rejected or decode to something that re-encodes to the same readings.
+int payloadFuzz(uint32_t iterations, uint32_t seed) {
+  uint32_t rng = seed != 0U ? seed : 1U;
+  auto next = [&rng]() {
+    rng ^= rng << 13U;
+    rng ^= rng >> 17U;
+    rng ^= rng << 5U;
+    return rng;
+  };
+  auto evolve = [&next](uint16_t value) -> uint16_t {
+    switch (next() % 8U) {
+      case 0:
+        return static_cast<uint16_t>(next());
+      case 1:
+        return (next() & 1U) != 0U ? 0U : 0xFFFFU;
+      case 2:
+      case 3:
+        return static_cast<uint16_t>(value + static_cast<int32_t>(next() % 7U) - 3);
+      default:
+        return value;
+    }
+  };
+
+  uint64_t readingsChecked = 0;
+  uint64_t payloadBytes = 0;
+  uint64_t payloads = 0;
+  uint64_t mutantsAccepted = 0;
+  std::vector<ergo::VitalsReading> stream;
+  ergo::VitalsReading decoded[ergo::kVitalsPayloadV2MaxReadings];
+  uint8_t payload[512];
+  for (uint32_t iteration = 0; iteration < iterations; ++iteration) {
+    stream.resize(1U + next() % 300U);
+    ergo::VitalsReading current;
+    for (ergo::VitalsReading &reading : stream) {
+      current.hr = evolve(current.hr);
+      current.spo2X100 = evolve(current.spo2X100);
+      current.rri = evolve(current.rri);
+      current.hrv = evolve(current.hrv);
+      if (next() % 16U == 0U) {
+        current.status = static_cast<uint8_t>(next());
+      }
+      reading = current;
+    }
+    const size_t capacity = ergo::kVitalsPayloadV2HeaderSize +
+                            ergo::kVitalsPayloadV2KeyframeSize + next() % 480U;
+
+    size_t offset = 0;
+    while (offset < stream.size()) {
+      ergo::VitalsPayloadHeader header;
+      header.sequence = static_cast<uint8_t>(payloads);
+      header.firstSequence = next();
+      size_t encoded = 0;
+      const size_t size = ergo::encodeVitalsPayloadV2(
+          header, stream.data() + offset, stream.size() - offset, payload, capacity, encoded);
+      ergo::VitalsPayloadHeader parsed;
+      if (size == 0U || size > capacity || encoded == 0U ||
+          !ergo::decodeVitalsPayloadV2(payload, size, parsed, decoded,
+                                       ergo::kVitalsPayloadV2MaxReadings) ||
+          parsed.count != encoded || parsed.firstSequence != header.firstSequence ||
+          parsed.sequence != header.sequence) {
+        fprintf(stderr, "payload-fuzz: round trip failed at iteration %u (seed %u)\n",
+                iteration, seed);
+        return 1;
+      }
+      for (size_t i = 0; i < encoded; ++i) {
+        if (!sameReading(decoded[i], stream[offset + i])) {
+          fprintf(stderr, "payload-fuzz: reading mismatch at iteration %u (seed %u)\n",
+                  iteration, seed);
+          return 1;
+        }
+      }
+
+      // Flip, truncate or extend the notification.
+      uint8_t mutant[sizeof(payload) + 1];
+      memcpy(mutant, payload, size);
+      size_t mutantSize = size;
+      switch (next() % 3U) {
+        case 0:
+          mutant[next() % size] ^= static_cast<uint8_t>(1U << (next() % 8U));
+          break;
+        case 1:
+          mutantSize = next() % size;
+          break;
+        default:
+          mutant[mutantSize++] = static_cast<uint8_t>(next());
+          break;
+      }
+      if (ergo::decodeVitalsPayloadV2(mutant, mutantSize, parsed, decoded,
+                                      ergo::kVitalsPayloadV2MaxReadings)) {
+        ++mutantsAccepted;
+        uint8_t again[sizeof(payload)];
+        size_t reencoded = 0;
+        ergo::VitalsReading check[ergo::kVitalsPayloadV2MaxReadings];
+        ergo::VitalsPayloadHeader checkHeader;
+        const size_t againSize = ergo::encodeVitalsPayloadV2(
+            parsed, decoded, parsed.count, again, sizeof(again), reencoded);
+        if (againSize == 0U || reencoded != parsed.count ||
+            !ergo::decodeVitalsPayloadV2(again, againSize, checkHeader, check,
+                                         ergo::kVitalsPayloadV2MaxReadings)) {
+          fprintf(stderr, "payload-fuzz: accepted mutant does not re-encode (seed %u)\n",
+                  seed);
+          return 1;
+        }
+        for (size_t i = 0; i < parsed.count; ++i) {
+          if (!sameReading(check[i], decoded[i])) {
+            fprintf(stderr, "payload-fuzz: mutant re-encode mismatch (seed %u)\n", seed);
+            return 1;
+          }
+        }
+      }
+
+      offset += encoded;
+      readingsChecked += encoded;
+      payloadBytes += size;
+      ++payloads;
+    }
+  }
+  printf("payload-fuzz: %u streams, %llu readings in %llu payloads, %.2f bytes/reading "
+         "(v1: %zu), %llu corrupted payloads still decodable, ok\n",
+         iterations, static_cast<unsigned long long>(readingsChecked),
+         static_cast<unsigned long long>(payloads),
+         readingsChecked > 0U ? static_cast<double>(payloadBytes) / readingsChecked : 0.0,
+         ergo::kVitalsPayloadV1Size, static_cast<unsigned long long>(mutantsAccepted));
+  return 0;
+}
+
+// Downloads `path` the way a central would, against the firmware's file
+// pump (20 ms period, 12 chunks per pump, 1 s ack timeout) over LoopbackLink
+// on LE 2M with data length extension. The central acks once per event and
+// on a CRC failure, a gap or 2 s of silence (a lost Done) sends Read again
+// from its offset.
+// `corruptPct` flips one bit in that share of notifications.
+int fileSim(const char *path, uint32_t intervalMs, uint32_t window, double corruptPct,
+            uint32_t mtu) {
+  constexpr uint64_t kPumpPeriodUs = 20000;
+  constexpr uint32_t kFramesPerPump = 12;
+  constexpr uint32_t kAckTimeoutMs = 1000;
+  constexpr uint64_t kSilenceUs = 2000000;
+  constexpr uint64_t kGiveUpUs = 3600ULL * 1000000ULL;
+
+  std::vector<uint8_t> file;
+  if (!readFile(path, file) || file.empty() || intervalMs == 0U || window == 0U ||
+      window > 255U) {
+    fprintf(stderr, "file-sim: cannot read %s or bad parameters\n", path);
+    return 1;
+  }
+  mtu = std::min<uint32_t>(mtu, 247U);
+  const size_t chunkSize = ergo::fileChunkSize(static_cast<uint16_t>(mtu));
+  if (chunkSize == 0U) {
+    fprintf(stderr, "file-sim: MTU %u leaves no room for data\n", mtu);
+    return 1;
+  }
+  const uint32_t size = static_cast<uint32_t>(file.size());
+
+  ergo::LoopbackConfig config;
+  config.intervalUs = intervalMs * 1000U;
+  config.mtu = static_cast<uint16_t>(mtu);
+  config.corruptPct = corruptPct;
+  ergo::LoopbackLink link(config);
+  link.subscribe(ergo::BleChannel::File, true);
+
+  // Device: the firmware's mailbox and pump, minus the SD card.
+  struct Mailbox {
+    bool read = false;
+    bool ack = false;
+    ergo::FileCommand readCommand;
+    uint32_t ackOffset = 0;
+  } mailbox;
+  ergo::FileSender sender;
+  bool deviceOpen = false;
+  uint64_t goBacks = 0;
+  link.setWriteHandler([&mailbox](ergo::BleChannel, const uint8_t *data, size_t length) {
+    ergo::FileCommand command;
+    if (!ergo::parseFileCommand(data, length, command)) {
+      return;
+    }
+    if (command.opcode == ergo::FileOpcode::Read) {
+      mailbox.readCommand = command;
+      mailbox.read = true;
+      mailbox.ack = false;
+    } else if (command.opcode == ergo::FileOpcode::Ack) {
+      mailbox.ackOffset = command.offset;
+      mailbox.ack = true;
+    }
+  });
+
+  // Central.
+  std::vector<uint8_t> received;
+  uint32_t expected = 0;
+  bool resumePending = false;
+  bool done = false;
+  uint64_t crcFailures = 0;
+  uint64_t rereads = 0;
+  uint32_t ackedSent = 0;
+  uint64_t lastFrameUs = 0;
+  auto queueCommand = [&link](const ergo::FileCommand &command) {
+    uint8_t bytes[ergo::kFileCommandMaxSize];
+    const size_t length = ergo::serializeFileCommand(command, bytes);
+    link.write(ergo::BleChannel::File, bytes, length);
+  };
+  auto queueRead = [&](uint32_t offset) {
+    ergo::FileCommand read;
+    read.opcode = ergo::FileOpcode::Read;
+    read.offset = offset;
+    read.window = static_cast<uint8_t>(window);
+    queueCommand(read);
+  };
+  link.setReceiver([&](ergo::BleChannel, const uint8_t *frame, size_t length, uint64_t,
+                       uint64_t deliveredUs) {
+    lastFrameUs = deliveredUs;
+    if (frame[0] == static_cast<uint8_t>(ergo::FileFrameType::Done) &&
+        length == ergo::kFileDoneSize) {
+      done = ergo::readLe32(frame + 2) == expected && expected == size;
+      return;
+    }
+    uint32_t offset = 0;
+    const uint8_t *bytes = nullptr;
+    size_t count = 0;
+    const bool valid = ergo::parseFileData(frame, length, offset, bytes, count);
+    if (!valid && frame[0] == static_cast<uint8_t>(ergo::FileFrameType::Data)) {
+      ++crcFailures;
+    }
+    if (valid && offset == expected) {
+      received.insert(received.end(), bytes, bytes + count);
+      expected += static_cast<uint32_t>(count);
+      resumePending = false;
+    } else if ((!valid || offset > expected) && !resumePending) {
+      queueRead(expected);
+      resumePending = true;
+      ++rereads;
+    }
+  });
+  queueRead(0);
+
+  uint64_t nowUs = 0;
+  uint64_t nextPumpUs = 0;
+  while (!done && nowUs < kGiveUpUs) {
+    if (nextPumpUs <= link.nextEventUs()) {
+      nowUs = nextPumpUs;
+      nextPumpUs += kPumpPeriodUs;
+      link.setNow(nowUs);
+      const uint32_t nowMs = static_cast<uint32_t>(nowUs / 1000U);
+      if (mailbox.read) {
+        deviceOpen = true;
+        sender.start(mailbox.readCommand.offset, mailbox.readCommand.window, nowMs);
+      }
+      if (mailbox.ack && deviceOpen) {
+        sender.ack(mailbox.ackOffset, nowMs);
+      }
+      mailbox.read = false;
+      mailbox.ack = false;
+      if (!deviceOpen) {
+        continue;
+      }
+      goBacks += sender.checkTimeout(nowMs, kAckTimeoutMs) ? 1U : 0U;
+      for (uint32_t frame = 0; frame < kFramesPerPump; ++frame) {
+        uint32_t offset = 0;
+        size_t count = 0;
+        if (!sender.nextChunk(size, chunkSize, offset, count)) {
+          break;
+        }
+        uint8_t data[ergo::kFileDataHeaderSize + ergo::fileChunkSize(247)];
+        const size_t length = ergo::serializeFileData(offset, file.data() + offset, count, data);
+        if (!link.notify(ergo::BleChannel::File, data, length)) {
+          break;
+        }
+        sender.sent(count);
+      }
+      if (sender.complete(size)) {
+        uint8_t doneFrame[ergo::kFileDoneSize] = {
+            static_cast<uint8_t>(ergo::FileFrameType::Done)};
+        ergo::writeLe32(doneFrame + 2, size);
+        deviceOpen = !link.notify(ergo::BleChannel::File, doneFrame, sizeof(doneFrame));
+      }
+      continue;
+    }
+
+    nowUs = link.nextEventUs();
+    link.runEvent();
+    if (!done && nowUs >= lastFrameUs + kSilenceUs) {
+      queueRead(expected);
+      lastFrameUs = nowUs;
+      ++rereads;
+    }
+    if (expected != ackedSent) {
+      ergo::FileCommand ack;
+      ack.opcode = ergo::FileOpcode::Ack;
+      ack.offset = expected;
+      queueCommand(ack);
+      ackedSent = expected;
+    }
+  }
+
+  const double seconds = static_cast<double>(nowUs) / 1e6;
+  const bool same = done && received == file;
+  const ergo::LoopbackStats &stats = link.stats();
+  printf("file-sim: %lu bytes in %.2f s = %.1f KB/s (mtu %u, %u ms interval, %llu "
+         "packets/event, window %u)\n",
+         static_cast<unsigned long>(received.size()), seconds,
+         seconds > 0.0 ? static_cast<double>(received.size()) / 1024.0 / seconds : 0.0, mtu,
+         intervalMs,
+         static_cast<unsigned long long>(config.intervalUs / link.airtimeUs(mtu - 3U)),
+         window);
+  printf("file-sim: %llu notifications, %llu corrupted, %llu CRC failures, %llu re-reads, "
+         "%llu go-backs, %s\n",
+         static_cast<unsigned long long>(stats.notifications),
+         static_cast<unsigned long long>(stats.corrupted),
+         static_cast<unsigned long long>(crcFailures),
+         static_cast<unsigned long long>(rereads), static_cast<unsigned long long>(goBacks),
+         same ? "content ok" : "CONTENT MISMATCH");
+  return same ? 0 : 1;
+}
+
+// Runs the band's live data paths against SimCentral over LoopbackLink for
+// `seconds`, with the firmware's periods: 100 Hz raw samples streamed the
+// way pumpStream() does (20 ms pump, full frames, a partial frame once its
+// oldest sample is 100 ms old), a Heart Rate Measurement with every RR
+// interval at each beat, and 1 Hz vitals readings. Like the firmware, the
+// device starts on v1, one reading per notification; after a few readings
+// the central writes 2 to the version characteristic and from then on
+// readings go through VitalsBatcher once `batch` of them are queued. Fails
+// when the write does not switch the format.
+int centralSim(double seconds, uint32_t intervalMs, uint32_t mtu, uint32_t batch,
+               uint32_t phy, uint32_t dataLength) {
+  constexpr uint64_t kSensorPeriodUs = 10000;
+  constexpr uint64_t kStreamPumpUs = 20000;
+  constexpr uint32_t kStreamMaxLatencyMs = 100;
+  constexpr uint64_t kReadingPeriodUs = 1000000;
+  constexpr uint16_t kFirmwareMtu = 247;
+  constexpr uint32_t kOptInReading = 3;
+
+  if (seconds <= 0.0 || intervalMs == 0U || batch == 0U ||
+      batch > ergo::kVitalsPayloadV2MaxReadings || mtu < ergo::kDefaultAttMtu ||
+      dataLength < 27U) {
+    fprintf(stderr, "central-sim: bad parameters\n");
+    return 2;
+  }
+  mtu = std::min<uint32_t>(mtu, kFirmwareMtu);
+
+  ergo::LoopbackConfig config;
+  config.intervalUs = intervalMs * 1000U;
+  config.mtu = static_cast<uint16_t>(mtu);
+  config.phy = static_cast<uint8_t>(phy >= 2U ? 2U : 1U);
+  config.dataLength = static_cast<uint16_t>(std::min<uint32_t>(dataLength, 251U));
+  ergo::LoopbackLink link(config);
+  ergo::SimCentral central(kReadingPeriodUs, kReadingPeriodUs);
+  link.setReceiver([&central](ergo::BleChannel channel, const uint8_t *data, size_t size,
+                              uint64_t queuedUs, uint64_t deliveredUs) {
+    central.receive(channel, data, size, queuedUs, deliveredUs);
+  });
+  link.subscribe(ergo::BleChannel::Vitals, true);
+  link.subscribe(ergo::BleChannel::HeartRate, true);
+  link.subscribe(ergo::BleChannel::Stream, true);
+
+  uint32_t rng = 0x9E3779B9U;
+  auto next = [&rng]() {
+    rng ^= rng << 13U;
+    rng ^= rng >> 17U;
+    rng ^= rng << 5U;
+    return rng;
+  };
+
+  // Sensor.
+  struct Sample {
+    uint32_t index = 0;
+    ergo::StreamSample sample;
+  };
+  std::deque<Sample> pending;
+  uint32_t sampleIndex = 0;
+  uint64_t samplesProduced = 0;
+  std::vector<uint16_t> beats;
+  uint64_t beatsProduced = 0;
+  uint64_t beatsDropped = 0;
+  uint64_t nextBeatUs = 800000;
+  ergo::RrIntervalConverter converter;
+
+  // Stream, as pumpStream() and sendStreamFrame().
+  const size_t perFrame = std::min(ergo::streamSamplesPerFrame(config.mtu),
+                                   ergo::streamSamplesPerFrame(kFirmwareMtu));
+  uint16_t streamSequence = 0;
+  auto sendStreamFrame = [&](size_t count) {
+    uint8_t frame[ergo::streamFrameSize(ergo::streamSamplesPerFrame(kFirmwareMtu))];
+    ergo::StreamFrameHeader header;
+    header.sequence = streamSequence++;
+    header.firstSampleIndex = pending.front().index;
+    header.firstSampleMs = pending.front().sample.timestampMs;
+    ergo::serializeStreamHeader(header, frame);
+    uint32_t previousMs = header.firstSampleMs;
+    for (size_t i = 0; i < count; ++i) {
+      ergo::serializeStreamSample(pending.front().sample, previousMs,
+                                  frame + ergo::streamFrameSize(i));
+      previousMs = pending.front().sample.timestampMs;
+      pending.pop_front();
+    }
+    link.notify(ergo::BleChannel::Stream, frame, ergo::streamFrameSize(count));
+  };
+
+  // Vitals.
+  std::vector<ergo::VitalsReading> storage(batch);
+  ergo::VitalsBatcher batcher(storage.data(), storage.size());
+  ergo::VitalsReading reading;
+  reading.hr = 72;
+  reading.spo2X100 = 9800;
+  reading.rri = 833;
+  reading.hrv = 45;
+  uint32_t readingSequence = 0;
+  uint8_t notificationSequence = 0;
+  // As takeVersionWrite() and publishLatest(): a valid write switches the
+  // format and drops readings batched under the old one.
+  uint8_t payloadVersion = ergo::kVitalsPayloadV1;
+  link.setWriteHandler([&](ergo::BleChannel channel, const uint8_t *data, size_t size) {
+    uint8_t version = 0;
+    if (channel == ergo::BleChannel::Version &&
+        ergo::parseVitalsVersionWrite(data, size, version) && version != payloadVersion) {
+      batcher.clear();
+      payloadVersion = version;
+    }
+  });
+  auto walk = [&next](uint16_t value, uint16_t low, uint16_t high, uint16_t step) {
+    const int32_t moved = static_cast<int32_t>(value) +
+                          static_cast<int32_t>(next() % (2U * step + 1U)) - step;
+    return static_cast<uint16_t>(std::min<int32_t>(high, std::max<int32_t>(low, moved)));
+  };
+
+  const uint64_t endUs = static_cast<uint64_t>(seconds * 1e6);
+  uint64_t nextSensorUs = 0;
+  uint64_t nextPumpUs = 0;
+  uint64_t nextReadingUs = kReadingPeriodUs;
+  for (;;) {
+    const uint64_t nowUs = std::min({nextSensorUs, nextPumpUs, nextReadingUs, nextBeatUs,
+                                     link.nextEventUs()});
+    if (nowUs >= endUs) {
+      break;
+    }
+    link.setNow(nowUs);
+    const uint32_t nowMs = static_cast<uint32_t>(nowUs / 1000U);
+    if (nowUs == link.nextEventUs()) {
+      link.runEvent();
+    } else if (nowUs == nextSensorUs) {
+      nextSensorUs += kSensorPeriodUs;
+      const double phase = static_cast<double>(nowUs) * 2.0 * M_PI * 1.2 / 1e6;
+      Sample sample;
+      sample.index = sampleIndex++;
+      sample.sample.timestampMs = nowMs;
+      sample.sample.ir = 120000U + static_cast<uint32_t>(3000.0 * sin(phase)) + next() % 64U;
+      sample.sample.red = 90000U + static_cast<uint32_t>(2000.0 * sin(phase)) + next() % 64U;
+      sample.sample.accelXmg = static_cast<int16_t>(next() % 41U) - 20;
+      sample.sample.accelYmg = static_cast<int16_t>(next() % 41U) - 20;
+      sample.sample.accelZmg = static_cast<int16_t>(1000 + static_cast<int>(next() % 41U) - 20);
+      pending.push_back(sample);
+      ++samplesProduced;
+    } else if (nowUs == nextPumpUs) {
+      nextPumpUs += kStreamPumpUs;
+      if (perFrame == 0U) {
+        pending.clear();
+        continue;
+      }
+      while (pending.size() >= perFrame) {
+        sendStreamFrame(perFrame);
+      }
+      if (!pending.empty() &&
+          nowMs - pending.front().sample.timestampMs >= kStreamMaxLatencyMs) {
+        sendStreamFrame(pending.size());
+      }
+    } else if (nowUs == nextBeatUs) {
+      const uint16_t rriMs = static_cast<uint16_t>(780U + next() % 110U);
+      nextBeatUs += rriMs * 1000ULL;
+      beats.push_back(rriMs);
+      ++beatsProduced;
+      std::vector<uint16_t> rr1024;
+      for (const uint16_t rri : beats) {
+        rr1024.push_back(converter.convert(rri));
+      }
+      ergo::HeartRateMeasurement measurement;
+      measurement.bpm = reading.hr;
+      measurement.contactSupported = true;
+      measurement.contactDetected = true;
+      uint8_t frame[kFirmwareMtu];
+      size_t sent = 0;
+      while (sent < rr1024.size()) {
+        const size_t count = std::min(ergo::heartRateRrCapacity(measurement, config.mtu),
+                                      rr1024.size() - sent);
+        const size_t size =
+            ergo::serializeHeartRateMeasurement(measurement, rr1024.data() + sent, count, frame);
+        if (count == 0U || !link.notify(ergo::BleChannel::HeartRate, frame, size)) {
+          beatsDropped += rr1024.size() - sent;
+          break;
+        }
+        sent += count;
+      }
+      beats.clear();
+    } else {
+      nextReadingUs += kReadingPeriodUs;
+      reading.hr = walk(reading.hr, 50, 140, 2);
+      reading.spo2X100 = walk(reading.spo2X100, 9000, 10000, 10);
+      reading.rri = static_cast<uint16_t>(60000U / reading.hr);
+      reading.hrv = walk(reading.hrv, 10, 120, 3);
+      const uint32_t sequence = readingSequence++;
+      if (sequence == kOptInReading) {
+        const uint8_t optIn = ergo::kVitalsPayloadV2;
+        link.write(ergo::BleChannel::Version, &optIn, 1);
+      }
+      if (payloadVersion == ergo::kVitalsPayloadV1) {
+        uint8_t payload[ergo::kVitalsPayloadV1Size];
+        ergo::encodeVitalsPayloadV1(reading, notificationSequence++, payload);
+        link.notify(ergo::BleChannel::Vitals, payload, sizeof(payload));
+        continue;
+      }
+      if (!batcher.add(sequence, reading)) {
+        batcher.clear();
+        batcher.add(sequence, reading);
+      }
+      if (batcher.full()) {
+        uint8_t payload[kFirmwareMtu];
+        ergo::VitalsPayloadHeader header;
+        header.sequence = notificationSequence;
+        size_t size = 0;
+        while ((size = batcher.next(header, payload, config.mtu - ergo::kAttHeaderSize)) > 0U) {
+          link.notify(ergo::BleChannel::Vitals, payload, size);
+          header.sequence = ++notificationSequence;
+        }
+        batcher.clear();
+      }
+    }
+  }
+
+  // Let the link deliver what the stack already holds.
+  while (link.queued() > 0U) {
+    link.runEvent();
+  }
+
+  const ergo::LoopbackStats &stats = link.stats();
+  printf("central-sim: %.1f s, %u ms interval, mtu %u, LE %uM, data length %u, vitals batch "
+         "%u\n",
+         seconds, intervalMs, mtu, config.phy, config.dataLength, batch);
+  printf("  link   %llu events, %llu notifications, %.1f B/s, %llu refused, max queue %zu\n",
+         static_cast<unsigned long long>(stats.events),
+         static_cast<unsigned long long>(stats.notifications),
+         static_cast<double>(stats.bytes) / seconds,
+         static_cast<unsigned long long>(stats.refused), stats.maxQueued);
+  central.print(stdout, seconds);
+  // Readings still batched and samples still pending at the end are not lost.
+  const uint64_t readingsSent = readingSequence - batcher.count();
+  const uint64_t samplesSent = samplesProduced - pending.size();
+  printf("  loss   vitals %llu/%llu readings, hrs %llu/%llu beats (%llu refused), stream "
+         "%u frames and %llu/%llu samples\n",
+         static_cast<unsigned long long>(readingsSent - std::min<uint64_t>(
+                                                            readingsSent, central.readings())),
+         static_cast<unsigned long long>(readingsSent),
+         static_cast<unsigned long long>(beatsProduced - central.rrIntervals()),
+         static_cast<unsigned long long>(beatsProduced),
+         static_cast<unsigned long long>(beatsDropped), central.stream().lostFrames(),
+         static_cast<unsigned long long>(samplesSent - std::min<uint64_t>(
+                                                           samplesSent, central.stream().samples())),
+         static_cast<unsigned long long>(samplesSent));
+  printf("  format vitals v1 %llu, v2 %llu notifications (v2 requested at reading %u)\n",
+         static_cast<unsigned long long>(central.v1Payloads()),
+         static_cast<unsigned long long>(central.v2Payloads()), kOptInReading);
+  const bool optInDue = readingSequence > kOptInReading + batch + 1U;
+  if (central.v1AfterV2() > 0U || (optInDue && central.v2Payloads() == 0U)) {
+    fprintf(stderr, "central-sim: version write did not switch the vitals format\n");
+    return 1;
+  }
+  return 0;
+}
+
+int usage(const char *program) {
+  fprintf(stderr,
+          "usage: %s decode <file.erg> | index <file.erg> | journal <REC.jnl> |\n"
+          "       slice [--raw] <from_s> <to_s> <recording>... |\n"
+          "       stats [<from_s> <to_s>] <recording>... | columns <out_dir> <recording>... |\n"
+          "       bench [blocks] | reader-bench [MB] [dir] |\n"
+          "       payload-decode <hex> | payload-fuzz [iterations] [seed] |\n"
+          "       file-sim <file> [interval_ms] [window] [corrupt_pct] [mtu] |\n"
+          "       central-sim [seconds] [interval_ms] [mtu] [batch] [phy] [data_length] |\n"
+          "       usb-capture <port> <out_base> [seconds] | usb-cmd <port> <line> |\n"
+          "       usb-rtc <port>\n",
+          program);
+  return 2;
+}
+
+bool isNumber(const char *text) {
+  char *end = nullptr;
+  strtod(text, &end);
+  return end != text && *end == '\0';
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    return usage(argv[0]);
+  }
+  const char *command = argv[1];
+  if (argc >= 3 && strcmp(command, "decode") == 0) {
+    return decode(argv[2]);
+  }
+  if (argc >= 3 && strcmp(command, "index") == 0) {
+    return index(argv[2]);
+  }
+  if (argc >= 3 && strcmp(command, "journal") == 0) {
+    return journal(argv[2]);
+  }
+  if (strcmp(command, "slice") == 0) {
+    const bool raw = argc >= 3 && strcmp(argv[2], "--raw") == 0;
+    const int first = raw ? 3 : 2;
+    Recordings recordings;
+    if (argc < first + 3 || !openRecordings(argc - first - 2, argv + first + 2, recordings)) {
+      return usage(argv[0]);
+    }
+    return slice(raw, strtod(argv[first], nullptr), strtod(argv[first + 1], nullptr),
+                 recordings);
+  }
+  if (strcmp(command, "stats") == 0) {
+    const bool window = argc >= 5 && isNumber(argv[2]) && isNumber(argv[3]);
+    const int first = window ? 4 : 2;
+    Recordings recordings;
+    if (!openRecordings(argc - first, argv + first, recordings)) {
+      return usage(argv[0]);
+    }
+    return stats(window ? strtod(argv[2], nullptr) : 0.0,
+                 window ? strtod(argv[3], nullptr) : HUGE_VAL, recordings);
+  }
+  if (argc >= 4 && strcmp(command, "columns") == 0) {
+    Recordings recordings;
+    if (!openRecordings(argc - 3, argv + 3, recordings)) {
+      return 1;
+    }
+    return columns(argv[2], recordings);
+  }
+  if (strcmp(command, "bench") == 0) {
+    return bench(argc >= 3 ? static_cast<uint32_t>(strtoul(argv[2], nullptr, 10)) : 2000U);
+  }
+  if (strcmp(command, "reader-bench") == 0) {
+    return readerBench(argc >= 3 ? strtoul(argv[2], nullptr, 10) : 256U,
+                       argc >= 4 ? argv[3] : "/tmp");
+  }
+  if (argc >= 3 && strcmp(command, "payload-decode") == 0) {
+    return payloadDecode(argv[2]);
+  }
+  if (strcmp(command, "payload-fuzz") == 0) {
+    return payloadFuzz(
+        argc >= 3 ? static_cast<uint32_t>(strtoul(argv[2], nullptr, 10)) : 20000U,
+        argc >= 4 ? static_cast<uint32_t>(strtoul(argv[3], nullptr, 10)) : 0x9E3779B9U);
+  }
+  if (argc >= 3 && strcmp(command, "file-sim") == 0) {
+    return fileSim(argv[2],
+                   argc >= 4 ? static_cast<uint32_t>(strtoul(argv[3], nullptr, 10)) : 15U,
+                   argc >= 5 ? static_cast<uint32_t>(strtoul(argv[4], nullptr, 10)) : 32U,
+                   argc >= 6 ? strtod(argv[5], nullptr) : 0.0,
+                   argc >= 7 ? static_cast<uint32_t>(strtoul(argv[6], nullptr, 10)) : 247U);
+  }
+  if (strcmp(command, "central-sim") == 0) {
+    const auto arg = [argc, argv](int i, uint32_t fallback) {
+      return argc > i ? static_cast<uint32_t>(strtoul(argv[i], nullptr, 10)) : fallback;
+    };
+    return centralSim(argc >= 3 ? strtod(argv[2], nullptr) : 60.0, arg(3, 15U), arg(4, 247U),
+                      arg(5, 5U), arg(6, 2U), arg(7, 251U));
+  }
+  if (argc >= 4 && strcmp(command, "usb-capture") == 0) {
+    return ergo::usbCapture(argv[2], argv[3], argc >= 5 ? strtod(argv[4], nullptr) : 0.0);
+  }
+  if (argc >= 4 && strcmp(command, "usb-cmd") == 0) {
+    return ergo::usbCommand(argv[2], argv[3]);
+  }
+  if (argc >= 3 && strcmp(command, "usb-rtc") == 0) {
+    return ergo::usbSetRtc(argv[2]);
+  }
+  return usage(argv[0]);
+}
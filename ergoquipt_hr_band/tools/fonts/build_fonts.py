@@ -0,0 +1,113 @@
+"""Generates the UI's subset fonts for builds with ERGO_SUBSET_FONTS.
+
+Collects every character that appears in a string literal of the UI sources,
+plus the LV_SYMBOL_* icons they name, and runs lv_font_conv once per size
+over LVGL's own Montserrat and FontAwesome files. The result is one
+compressed table per size in src/fonts/. The body sizes also show runtime
+text (device name, file names, recorder status) and keep all of printable
+ASCII; the large value sizes only get the characters found in the sources.
+
+Runs before the esp32-s3-subset-fonts build (extra_scripts in
+platformio.ini) and does nothing while the character set and sizes are
+unchanged. Needs lv_font_conv on the PATH (npm i -g lv_font_conv).
+"""
+
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+SOURCES = ["src/ui_manager.cpp", "src/waveform_view.cpp"]
+# Size -> whether it keeps all of printable ASCII.
+SIZES = {16: True, 20: True, 28: False, 48: False}
+BPP = 4
+OUTPUT_DIR = "src/fonts"
+STAMP = "charset.txt"
+
+# Printed through format strings rather than literals.
+ALWAYS = "0123456789 .,:;-+/%()"
+ASCII = "".join(chr(c) for c in range(0x20, 0x7F))
+
+STRING_RE = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+SYMBOL_RE = re.compile(r"\bLV_SYMBOL_([A-Z0-9_]+)\b")
+SYMBOL_DEF_RE = re.compile(
+    r"#define\s+LV_SYMBOL_([A-Z0-9_]+)\s+\"[^\"]*\"\s*/\*\s*\d+,\s*0x([0-9A-Fa-f]+)")
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def collect(project_dir):
+    chars = set(ALWAYS)
+    symbols = set()
+    for source in SOURCES:
+        with open(os.path.join(project_dir, source), encoding="utf-8") as f:
+            text = strip_comments(f.read())
+        for literal in STRING_RE.findall(text):
+            # Escapes only ever stand for whitespace in the UI strings.
+            literal = re.sub(r"\\.", " ", literal)
+            chars.update(c for c in literal if " " <= c <= "~")
+        symbols.update(SYMBOL_RE.findall(text))
+    return "".join(sorted(chars)), sorted(symbols)
+
+
+def symbol_codepoints(lvgl_dir, names):
+    with open(os.path.join(lvgl_dir, "src", "font", "lv_symbol_def.h"), encoding="utf-8") as f:
+        defined = dict(SYMBOL_DEF_RE.findall(f.read()))
+    missing = [name for name in names if name not in defined]
+    if missing:
+        raise ValueError("unknown LV_SYMBOL_%s" % ", LV_SYMBOL_".join(missing))
+    return sorted("0x" + defined[name].upper() for name in names)
+
+
+def build(project_dir, lvgl_dir):
+    chars, symbols = collect(project_dir)
+    codepoints = symbol_codepoints(lvgl_dir, symbols)
+    stamp_text = "sizes=%s bpp=%d\nchars=%s\nsymbols=%s\n" % (
+        ",".join("%d%s" % (size, "a" if full else "") for size, full in SIZES.items()), BPP,
+        chars, ",".join(codepoints))
+
+    output_dir = os.path.join(project_dir, OUTPUT_DIR)
+    stamp_path = os.path.join(output_dir, STAMP)
+    outputs = [os.path.join(output_dir, "ergo_font_%d.c" % size) for size in SIZES]
+    if os.path.exists(stamp_path) and all(os.path.exists(path) for path in outputs):
+        with open(stamp_path, encoding="utf-8") as f:
+            if f.read() == stamp_text:
+                return True
+
+    converter = shutil.which("lv_font_conv")
+    if converter is None:
+        sys.stderr.write("fonts: lv_font_conv not found; install it with "
+                         "`npm i -g lv_font_conv` or build the esp32-s3 env\n")
+        return False
+
+    fonts_dir = os.path.join(lvgl_dir, "scripts", "built_in_font")
+    os.makedirs(output_dir, exist_ok=True)
+    for (size, full), output in zip(SIZES.items(), outputs):
+        command = [
+            converter, "--bpp", str(BPP), "--size", str(size), "--format", "lvgl",
+            "--lv-include", "lvgl.h", "--lv-font-name", "ergo_font_%d" % size,
+            "--font", os.path.join(fonts_dir, "Montserrat-Medium.ttf"),
+            "--symbols", ASCII if full else chars,
+        ]
+        if codepoints:
+            command += ["--font",
+                        os.path.join(fonts_dir, "FontAwesome5-Solid+Brands+Regular.woff"),
+                        "--range", ",".join(codepoints)]
+        command += ["-o", output]
+        subprocess.check_call(command)
+    with open(stamp_path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(stamp_text)
+    print("fonts: %d glyphs + %d symbols at %s px" % (
+        len(chars), len(codepoints), "/".join(str(size) for size in SIZES)))
+    return True
+
+
+Import("env")  # noqa: F821 - provided by PlatformIO's SCons
+_lvgl_dir = os.path.join(env.subst("$PROJECT_LIBDEPS_DIR"),  # noqa: F821
+                         env.subst("$PIOENV"), "lvgl")  # noqa: F821
+if not build(env.subst("$PROJECT_DIR"), _lvgl_dir):  # noqa: F821
+    env.Exit(1)  # noqa: F821
@@ -0,0 +1,395 @@
+#include "recording_reader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "crc32.h"
+
+namespace ergo {
+
+namespace {
+
+constexpr size_t kCsvColumns = 24;
+
+bool parseUnsigned(std::string_view field, uint32_t &value) {
+  if (field.empty()) {
+    return false;
+  }
+  uint32_t result = 0;
+  size_t i = 0;
+  uint32_t base = 10;
+  if (field.size() > 2 && field[0] == '0' && (field[1] == 'x' || field[1] == 'X')) {
+    base = 16;
+    i = 2;
+  }
+  for (; i < field.size(); ++i) {
+    const char c = field[i];
+    uint32_t digit = 0;
+    if (c >= '0' && c <= '9') {
+      digit = static_cast<uint32_t>(c - '0');
+    } else if (base == 16 && c >= 'A' && c <= 'F') {
+      digit = static_cast<uint32_t>(c - 'A' + 10);
+    } else if (base == 16 && c >= 'a' && c <= 'f') {
+      digit = static_cast<uint32_t>(c - 'a' + 10);
+    } else {
+      return false;
+    }
+    result = result * base + digit;
+  }
+  value = result;
+  return true;
+}
+
+// Fixed-point only: the recorder prints floats with %.4f / %.5f.
+bool parseFloat(std::string_view field, float &value) {
+  if (field.empty()) {
+    return false;
+  }
+  size_t i = 0;
+  const bool negative = field[0] == '-';
+  if (negative || field[0] == '+') {
+    ++i;
+  }
+  double result = 0.0;
+  double scale = 1.0;
+  bool fraction = false;
+  for (; i < field.size(); ++i) {
+    const char c = field[i];
+    if (c == '.' && !fraction) {
+      fraction = true;
+    } else if (c >= '0' && c <= '9') {
+      result = result * 10.0 + (c - '0');
+      if (fraction) {
+        scale *= 10.0;
+      }
+    } else {
+      return false;
+    }
+  }
+  value = static_cast<float>((negative ? -result : result) / scale);
+  return true;
+}
+
+template <typename T>
+bool parseField(std::string_view field, T &value) {
+  uint32_t parsed = 0;
+  if (!parseUnsigned(field, parsed)) {
+    return false;
+  }
+  value = static_cast<T>(parsed);
+  return true;
+}
+
+bool parseFlag(std::string_view field, bool &value) {
+  value = field == "1";
+  return value || field == "0";
+}
+
+bool parseRow(std::string_view line, VitalsRow &row) {
+  std::string_view fields[kCsvColumns];
+  size_t count = 0;
+  size_t start = 0;
+  while (count < kCsvColumns) {
+    const size_t comma = line.find(',', start);
+    fields[count++] = line.substr(start, comma == std::string_view::npos
+                                             ? std::string_view::npos
+                                             : comma - start);
+    if (comma == std::string_view::npos) {
+      break;
+    }
+    start = comma + 1U;
+  }
+  if (count != kCsvColumns) {
+    return false;
+  }
+
+  DiagnosticsRow &diag = row.diagnostics;
+  row.line = line;
+  row.date = fields[1];
+  row.time = fields[2];
+  row.filterMode = fields[3];
+  diag.motionState = fields[19];
+  return parseField(fields[0], row.millis) && parseField(fields[4], row.hr) &&
+         parseField(fields[5], row.spo2X100) && parseField(fields[6], row.rri) &&
+         parseField(fields[7], row.hrv) && parseField(fields[8], row.status) &&
+         parseField(fields[9], row.batteryPercent) &&
+         parseFlag(fields[10], row.bleConnected) &&
+         parseField(fields[11], diag.irRaw) && parseField(fields[12], diag.redRaw) &&
+         parseField(fields[13], diag.irFiltered) &&
+         parseFloat(fields[14], diag.accelX) && parseFloat(fields[15], diag.accelY) &&
+         parseFloat(fields[16], diag.accelZ) &&
+         parseFloat(fields[17], diag.accelMagnitude) &&
+         parseFloat(fields[18], diag.motionScore) &&
+         parseFlag(fields[20], diag.imuReady) &&
+         parseFlag(fields[21], diag.fingerPresent) &&
+         parseFlag(fields[22], diag.peakDetected) &&
+         parseFlag(fields[23], diag.rriAccepted);
+}
+
+bool fileExists(const std::string &path) {
+  struct stat info;
+  return stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode);
+}
+
+}  // namespace
+
+MappedFile::~MappedFile() { close(); }
+
+bool MappedFile::open(const char *path) {
+  close();
+  const int fd = ::open(path, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    ::close(fd);
+    return false;
+  }
+  size_ = static_cast<size_t>(info.st_size);
+  if (size_ > 0U) {
+    void *mapping = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+      ::close(fd);
+      size_ = 0;
+      return false;
+    }
+    madvise(mapping, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<const uint8_t *>(mapping);
+  }
+  ::close(fd);
+  return true;
+}
+
+void MappedFile::close() {
+  if (data_ != nullptr) {
+    munmap(const_cast<uint8_t *>(data_), size_);
+  }
+  data_ = nullptr;
+  size_ = 0;
+}
+
+bool ErgFile::open(const char *path) {
+  hasFooter_ = false;
+  index_.clear();
+  if (!file_.open(path) || !parseFileHeader(file_.data(), file_.size(), header_)) {
+    file_.close();
+    return false;
+  }
+  loadIndex();
+  return true;
+}
+
+void ErgFile::loadIndex() {
+  const uint8_t *data = file_.data();
+  const size_t size = file_.size();
+  BlockHeader header;
+  if (size >= kFileHeaderSize + kFooterBlockSize &&
+      parseBlockHeader(data + size - kFooterBlockSize, kFooterBlockSize, header) &&
+      header.type == BlockType::Footer &&
+      parseFooter(data + size - kFooterBlockSize + kBlockHeaderSize,
+                  kFooterPayloadSize, footer_) &&
+      footer_.indexTableOffset + kBlockHeaderSize +
+              static_cast<size_t>(footer_.indexEntryCount) * kIntervalSummarySize <=
+          size) {
+    hasFooter_ = true;
+    const uint8_t *table = data + footer_.indexTableOffset + kBlockHeaderSize;
+    index_.resize(footer_.indexEntryCount);
+    for (uint32_t i = 0; i < footer_.indexEntryCount; ++i) {
+      parseIntervalSummary(table + i * kIntervalSummarySize, kIntervalSummarySize,
+                           index_[i]);
+    }
+    return;
+  }
+
+  BlockCursor cursor = blocks(kFileHeaderSize, false);
+  BlockView block;
+  while (cursor.next(block)) {
+    IntervalSummary summary;
+    if (block.header.type == BlockType::Index &&
+        parseIntervalSummary(block.payload, block.header.payloadBytes, summary)) {
+      index_.push_back(summary);
+    }
+  }
+}
+
+ErgFile::BlockCursor ErgFile::blocks(size_t fromOffset, bool verifyCrc) const {
+  BlockCursor cursor;
+  cursor.file_ = this;
+  cursor.offset_ = std::max(fromOffset, kFileHeaderSize);
+  cursor.verifyCrc_ = verifyCrc;
+  return cursor;
+}
+
+bool ErgFile::BlockCursor::next(BlockView &block) {
+  const size_t size = file_->size();
+  if (corrupt_ || offset_ + kBlockHeaderSize > size) {
+    return false;
+  }
+  const uint8_t *data = file_->data();
+  if (!parseBlockHeader(data + offset_, size - offset_, block.header) ||
+      block.header.payloadBytes > size - offset_ - kBlockHeaderSize) {
+    corrupt_ = true;
+    return false;
+  }
+  block.payload = data + offset_ + kBlockHeaderSize;
+  block.offset = offset_;
+  if (verifyCrc_ &&
+      blockCrc(block.header, block.payload, block.header.payloadBytes) != block.header.crc) {
+    corrupt_ = true;
+    return false;
+  }
+  offset_ += kBlockHeaderSize + block.header.payloadBytes;
+  return true;
+}
+
+ErgFile::SampleCursor ErgFile::samples(uint32_t fromMs, uint32_t toMs,
+                                       bool verifyCrc) const {
+  size_t offset = kFileHeaderSize;
+  for (const IntervalSummary &entry : index_) {
+    if (entry.startMs > fromMs) {
+      break;
+    }
+    offset = entry.ergOffset;
+  }
+  SampleCursor cursor;
+  cursor.blocks_ = blocks(offset, verifyCrc);
+  cursor.fromMs_ = fromMs;
+  cursor.toMs_ = toMs;
+  cursor.frames_.resize(static_cast<size_t>(kCodecMaxBlockSamples) * kCodecMaxChannels);
+  return cursor;
+}
+
+bool ErgFile::SampleCursor::next(RawFrame &frame) {
+  while (!done_) {
+    if (position_ == count_) {
+      BlockView block;
+      if (!blocks_.next(block)) {
+        done_ = true;
+        return false;
+      }
+      if (block.header.type != BlockType::RawSamples) {
+        continue;
+      }
+      if (block.header.channels < kRawChannelCount ||
+          block.header.channels > kCodecMaxChannels ||
+          block.header.sampleCount > kCodecMaxBlockSamples ||
+          !decodeSampleBlock(block.payload, block.header.payloadBytes,
+                             block.header.channels, block.header.sampleCount,
+                             frames_.data())) {
+        corrupt_ = true;
+        done_ = true;
+        return false;
+      }
+      channels_ = block.header.channels;
+      count_ = block.header.sampleCount;
+      position_ = 0;
+      continue;
+    }
+
+    const int32_t *values = &frames_[static_cast<size_t>(position_++) * channels_];
+    const uint32_t timestampMs = static_cast<uint32_t>(values[kRawChannelTimestampMs]);
+    if (timestampMs < fromMs_) {
+      continue;
+    }
+    if (timestampMs > toMs_) {
+      done_ = true;
+      return false;
+    }
+    frame.timestampMs = timestampMs;
+    frame.ir = values[kRawChannelIr];
+    frame.red = values[kRawChannelRed];
+    frame.accelXmg = values[kRawChannelAccelXmg];
+    frame.accelYmg = values[kRawChannelAccelYmg];
+    frame.accelZmg = values[kRawChannelAccelZmg];
+    return true;
+  }
+  return false;
+}
+
+bool CsvFile::open(const char *path) {
+  header_ = {};
+  if (!file_.open(path)) {
+    return false;
+  }
+  const char *data = reinterpret_cast<const char *>(file_.data());
+  const char *newline =
+      data != nullptr ? static_cast<const char *>(memchr(data, '\n', file_.size())) : nullptr;
+  header_ = std::string_view(data, newline != nullptr ? newline - data : 0U);
+  return newline != nullptr;
+}
+
+CsvFile::RowCursor CsvFile::rows(size_t fromOffset, uint32_t fromMs,
+                                 uint32_t toMs) const {
+  RowCursor cursor;
+  const char *data = reinterpret_cast<const char *>(file_.data());
+  cursor.end_ = data + file_.size();
+  cursor.position_ = data + std::min(std::max(fromOffset, header_.size() + 1U), file_.size());
+  cursor.fromMs_ = fromMs;
+  cursor.toMs_ = toMs;
+  return cursor;
+}
+
+bool CsvFile::RowCursor::next(VitalsRow &row) {
+  while (position_ < end_) {
+    const char *newline =
+        static_cast<const char *>(memchr(position_, '\n', end_ - position_));
+    const char *lineEnd = newline != nullptr ? newline : end_;
+    const std::string_view line(position_, lineEnd - position_);
+    position_ = newline != nullptr ? newline + 1 : end_;
+    if (!parseRow(line, row)) {
+      ++skipped_;
+      continue;
+    }
+    if (row.millis < fromMs_) {
+      continue;
+    }
+    if (row.millis > toMs_) {
+      position_ = end_;
+      return false;
+    }
+    return true;
+  }
+  return false;
+}
+
+bool Recording::open(const std::string &path) {
+  base_ = path;
+  for (const char *extension : {".erg", ".csv"}) {
+    if (base_.size() > 4U && base_.compare(base_.size() - 4U, 4U, extension) == 0) {
+      base_.resize(base_.size() - 4U);
+    }
+  }
+  const std::string ergPath = base_ + ".erg";
+  const std::string csvPath = base_ + ".csv";
+  hasErg_ = fileExists(ergPath) && erg_.open(ergPath.c_str());
+  hasCsv_ = fileExists(csvPath) && csv_.open(csvPath.c_str());
+  return hasErg_ || hasCsv_;
+}
+
+uint32_t Recording::startMs() const {
+  if (hasErg_) {
+    return erg_.header().startMs;
+  }
+  VitalsRow row;
+  CsvFile::RowCursor cursor = csv_.rows();
+  return hasCsv_ && cursor.next(row) ? row.millis : 0U;
+}
+
+CsvFile::RowCursor Recording::vitals(uint32_t fromMs, uint32_t toMs) const {
+  size_t offset = 0;
+  for (const IntervalSummary &entry : erg_.index()) {
+    if (entry.startMs > fromMs) {
+      break;
+    }
+    offset = entry.csvOffset;
+  }
+  return csv_.rows(offset, fromMs, toMs);
+}
+
+}  // namespace ergo
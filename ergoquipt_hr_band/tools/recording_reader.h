@@ -0,0 +1,197 @@
+#pragma once
+
+// Host-side (POSIX) reader for the band's recordings. Files are memory-mapped
+// read-only: CSV rows are parsed in place into views of the mapping and .erg
+// payloads are decoded straight from it, so the only copy is one decoded
+// block of sample frames at a time.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "recording_format.h"
+#include "sample_codec.h"
+
+namespace ergo {
+
+class MappedFile {
+ public:
+  MappedFile() = default;
+  ~MappedFile();
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  bool open(const char *path);
+  void close();
+  const uint8_t *data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  const uint8_t *data_ = nullptr;
+  size_t size_ = 0;
+};
+
+struct RawFrame {
+  uint32_t timestampMs = 0;
+  int32_t ir = 0;
+  int32_t red = 0;
+  int32_t accelXmg = 0;
+  int32_t accelYmg = 0;
+  int32_t accelZmg = 0;
+};
+
+struct BlockView {
+  BlockHeader header;
+  const uint8_t *payload = nullptr;
+  size_t offset = 0;
+};
+
+// One .erg file. The index comes from the footer table when the recording was
+// closed cleanly, otherwise from a header-only walk over the Index blocks.
+class ErgFile {
+ public:
+  class BlockCursor {
+   public:
+    // Returns false at the end of the file or at the first malformed block;
+    // corrupt() tells the two apart.
+    bool next(BlockView &block);
+    bool corrupt() const { return corrupt_; }
+    size_t offset() const { return offset_; }
+
+   private:
+    friend class ErgFile;
+    const ErgFile *file_ = nullptr;
+    size_t offset_ = 0;
+    bool verifyCrc_ = true;
+    bool corrupt_ = false;
+  };
+
+  class SampleCursor {
+   public:
+    bool next(RawFrame &frame);
+    bool corrupt() const { return corrupt_ || blocks_.corrupt(); }
+
+   private:
+    friend class ErgFile;
+    BlockCursor blocks_;
+    uint32_t fromMs_ = 0;
+    uint32_t toMs_ = UINT32_MAX;
+    std::vector<int32_t> frames_;
+    uint16_t count_ = 0;
+    uint16_t position_ = 0;
+    uint8_t channels_ = 0;
+    bool done_ = false;
+    bool corrupt_ = false;
+  };
+
+  bool open(const char *path);
+  const FileHeader &header() const { return header_; }
+  bool hasFooter() const { return hasFooter_; }
+  const FooterInfo &footer() const { return footer_; }
+  const std::vector<IntervalSummary> &index() const { return index_; }
+  const uint8_t *data() const { return file_.data(); }
+  size_t size() const { return file_.size(); }
+
+  BlockCursor blocks(size_t fromOffset = kFileHeaderSize, bool verifyCrc = true) const;
+  // Frames with fromMs <= timestamp <= toMs, starting from the index entry
+  // that covers fromMs.
+  SampleCursor samples(uint32_t fromMs = 0, uint32_t toMs = UINT32_MAX,
+                       bool verifyCrc = true) const;
+
+ private:
+  void loadIndex();
+
+  MappedFile file_;
+  FileHeader header_;
+  FooterInfo footer_;
+  bool hasFooter_ = false;
+  std::vector<IntervalSummary> index_;
+};
+
+struct DiagnosticsRow {
+  uint32_t irRaw = 0;
+  uint32_t redRaw = 0;
+  uint32_t irFiltered = 0;
+  float accelX = 0.0f;
+  float accelY = 0.0f;
+  float accelZ = 0.0f;
+  float accelMagnitude = 0.0f;
+  float motionScore = 0.0f;
+  std::string_view motionState;
+  bool imuReady = false;
+  bool fingerPresent = false;
+  bool peakDetected = false;
+  bool rriAccepted = false;
+};
+
+// One 1 Hz vitals row. Text fields and `line` point into the mapping.
+struct VitalsRow {
+  uint32_t millis = 0;
+  std::string_view date;
+  std::string_view time;
+  std::string_view filterMode;
+  uint16_t hr = 0;
+  uint16_t spo2X100 = 0;
+  uint16_t rri = 0;
+  uint16_t hrv = 0;
+  uint8_t status = 0;
+  uint8_t batteryPercent = 0;
+  bool bleConnected = false;
+  DiagnosticsRow diagnostics;
+  std::string_view line;
+};
+
+class CsvFile {
+ public:
+  class RowCursor {
+   public:
+    // Skips rows that do not have all columns, e.g. a torn last row.
+    bool next(VitalsRow &row);
+    size_t skipped() const { return skipped_; }
+
+   private:
+    friend class CsvFile;
+    const char *position_ = nullptr;
+    const char *end_ = nullptr;
+    uint32_t fromMs_ = 0;
+    uint32_t toMs_ = UINT32_MAX;
+    size_t skipped_ = 0;
+  };
+
+  bool open(const char *path);
+  std::string_view headerLine() const { return header_; }
+  size_t size() const { return file_.size(); }
+  RowCursor rows(size_t fromOffset = 0, uint32_t fromMs = 0,
+                 uint32_t toMs = UINT32_MAX) const;
+
+ private:
+  MappedFile file_;
+  std::string_view header_;
+};
+
+// A .csv/.erg pair sharing one base name; either file may be missing.
+class Recording {
+ public:
+  // Accepts the base path or either file's path.
+  bool open(const std::string &path);
+  const std::string &baseName() const { return base_; }
+  bool hasErg() const { return hasErg_; }
+  bool hasCsv() const { return hasCsv_; }
+  const ErgFile &erg() const { return erg_; }
+  const CsvFile &csv() const { return csv_; }
+  // Device millis of the first row or sample.
+  uint32_t startMs() const;
+  // Uses the .erg index to start reading the CSV near fromMs.
+  CsvFile::RowCursor vitals(uint32_t fromMs = 0, uint32_t toMs = UINT32_MAX) const;
+
+ private:
+  std::string base_;
+  ErgFile erg_;
+  CsvFile csv_;
+  bool hasErg_ = false;
+  bool hasCsv_ = false;
+};
+
+}  // namespace ergo
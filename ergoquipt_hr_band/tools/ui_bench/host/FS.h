@@ -0,0 +1,18 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Only the types: the bench builds the UI, not the recorder.
+namespace fs {
+
+class File {
+ public:
+  explicit operator bool() const { return false; }
+};
+
+class FS {};
+
+}  // namespace fs
+
+using fs::File;
+using fs::FS;
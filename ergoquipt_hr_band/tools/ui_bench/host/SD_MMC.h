@@ -0,0 +1,7 @@
+#pragma once
+
+#include <FS.h>
+
+class SDMMCFS : public fs::FS {};
+
+extern SDMMCFS SD_MMC;
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <Wire.h>
+
+// Type only; RtcManager is never instantiated on the host.
+class SensorPCF85063 {};
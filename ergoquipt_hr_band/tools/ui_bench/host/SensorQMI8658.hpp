@@ -0,0 +1,6 @@
+#pragma once
+
+#include <Wire.h>
+
+// Type only; SensorManager is never instantiated on the host.
+class SensorQMI8658 {};
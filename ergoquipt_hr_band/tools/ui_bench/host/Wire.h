@@ -0,0 +1,24 @@
+#pragma once
+
+#include <Arduino.h>
+
+// I2C master backed by a model of the FT3168 touch controller's point
+// registers; hostSetTouch() in host_platform.h changes what it reads back.
+class TwoWire {
+ public:
+  void beginTransmission(uint8_t address);
+  size_t write(uint8_t value);
+  uint8_t endTransmission(bool stop = true);
+  uint8_t requestFrom(uint8_t address, uint8_t count);
+  int available();
+  int read();
+
+ private:
+  uint8_t address_ = 0;
+  uint8_t register_ = 0;
+  uint8_t rx_[8] = {};
+  uint8_t rxCount_ = 0;
+  uint8_t rxIndex_ = 0;
+};
+
+extern TwoWire Wire;
@@ -0,0 +1,6 @@
+#pragma once
+
+// Types display_panel.h names; the host panel never talks to esp_lcd.
+typedef struct esp_lcd_panel_io_t *esp_lcd_panel_io_handle_t;
+typedef struct {
+} esp_lcd_panel_io_event_data_t;
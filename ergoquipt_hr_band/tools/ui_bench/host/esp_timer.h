@@ -0,0 +1,6 @@
+#pragma once
+
+#include <cstdint>
+
+// Real monotonic time in microseconds; the bench measures with it.
+int64_t esp_timer_get_time();
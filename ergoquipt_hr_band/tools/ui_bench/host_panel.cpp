@@ -0,0 +1,103 @@
+// DisplayPanel for the host bench: same interface as display_panel.cpp, but
+// bands are copied into a memory framebuffer and handed straight back, and
+// LVGL's monitor callback records how much each refresh rendered.
+
+#include "display_panel.h"
+
+#include <esp_timer.h>
+
+#include <algorithm>
+
+#include "host_platform.h"
+
+namespace {
+
+uint16_t g_framebuffer[cfg::kDisplayWidth * cfg::kDisplayHeight];
+HostFrameStats g_frameStats;
+
+void monitor(lv_disp_drv_t *driver, uint32_t timeMs, uint32_t pixels) {
+  (void)driver;
+  (void)timeMs;
+  ++g_frameStats.refreshes;
+  g_frameStats.renderedPixels += pixels;
+}
+
+}  // namespace
+
+HostFrameStats hostTakeFrameStats() {
+  const HostFrameStats stats = g_frameStats;
+  g_frameStats = HostFrameStats{};
+  return stats;
+}
+
+const uint16_t *hostFramebuffer() { return g_framebuffer; }
+
+bool DisplayPanel::begin() { return true; }
+
+bool DisplayPanel::attach(lv_disp_drv_t &driver, lv_disp_draw_buf_t &drawBuffer) {
+  bufferLines_ = cfg::kDisplayDrawBufferLines;
+  for (lv_color_t *&buffer : buffers_) {
+    buffer = static_cast<lv_color_t *>(heap_caps_malloc(
+        cfg::kDisplayWidth * bufferLines_ * sizeof(lv_color_t), MALLOC_CAP_DMA));
+  }
+  lv_disp_draw_buf_init(&drawBuffer, buffers_[0], buffers_[1],
+                        cfg::kDisplayWidth * bufferLines_);
+  driver.flush_cb = flush;
+  driver.rounder_cb = round;
+  driver.monitor_cb = monitor;
+  driver.draw_buf = &drawBuffer;
+  driver.user_data = this;
+  driver_ = &driver;
+  lv_disp_drv_register(&driver);
+  return true;
+}
+
+void DisplayPanel::setBrightness(uint8_t level) { (void)level; }
+
+DisplayStats DisplayPanel::takeStats() {
+  const DisplayStats stats = stats_;
+  stats_ = DisplayStats{};
+  return stats;
+}
+
+uint32_t DisplayPanel::submits() const { return submits_; }
+
+void DisplayPanel::flush(lv_disp_drv_t *driver, const lv_area_t *area, lv_color_t *pixels) {
+  auto *panel = static_cast<DisplayPanel *>(driver->user_data);
+  const int64_t startUs = esp_timer_get_time();
+  const size_t width = static_cast<size_t>(area->x2 - area->x1 + 1);
+  const size_t count = lv_area_get_size(area);
+  for (lv_coord_t y = area->y1; y <= area->y2; ++y) {
+    uint16_t *row = &g_framebuffer[(y * cfg::kDisplayWidth) + area->x1];
+    const lv_color_t *source = &pixels[(y - area->y1) * width];
+    for (size_t x = 0; x < width; ++x) {
+      const uint16_t full = source[x].full;
+#if LV_COLOR_16_SWAP
+      row[x] = static_cast<uint16_t>((full >> 8U) | (full << 8U));
+#else
+      row[x] = full;
+#endif
+    }
+  }
+  ++panel->submits_;
+  lv_disp_flush_ready(driver);
+
+  const uint32_t flushUs = static_cast<uint32_t>(esp_timer_get_time() - startUs);
+  ++panel->stats_.flushes;
+  panel->stats_.flushBytes += count * sizeof(lv_color_t);
+  panel->stats_.flushUsTotal += flushUs;
+  panel->stats_.flushUsMax = std::max(panel->stats_.flushUsMax, flushUs);
+  panel->stats_.submitUsTotal += flushUs;
+  ++g_frameStats.flushes;
+  g_frameStats.flushedPixels += count;
+  g_frameStats.flushUs += flushUs;
+}
+
+// Same rounding as the SH8601 driver, so invalidated areas match the target.
+void DisplayPanel::round(lv_disp_drv_t *driver, lv_area_t *area) {
+  (void)driver;
+  area->x1 &= ~1;
+  area->y1 &= ~1;
+  area->x2 |= 1;
+  area->y2 |= 1;
+}
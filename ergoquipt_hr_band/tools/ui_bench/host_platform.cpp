@@ -0,0 +1,252 @@
+#include "host_platform.h"
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#include <chrono>
+#include <deque>
+#include <vector>
+
+#include "config.h"
+#include "logger.h"
+
+namespace {
+
+constexpr uint8_t kFt3168RegNumTouches = 0x02;
+constexpr uint8_t kFt3168RegXHigh = 0x03;
+constexpr uint8_t kFt3168RegYLow = 0x06;
+
+uint32_t g_nowMs = 0;
+void (*g_touchIsr)() = nullptr;
+bool g_touchPressed = false;
+uint16_t g_touchX = 0;
+uint16_t g_touchY = 0;
+
+uint8_t touchRegister(uint8_t reg) {
+  switch (reg) {
+    case kFt3168RegNumTouches:
+      return g_touchPressed ? 1U : 0U;
+    case kFt3168RegXHigh:
+      return static_cast<uint8_t>((g_touchX >> 8U) & 0x0FU);
+    case kFt3168RegXHigh + 1U:
+      return static_cast<uint8_t>(g_touchX);
+    case kFt3168RegXHigh + 2U:
+      return static_cast<uint8_t>((g_touchY >> 8U) & 0x0FU);
+    case kFt3168RegYLow:
+      return static_cast<uint8_t>(g_touchY);
+    default:
+      return 0;
+  }
+}
+
+}  // namespace
+
+struct HostQueue {
+  size_t length;
+  size_t itemSize;
+  std::deque<std::vector<uint8_t>> items;
+};
+
+struct HostSemaphore {};
+
+TwoWire Wire;
+SemaphoreHandle_t g_i2cMutex = nullptr;
+
+void hostAdvanceMs(uint32_t ms) { g_nowMs += ms; }
+
+void hostSetTouch(bool pressed, uint16_t x, uint16_t y) {
+  const bool edge = pressed && !g_touchPressed;
+  g_touchPressed = pressed;
+  g_touchX = x;
+  g_touchY = y;
+  if (edge && g_touchIsr != nullptr) {
+    g_touchIsr();
+  }
+}
+
+uint32_t millis() { return g_nowMs; }
+
+uint32_t micros() { return g_nowMs * 1000U; }
+
+void delay(uint32_t ms) { hostAdvanceMs(ms); }
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+int digitalPinToInterrupt(uint8_t pin) { return pin; }
+
+void attachInterrupt(uint8_t pin, void (*handler)(), int mode) {
+  (void)mode;
+  if (pin == cfg::kTouchIntPin) {
+    g_touchIsr = handler;
+  }
+}
+
+void *ps_malloc(size_t size) { return malloc(size); }
+
+void *heap_caps_malloc(size_t size, uint32_t caps) {
+  (void)caps;
+  return malloc(size);
+}
+
+void heap_caps_free(void *pointer) { free(pointer); }
+
+// The bench registers no tasks and has no heap figures to report.
+size_t heap_caps_get_free_size(uint32_t caps) {
+  (void)caps;
+  return 0;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+  (void)caps;
+  return 0;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+  (void)caps;
+  return 0;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+  (void)task;
+  return 0;
+}
+
+const char *pcTaskGetName(TaskHandle_t task) {
+  (void)task;
+  return "";
+}
+
+int64_t esp_timer_get_time() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void vTaskDelay(TickType_t ticks) { hostAdvanceMs(ticks); }
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  return new HostQueue{length, itemSize, {}};
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t wait) {
+  (void)wait;
+  if (queue->items.size() >= queue->length) {
+    return pdFALSE;
+  }
+  const auto *bytes = static_cast<const uint8_t *>(item);
+  queue->items.emplace_back(bytes, bytes + queue->itemSize);
+  return pdTRUE;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void *item, BaseType_t *woken) {
+  if (woken != nullptr) {
+    *woken = pdFALSE;
+  }
+  return xQueueSend(queue, item, 0);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t wait) {
+  (void)wait;
+  if (queue->items.empty()) {
+    return pdFALSE;
+  }
+  memcpy(item, queue->items.front().data(), queue->itemSize);
+  queue->items.pop_front();
+  return pdTRUE;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  static HostSemaphore mutex;
+  return &mutex;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() { return xSemaphoreCreateMutex(); }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t wait) {
+  (void)semaphore;
+  (void)wait;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+  (void)semaphore;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t *woken) {
+  if (woken != nullptr) {
+    *woken = pdFALSE;
+  }
+  return xSemaphoreGive(semaphore);
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+  address_ = address;
+  rxCount_ = 0;
+  rxIndex_ = 0;
+}
+
+size_t TwoWire::write(uint8_t value) {
+  register_ = value;
+  return 1;
+}
+
+uint8_t TwoWire::endTransmission(bool stop) {
+  (void)stop;
+  // 2 = address NACK, as on the real bus.
+  return address_ == cfg::kFt3168Address ? 0U : 2U;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t count) {
+  if (address != cfg::kFt3168Address || count > sizeof(rx_)) {
+    return 0;
+  }
+  for (uint8_t i = 0; i < count; ++i) {
+    rx_[i] = touchRegister(static_cast<uint8_t>(register_ + i));
+  }
+  rxCount_ = count;
+  rxIndex_ = 0;
+  return count;
+}
+
+int TwoWire::available() { return rxCount_ - rxIndex_; }
+
+int TwoWire::read() { return rxIndex_ < rxCount_ ? rx_[rxIndex_++] : -1; }
+
+// The UI only logs display stats and init failures; the bench reports its
+// own numbers, so logging is compiled in but always off.
+bool logEnabled(LogModule module, LogLevel level) {
+  (void)module;
+  (void)level;
+  return false;
+}
+
+LogRecord *logReserve(LogModule module, LogLevel level, const char *format) {
+  (void)module;
+  (void)level;
+  (void)format;
+  return nullptr;
+}
+
+void logCommit(LogRecord *record) { (void)record; }
+
+void LogRecord::put(const char *value) { (void)value; }
+
+void LogRecord::putWide(long long value, size_t size) {
+  (void)value;
+  (void)size;
+}
+
+void LogRecord::putWide(unsigned long long value, size_t size) {
+  (void)value;
+  (void)size;
+}
+
+void LogRecord::putRaw(LogArgType type, const void *value, size_t size) {
+  (void)type;
+  (void)value;
+  (void)size;
+}
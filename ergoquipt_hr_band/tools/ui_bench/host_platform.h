@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Controls for the host shims in host/ and the memory display in
+// host_panel.cpp. Everything runs on the bench's one thread.
+
+// Moves millis() forward; the UI only ever sees this clock.
+void hostAdvanceMs(uint32_t ms);
+
+// Sets what the FT3168 model reports. A press raises the touch interrupt the
+// way the controller pulls INT low.
+void hostSetTouch(bool pressed, uint16_t x, uint16_t y);
+
+// Render work seen by the display driver since the previous call.
+struct HostFrameStats {
+  // lv_refr passes that drew something.
+  uint32_t refreshes = 0;
+  // Pixels LVGL rendered, i.e. the invalidated area after joining.
+  uint64_t renderedPixels = 0;
+  uint32_t flushes = 0;
+  uint64_t flushedPixels = 0;
+  // Time spent copying bands into the framebuffer.
+  uint64_t flushUs = 0;
+};
+
+HostFrameStats hostTakeFrameStats();
+
+// The panel's memory, RGB565 in native byte order, row major.
+const uint16_t *hostFramebuffer();
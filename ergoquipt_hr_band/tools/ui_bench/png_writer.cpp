@@ -0,0 +1,88 @@
+#include "png_writer.h"
+
+#include <crc32.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+constexpr size_t kMaxStoredBlock = 65535;
+
+void putBe32(std::vector<uint8_t> &out, uint32_t value) {
+  out.push_back(static_cast<uint8_t>(value >> 24U));
+  out.push_back(static_cast<uint8_t>(value >> 16U));
+  out.push_back(static_cast<uint8_t>(value >> 8U));
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+uint32_t adler32(const std::vector<uint8_t> &data) {
+  uint32_t a = 1;
+  uint32_t b = 0;
+  for (const uint8_t byte : data) {
+    a = (a + byte) % 65521U;
+    b = (b + a) % 65521U;
+  }
+  return (b << 16U) | a;
+}
+
+// Length, type, data, then the CRC over type and data.
+void putChunk(std::vector<uint8_t> &out, const char type[4], const std::vector<uint8_t> &data) {
+  putBe32(out, static_cast<uint32_t>(data.size()));
+  const size_t typeAt = out.size();
+  out.insert(out.end(), type, type + 4);
+  out.insert(out.end(), data.begin(), data.end());
+  putBe32(out, ergo::crc32(&out[typeAt], out.size() - typeAt));
+}
+
+}  // namespace
+
+bool writePng(const char *path, const uint16_t *pixels, uint16_t width, uint16_t height) {
+  // Filter type 0 in front of every row.
+  std::vector<uint8_t> raw;
+  raw.reserve(static_cast<size_t>(height) * ((width * 3U) + 1U));
+  for (uint16_t y = 0; y < height; ++y) {
+    raw.push_back(0);
+    for (uint16_t x = 0; x < width; ++x) {
+      const uint16_t pixel = pixels[(static_cast<size_t>(y) * width) + x];
+      const uint8_t r = static_cast<uint8_t>((pixel >> 11U) & 0x1FU);
+      const uint8_t g = static_cast<uint8_t>((pixel >> 5U) & 0x3FU);
+      const uint8_t b = static_cast<uint8_t>(pixel & 0x1FU);
+      raw.push_back(static_cast<uint8_t>((r << 3U) | (r >> 2U)));
+      raw.push_back(static_cast<uint8_t>((g << 2U) | (g >> 4U)));
+      raw.push_back(static_cast<uint8_t>((b << 3U) | (b >> 2U)));
+    }
+  }
+
+  std::vector<uint8_t> zlib = {0x78, 0x01};
+  for (size_t offset = 0; offset < raw.size(); offset += kMaxStoredBlock) {
+    const size_t size = std::min(kMaxStoredBlock, raw.size() - offset);
+    const bool last = offset + size == raw.size();
+    zlib.push_back(last ? 1U : 0U);
+    zlib.push_back(static_cast<uint8_t>(size));
+    zlib.push_back(static_cast<uint8_t>(size >> 8U));
+    zlib.push_back(static_cast<uint8_t>(~size));
+    zlib.push_back(static_cast<uint8_t>(~size >> 8U));
+    zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + size);
+  }
+  putBe32(zlib, adler32(raw));
+
+  std::vector<uint8_t> header;
+  putBe32(header, width);
+  putBe32(header, height);
+  // 8-bit depth, truecolour, deflate, adaptive filtering, no interlace.
+  header.insert(header.end(), {8, 2, 0, 0, 0});
+
+  std::vector<uint8_t> file = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  putChunk(file, "IHDR", header);
+  putChunk(file, "IDAT", zlib);
+  putChunk(file, "IEND", {});
+
+  FILE *out = fopen(path, "wb");
+  if (out == nullptr) {
+    return false;
+  }
+  const bool ok = fwrite(file.data(), 1, file.size(), out) == file.size();
+  return fclose(out) == 0 && ok;
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <cstdint>
+
+// Writes an RGB565 frame as an 8-bit RGB PNG. Uses stored (uncompressed)
+// deflate blocks: files are larger than zlib's, but byte-identical for
+// identical frames, which is what the visual diff needs.
+bool writePng(const char *path, const uint16_t *pixels, uint16_t width, uint16_t height);
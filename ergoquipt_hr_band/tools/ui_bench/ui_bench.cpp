@@ -0,0 +1,379 @@
+// Headless render benchmark for the band's UI. Builds UiManager unchanged
+// against LVGL on the host, with a memory framebuffer in place of the SH8601
+// and a scripted FT3168, then visits every page by tapping its nav button and
+// drives it with synthetic vitals, waveform, BLE and recorder updates.
+//
+// Build and run (from ergoquipt_hr_band/):
+//   pio run -e native-ui-bench
+//   .pio/build/native-ui-bench/program [options]
+//
+// Options:
+//   --seconds <n>        virtual seconds per page (default 10)
+//   --png <dir>          write <dir>/<page>.png with the page's last frame
+//   --csv <file>         per-page results as CSV
+//   --max-frame-us <n>   exit 2 if any page's mean frame time is above n
+//
+// Time inside the UI is virtual: millis() only moves when the bench says so,
+// which makes every run do the same work. The timings are real host time.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "host_platform.h"
+#include "png_writer.h"
+#include "trend_store.h"
+#include "ui_events.h"
+#include "ui_manager.h"
+
+namespace {
+
+constexpr uint16_t kNavY = 85;
+constexpr uint32_t kTapHoldMs = 120;
+constexpr uint32_t kSettleMs = 500;
+// The trend store starts with this much history so every range has data.
+constexpr uint32_t kPrefillHours = 26;
+constexpr uint32_t kSensorPeriodMs = cfg::kSensorTaskPeriodMs;
+
+struct Page {
+  const char *name;
+  // Centre of the page's nav button; the screen has 16 px padding.
+  uint16_t navX;
+};
+
+const Page kPages[] = {
+    {"dashboard", 16 + 32}, {"wave", 16 + 68 + 32},    {"trends", 16 + 136 + 32},
+    {"record", 16 + 204 + 32}, {"device", cfg::kDisplayWidth - 16 - 32},
+};
+
+struct Totals {
+  uint32_t ticks = 0;
+  uint32_t frames = 0;
+  uint64_t frameUsTotal = 0;
+  uint32_t frameUsMax = 0;
+  uint64_t tickUsTotal = 0;
+  HostFrameStats display;
+};
+
+struct PageResult {
+  const char *name = "";
+  uint32_t virtualMs = 0;
+  // Tap, release and the first frames of the new page.
+  uint64_t switchUs = 0;
+  Totals run;
+};
+
+void add(HostFrameStats &into, const HostFrameStats &from) {
+  into.refreshes += from.refreshes;
+  into.renderedPixels += from.renderedPixels;
+  into.flushes += from.flushes;
+  into.flushedPixels += from.flushedPixels;
+  into.flushUs += from.flushUs;
+}
+
+// Everything the other tasks would feed the UI: a PPG trace at 100 Hz and
+// the 1 Hz vitals tick with the BLE, recorder and RTC state that goes with it.
+class Scenario {
+ public:
+  explicit Scenario(TrendStore &trends) : trends_(trends) {}
+
+  WaveformRing &waveform() { return waveform_; }
+
+  void prefill(uint32_t nowMs, uint32_t hours) {
+    for (uint32_t t = 1000; t <= hours * 3600U * 1000U; t += 1000U) {
+      const uint32_t atMs = nowMs - (hours * 3600U * 1000U) + t;
+      updateVitals(atMs);
+      trends_.append(atMs, vitals_, motion(atMs));
+    }
+    nextSampleMs_ = nowMs;
+    nextSecondMs_ = nowMs - (nowMs % 1000U) + 1000U;
+  }
+
+  // Produces everything due up to nowMs.
+  void step(uint32_t nowMs) {
+    while (static_cast<int32_t>(nowMs - nextSampleMs_) >= 0) {
+      pushSample(nextSampleMs_);
+      nextSampleMs_ += kSensorPeriodMs;
+    }
+    while (static_cast<int32_t>(nowMs - nextSecondMs_) >= 0) {
+      second(nextSecondMs_);
+      nextSecondMs_ += 1000U;
+    }
+  }
+
+  uint32_t untilNextSecond(uint32_t nowMs) const { return nextSecondMs_ - nowMs; }
+
+  uint32_t tick(UiManager &ui) {
+    return ui.tick(vitals_, bleConnected_, battery_, rtc_, "ErgoQuipt-HR-BENCH", ble_,
+                   recording_, FilteringMode::M2MotionAdaptive);
+  }
+
+ private:
+  uint16_t heartRate(uint32_t atMs) const {
+    return static_cast<uint16_t>(72.0 + (12.0 * std::sin(atMs / 47000.0)));
+  }
+
+  uint16_t motion(uint32_t atMs) const {
+    return static_cast<uint16_t>(150.0 + (140.0 * std::sin(atMs / 9000.0)));
+  }
+
+  void updateVitals(uint32_t atMs) {
+    vitals_.hr = heartRate(atMs);
+    vitals_.spo2_x100 = static_cast<uint16_t>(9750 + (120.0 * std::sin(atMs / 61000.0)));
+    vitals_.rri = static_cast<uint16_t>(60000U / vitals_.hr);
+    vitals_.hrv = static_cast<uint16_t>(45.0 + (10.0 * std::sin(atMs / 23000.0)));
+    vitals_.status = cfg::kStatusVitalsValid | cfg::kStatusRriValid | cfg::kStatusHrvValid;
+  }
+
+  // Systolic peak, dicrotic bump, slow baseline wander and a little noise.
+  void pushSample(uint32_t atMs) {
+    const double periodMs = 60000.0 / heartRate(atMs);
+    const double phase = std::fmod(atMs, periodMs) / periodMs;
+    const double systolic = std::exp(-std::pow((phase - 0.15) / 0.07, 2.0));
+    const double dicrotic = 0.35 * std::exp(-std::pow((phase - 0.45) / 0.1, 2.0));
+    noise_ = (noise_ * 1103515245U) + 12345U;
+    const double jitter = static_cast<double>((noise_ >> 16U) % 41U) - 20.0;
+
+    WaveformSample sample;
+    sample.timestampMs = atMs;
+    sample.ac = static_cast<int32_t>((900.0 * (systolic + dicrotic)) +
+                                     (150.0 * std::sin(atMs / 3100.0)) + jitter);
+    sample.flags = cfg::kWaveformFinger;
+    const double samplePhase = kSensorPeriodMs / periodMs;
+    if (phase >= 0.15 && phase < 0.15 + samplePhase) {
+      // Every seventh peak fails the RR check, as motion artefacts do.
+      sample.flags |= (++beats_ % 7U) == 0U ? cfg::kWaveformPeak
+                                            : (cfg::kWaveformPeak | cfg::kWaveformBeat);
+    }
+    waveform_.push(sample);
+  }
+
+  void second(uint32_t atMs) {
+    updateVitals(atMs);
+    trends_.append(atMs, vitals_, motion(atMs));
+    ++seconds_;
+
+    const uint32_t clock = (9U * 3600U) + seconds_;
+    rtc_.available = true;
+    rtc_.valid = true;
+    snprintf(rtc_.timeText, sizeof(rtc_.timeText), "%02u:%02u:%02u",
+             static_cast<unsigned>((clock / 3600U) % 24U),
+             static_cast<unsigned>((clock / 60U) % 60U), static_cast<unsigned>(clock % 60U));
+    snprintf(rtc_.dateText, sizeof(rtc_.dateText), "2026/05/30");
+
+    ble_.subscribed = bleConnected_;
+    ble_.samplesSent += 100U;
+    ble_.framesSent += 10U;
+    ble_.samplesPerSecond = 100U;
+    ble_.bytesPerSecond = 1900U + (seconds_ % 7U) * 13U;
+
+    recording_.sdReady = true;
+    recording_.recording = true;
+    ++recording_.rowsWritten;
+    recording_.rawFramesWritten += 100U;
+    recording_.rawBytesWritten += 1800U;
+    snprintf(recording_.fileName, sizeof(recording_.fileName), "/REC_0001.csv");
+    snprintf(recording_.statusText, sizeof(recording_.statusText), "Recording %lu rows",
+             static_cast<unsigned long>(recording_.rowsWritten));
+    uiPostEvent(UiEvent::Vitals);
+    uiPostEvent(UiEvent::Recording);
+
+    if ((seconds_ % 5U) == 0U) {
+      bleConnected_ = !bleConnected_;
+      uiPostEvent(UiEvent::Ble);
+    }
+    if ((seconds_ % 30U) == 0U && battery_ > 5U) {
+      --battery_;
+      uiPostEvent(UiEvent::Power);
+    }
+  }
+
+  TrendStore &trends_;
+  WaveformRing waveform_;
+  VitalData vitals_{};
+  RtcSnapshot rtc_{};
+  BleStreamStats ble_{};
+  RecordingSnapshot recording_{};
+  bool bleConnected_ = true;
+  uint8_t battery_ = 87;
+  uint32_t seconds_ = 0;
+  uint32_t beats_ = 0;
+  uint32_t noise_ = 1;
+  uint32_t nextSampleMs_ = 0;
+  uint32_t nextSecondMs_ = 0;
+};
+
+// The ui_task loop on virtual time: feed, drain events, tick, then jump to
+// whichever comes first of LVGL's next deadline and the next vitals tick.
+void run(UiManager &ui, Scenario &scenario, uint32_t durationMs, Totals &totals) {
+  const uint32_t endMs = millis() + durationMs;
+  while (static_cast<int32_t>(endMs - millis()) > 0) {
+    scenario.step(millis());
+    UiEvent event;
+    while (uiWaitEvent(event, 0)) {
+      ui.handleEvent(event);
+    }
+
+    const int64_t startUs = esp_timer_get_time();
+    const uint32_t idleMs = scenario.tick(ui);
+    const uint32_t tickUs = static_cast<uint32_t>(esp_timer_get_time() - startUs);
+    const HostFrameStats display = hostTakeFrameStats();
+    ++totals.ticks;
+    totals.tickUsTotal += tickUs;
+    if (display.flushes > 0U) {
+      ++totals.frames;
+      totals.frameUsTotal += tickUs;
+      totals.frameUsMax = std::max(totals.frameUsMax, tickUs);
+    }
+    add(totals.display, display);
+
+    const uint32_t nowMs = millis();
+    const uint32_t stepMs =
+        std::min({idleMs, scenario.untilNextSecond(nowMs), endMs - nowMs});
+    hostAdvanceMs(std::max<uint32_t>(stepMs, 1U));
+  }
+}
+
+void tap(UiManager &ui, Scenario &scenario, uint16_t x, uint16_t y, Totals &totals) {
+  hostSetTouch(true, x, y);
+  run(ui, scenario, kTapHoldMs, totals);
+  hostSetTouch(false, x, y);
+  run(ui, scenario, kSettleMs, totals);
+}
+
+uint64_t perFrame(uint64_t total, uint32_t frames) { return frames > 0U ? total / frames : 0U; }
+
+void report(const std::vector<PageResult> &results, FILE *csv) {
+  const uint64_t screenPixels = static_cast<uint64_t>(cfg::kDisplayWidth) * cfg::kDisplayHeight;
+  printf("%-10s %6s %5s %9s %9s %9s %10s %6s %8s %10s\n", "page", "frames", "fps",
+         "frame_us", "max_us", "flush_us", "px/frame", "area%", "Mpx/s", "switch_us");
+  if (csv != nullptr) {
+    fprintf(csv,
+            "page,frames,fps,frame_us_mean,frame_us_max,flush_us_mean,render_us_mean,"
+            "rendered_px_per_frame,flushed_px_per_frame,area_pct,mpx_per_s,switch_us\n");
+  }
+  for (const PageResult &result : results) {
+    const Totals &run = result.run;
+    const double fps = result.virtualMs > 0U ? (run.frames * 1000.0) / result.virtualMs : 0.0;
+    const uint64_t frameUs = perFrame(run.frameUsTotal, run.frames);
+    const uint64_t flushUs = perFrame(run.display.flushUs, run.frames);
+    // Render time is the frame minus the copy the panel driver does.
+    const uint64_t renderUsTotal =
+        run.frameUsTotal - std::min(run.frameUsTotal, run.display.flushUs);
+    const uint64_t renderedPx = perFrame(run.display.renderedPixels, run.frames);
+    const uint64_t flushedPx = perFrame(run.display.flushedPixels, run.frames);
+    const double area = (100.0 * renderedPx) / screenPixels;
+    const double mpxPerSecond =
+        renderUsTotal > 0U ? static_cast<double>(run.display.renderedPixels) / renderUsTotal : 0.0;
+    printf("%-10s %6lu %5.1f %9llu %9lu %9llu %10llu %6.1f %8.2f %10llu\n", result.name,
+           static_cast<unsigned long>(run.frames), fps, static_cast<unsigned long long>(frameUs),
+           static_cast<unsigned long>(run.frameUsMax), static_cast<unsigned long long>(flushUs),
+           static_cast<unsigned long long>(renderedPx), area, mpxPerSecond,
+           static_cast<unsigned long long>(result.switchUs));
+    if (csv != nullptr) {
+      fprintf(csv, "%s,%lu,%.2f,%llu,%lu,%llu,%llu,%llu,%llu,%.2f,%.3f,%llu\n", result.name,
+              static_cast<unsigned long>(run.frames), fps,
+              static_cast<unsigned long long>(frameUs),
+              static_cast<unsigned long>(run.frameUsMax),
+              static_cast<unsigned long long>(flushUs),
+              static_cast<unsigned long long>(perFrame(renderUsTotal, run.frames)),
+              static_cast<unsigned long long>(renderedPx),
+              static_cast<unsigned long long>(flushedPx), area, mpxPerSecond,
+              static_cast<unsigned long long>(result.switchUs));
+    }
+  }
+}
+
+int usage(const char *program) {
+  fprintf(stderr,
+          "usage: %s [--seconds n] [--png dir] [--csv file] [--max-frame-us n]\n", program);
+  return 1;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  uint32_t seconds = 10;
+  const char *pngDir = nullptr;
+  const char *csvPath = nullptr;
+  uint32_t maxFrameUs = 0;
+  for (int i = 1; i < argc; ++i) {
+    if (i + 1 >= argc) {
+      return usage(argv[0]);
+    }
+    if (strcmp(argv[i], "--seconds") == 0) {
+      seconds = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--png") == 0) {
+      pngDir = argv[++i];
+    } else if (strcmp(argv[i], "--csv") == 0) {
+      csvPath = argv[++i];
+    } else if (strcmp(argv[i], "--max-frame-us") == 0) {
+      maxFrameUs = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+    } else {
+      return usage(argv[0]);
+    }
+  }
+  if (seconds == 0U) {
+    return usage(argv[0]);
+  }
+
+  // Start late enough that the prefilled history has positive timestamps.
+  hostAdvanceMs((kPrefillHours + 1U) * 3600U * 1000U);
+  TrendStore trends;
+  trends.begin();
+  Scenario scenario(trends);
+  scenario.prefill(millis(), kPrefillHours);
+
+  uiEventsBegin();
+  UiManager ui;
+  ui.begin();
+  ui.setWaveformSource(&scenario.waveform());
+  ui.setTrendStore(&trends);
+  Totals startup;
+  run(ui, scenario, kSettleMs, startup);
+
+  std::vector<PageResult> results;
+  bool overBudget = false;
+  for (const Page &page : kPages) {
+    PageResult result;
+    result.name = page.name;
+    Totals switching;
+    tap(ui, scenario, page.navX, kNavY, switching);
+    result.switchUs = switching.tickUsTotal;
+    result.virtualMs = seconds * 1000U;
+    run(ui, scenario, result.virtualMs, result.run);
+    if (maxFrameUs > 0U && perFrame(result.run.frameUsTotal, result.run.frames) > maxFrameUs) {
+      overBudget = true;
+    }
+    if (pngDir != nullptr) {
+      const std::string path = std::string(pngDir) + "/" + page.name + ".png";
+      if (!writePng(path.c_str(), hostFramebuffer(), cfg::kDisplayWidth, cfg::kDisplayHeight)) {
+        fprintf(stderr, "cannot write %s\n", path.c_str());
+        return 1;
+      }
+    }
+    results.push_back(result);
+  }
+
+  FILE *csv = nullptr;
+  if (csvPath != nullptr) {
+    csv = fopen(csvPath, "w");
+    if (csv == nullptr) {
+      fprintf(stderr, "cannot write %s\n", csvPath);
+      return 1;
+    }
+  }
+  report(results, csv);
+  if (csv != nullptr) {
+    fclose(csv);
+  }
+  if (overBudget) {
+    fprintf(stderr, "mean frame time above %lu us\n", static_cast<unsigned long>(maxFrameUs));
+    return 2;
+  }
+  return 0;
+}
@@ -0,0 +1,696 @@
+#include "usb_capture.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "recording_format.h"
+#include "sample_codec.h"
+#include "usb_protocol.h"
+
+namespace ergo {
+
+namespace {
+
+constexpr int kHelloTimeoutMs = 1000;
+constexpr int kHelloAttempts = 3;
+constexpr int kAckTimeoutMs = 1000;
+// Longer than the band waits for a stalled host (cfg::kUsbHostTimeoutMs)
+// before it drops back to the text console.
+constexpr double kCaptureSilenceS = 5.0;
+// Same shape as the firmware's recordings (cfg::kRawBlockFrames,
+// cfg::kIndexIntervalMs).
+constexpr uint16_t kBlockFrames = 100;
+constexpr uint32_t kIndexIntervalMs = 60000;
+constexpr uint32_t kVitalsPeriodMs = 1000;
+// cfg::kStatusVitalsValid.
+constexpr uint8_t kStatusVitalsValid = 1U << 0;
+
+volatile std::sig_atomic_t g_stop = 0;
+
+void onSignal(int) { g_stop = 1; }
+
+double steadySeconds() {
+  using namespace std::chrono;
+  return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+const char *statusName(UsbStatus status) {
+  switch (status) {
+    case UsbStatus::Ok:
+      return "ok";
+    case UsbStatus::Failed:
+      return "failed";
+    case UsbStatus::Unknown:
+      return "unknown command";
+    case UsbStatus::Malformed:
+      return "malformed";
+  }
+  return "?";
+}
+
+class SerialPort {
+ public:
+  ~SerialPort() {
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+  }
+
+  bool open(const char *path) {
+    fd_ = ::open(path, O_RDWR | O_NOCTTY);
+    if (fd_ < 0) {
+      return false;
+    }
+    // USB CDC ignores the baud rate; raw mode keeps the tty layer from
+    // touching the bytes.
+    termios tio;
+    if (tcgetattr(fd_, &tio) == 0) {
+      cfmakeraw(&tio);
+      cfsetspeed(&tio, B115200);
+      tcsetattr(fd_, TCSANOW, &tio);
+    }
+    tcflush(fd_, TCIFLUSH);
+    return true;
+  }
+
+  bool write(const uint8_t *data, size_t size) {
+    while (size > 0U) {
+      const ssize_t written = ::write(fd_, data, size);
+      if (written < 0) {
+        if (errno == EINTR || errno == EAGAIN) {
+          continue;
+        }
+        return false;
+      }
+      data += written;
+      size -= static_cast<size_t>(written);
+    }
+    return true;
+  }
+
+  // Bytes read, 0 after `timeoutMs` without any, -1 when the port is gone.
+  ssize_t read(uint8_t *data, size_t capacity, int timeoutMs) {
+    pollfd descriptor = {fd_, POLLIN, 0};
+    const int ready = poll(&descriptor, 1, timeoutMs);
+    if (ready < 0) {
+      return errno == EINTR ? 0 : -1;
+    }
+    if (ready == 0) {
+      return 0;
+    }
+    const ssize_t count = ::read(fd_, data, capacity);
+    if (count < 0) {
+      return errno == EINTR || errno == EAGAIN ? 0 : -1;
+    }
+    // Readable but empty: the other end hung up.
+    return count == 0 ? -1 : count;
+  }
+
+ private:
+  int fd_ = -1;
+};
+
+// Frames to and from the band. Acks, Info and Log frames are handled here;
+// everything else goes to the handler.
+class UsbHost {
+ public:
+  using FrameHandler = std::function<void(const UsbFrameDecoder &frame)>;
+
+  explicit UsbHost(SerialPort &port) : port_(port) {}
+
+  void setHandler(FrameHandler handler) { handler_ = std::move(handler); }
+
+  bool send(UsbMessage type, const uint8_t *payload, size_t size, uint16_t &sequence) {
+    uint8_t encoded[kUsbMaxEncodedFrame];
+    sequence = txSequence_++;
+    const size_t length = encodeUsbFrame(type, sequence, payload, size, encoded, sizeof(encoded));
+    return length > 0U && port_.write(encoded, length);
+  }
+
+  // Reads for up to `timeoutMs`; false once the port is gone.
+  bool pump(int timeoutMs) {
+    uint8_t buffer[4096];
+    const ssize_t count = port_.read(buffer, sizeof(buffer), timeoutMs);
+    if (count < 0) {
+      return false;
+    }
+    for (ssize_t i = 0; i < count; ++i) {
+      if (decoder_.push(buffer[i])) {
+        dispatch();
+      }
+    }
+    return true;
+  }
+
+  // Switches the band to binary mode. A leading delimiter ends whatever
+  // half-typed text line was in its buffer.
+  bool hello() {
+    for (int attempt = 0; attempt < kHelloAttempts && !attached_; ++attempt) {
+      const uint8_t flush = 0;
+      uint16_t sequence = 0;
+      if (!port_.write(&flush, 1) || !send(UsbMessage::Hello, nullptr, 0, sequence)) {
+        return false;
+      }
+      const double deadline = steadySeconds() + kHelloTimeoutMs / 1000.0;
+      while (!attached_ && steadySeconds() < deadline) {
+        if (!pump(50)) {
+          return false;
+        }
+      }
+    }
+    return attached_;
+  }
+
+  // Sends a request and waits for its Ack, handling other frames meanwhile.
+  bool request(UsbMessage type, const uint8_t *payload, size_t size, UsbStatus &status) {
+    uint16_t sequence = 0;
+    if (!send(type, payload, size, sequence)) {
+      return false;
+    }
+    ackReceived_ = false;
+    waitingFor_ = sequence;
+    const double deadline = steadySeconds() + kAckTimeoutMs / 1000.0;
+    while (!ackReceived_ && steadySeconds() < deadline) {
+      if (!pump(50)) {
+        return false;
+      }
+    }
+    status = ackStatus_;
+    return ackReceived_;
+  }
+
+  const std::string &deviceName() const { return deviceName_; }
+  uint8_t version() const { return version_; }
+  // Device frames missing from its sequence since Info.
+  uint32_t lostFrames() const { return lostFrames_; }
+  uint32_t errors() const { return decoder_.errors() - errorsBase_; }
+
+ private:
+  void dispatch() {
+    const UsbMessage type = decoder_.type();
+    if (type == UsbMessage::Info) {
+      if (decoder_.payloadSize() >= kUsbInfoHeaderSize) {
+        version_ = decoder_.payload()[0];
+        deviceName_.assign(reinterpret_cast<const char *>(decoder_.payload()) + kUsbInfoHeaderSize,
+                           decoder_.payloadSize() - kUsbInfoHeaderSize);
+      }
+      // Frames and garbage before Info belong to the text console.
+      attached_ = true;
+      nextSequence_ = static_cast<uint16_t>(decoder_.sequence() + 1U);
+      errorsBase_ = decoder_.errors();
+      return;
+    }
+    if (!attached_) {
+      return;
+    }
+    lostFrames_ += static_cast<uint16_t>(decoder_.sequence() - nextSequence_);
+    nextSequence_ = static_cast<uint16_t>(decoder_.sequence() + 1U);
+
+    UsbAck ack;
+    if (type == UsbMessage::Ack && parseUsbAck(decoder_.payload(), decoder_.payloadSize(), ack)) {
+      if (ack.requestSequence == waitingFor_) {
+        ackReceived_ = true;
+        ackStatus_ = ack.status;
+      }
+    } else if (type == UsbMessage::Log) {
+      fprintf(stderr, "band: %.*s\n", static_cast<int>(decoder_.payloadSize()),
+              reinterpret_cast<const char *>(decoder_.payload()));
+    } else if (handler_) {
+      handler_(decoder_);
+    }
+  }
+
+  SerialPort &port_;
+  UsbFrameDecoder decoder_;
+  FrameHandler handler_;
+  uint16_t txSequence_ = 0;
+  bool attached_ = false;
+  uint8_t version_ = 0;
+  std::string deviceName_;
+  uint16_t nextSequence_ = 0;
+  uint32_t lostFrames_ = 0;
+  uint32_t errorsBase_ = 0;
+  uint16_t waitingFor_ = 0;
+  bool ackReceived_ = false;
+  UsbStatus ackStatus_ = UsbStatus::Ok;
+};
+
+// Writes a capture the way the recorder does: 100-frame raw blocks, a minute
+// Index block built from the 1 Hz vitals, then the index table and footer.
+// There is no CSV next to it, so csvOffset stays 0.
+class CaptureWriter {
+ public:
+  ~CaptureWriter() {
+    if (erg_ != nullptr) {
+      fclose(erg_);
+    }
+  }
+
+  bool open(const std::string &path, uint32_t startMs) {
+    erg_ = fopen(path.c_str(), "wb");
+    if (erg_ == nullptr) {
+      return false;
+    }
+    // The host clock stands in for the band's RTC.
+    const time_t now = time(nullptr);
+    tm local;
+    localtime_r(&now, &local);
+    FileHeader header;
+    header.startMs = startMs;
+    header.rtcValid = 1;
+    header.year = static_cast<uint16_t>(local.tm_year + 1900);
+    header.month = static_cast<uint8_t>(local.tm_mon + 1);
+    header.day = static_cast<uint8_t>(local.tm_mday);
+    header.hour = static_cast<uint8_t>(local.tm_hour);
+    header.minute = static_cast<uint8_t>(local.tm_min);
+    header.second = static_cast<uint8_t>(local.tm_sec);
+    uint8_t encoded[kFileHeaderSize];
+    serializeFileHeader(header, encoded);
+    fwrite(encoded, 1, sizeof(encoded), erg_);
+    minute_.reset(startMs, 0, kFileHeaderSize);
+    session_.reset(startMs, 0, kFileHeaderSize);
+    lastMs_ = startMs;
+    return true;
+  }
+
+  bool isOpen() const { return erg_ != nullptr; }
+
+  void addSample(const StreamSample &sample) {
+    int32_t *frame = &frames_[frameCount_ * kRawChannelCount];
+    frame[kRawChannelTimestampMs] = static_cast<int32_t>(sample.timestampMs);
+    frame[kRawChannelIr] = static_cast<int32_t>(sample.ir);
+    frame[kRawChannelRed] = static_cast<int32_t>(sample.red);
+    frame[kRawChannelAccelXmg] = sample.accelXmg;
+    frame[kRawChannelAccelYmg] = sample.accelYmg;
+    frame[kRawChannelAccelZmg] = sample.accelZmg;
+    lastMs_ = sample.timestampMs;
+    if (++frameCount_ == kBlockFrames) {
+      writeRawBlock();
+    }
+  }
+
+  void addVitals(const UsbDiagnostics &diagnostics) {
+    const uint32_t nowMs = diagnostics.timestampMs;
+    if (nowMs - minute_.summary().startMs >= kIndexIntervalMs) {
+      writeRawBlock();
+      uint8_t entry[kIntervalSummarySize];
+      serializeIntervalSummary(minute_.summary(), entry);
+      writeBlock(BlockType::Index, minute_.summary().startMs, entry, sizeof(entry));
+      index_.push_back(minute_.summary());
+      minute_.reset(nowMs, 0, static_cast<uint32_t>(ftell(erg_)));
+    }
+    const bool valid = (diagnostics.status & kStatusVitalsValid) != 0U;
+    minute_.add(nowMs, valid, diagnostics.hr, diagnostics.spo2X100, diagnostics.motionX1000);
+    session_.add(nowMs, valid, diagnostics.hr, diagnostics.spo2X100, diagnostics.motionX1000);
+  }
+
+  // Returns the file size.
+  long close() {
+    if (erg_ == nullptr) {
+      return 0;
+    }
+    writeRawBlock();
+    FooterInfo footer;
+    footer.session = session_.summary();
+    footer.indexTableOffset = static_cast<uint32_t>(ftell(erg_));
+    footer.indexEntryCount = static_cast<uint32_t>(index_.size());
+    std::vector<uint8_t> table(index_.size() * kIntervalSummarySize);
+    for (size_t i = 0; i < index_.size(); ++i) {
+      serializeIntervalSummary(index_[i], table.data() + i * kIntervalSummarySize);
+    }
+    writeBlock(BlockType::IndexTable, footer.session.startMs, table.data(), table.size());
+    uint8_t encodedFooter[kFooterPayloadSize];
+    serializeFooter(footer, encodedFooter);
+    writeBlock(BlockType::Footer, lastMs_, encodedFooter, sizeof(encodedFooter));
+    const long size = ftell(erg_);
+    fclose(erg_);
+    erg_ = nullptr;
+    return size;
+  }
+
+ private:
+  void writeRawBlock() {
+    if (frameCount_ == 0U) {
+      return;
+    }
+    uint8_t payload[maxEncodedBlockSize(kRawChannelCount, kBlockFrames)];
+    const size_t size =
+        encodeSampleBlock(frames_, kRawChannelCount, frameCount_, payload, sizeof(payload));
+    writeBlock(BlockType::RawSamples, static_cast<uint32_t>(frames_[kRawChannelTimestampMs]),
+               payload, size, kRawChannelCount, frameCount_);
+    frameCount_ = 0;
+  }
+
+  void writeBlock(BlockType type, uint32_t timestampMs, const uint8_t *payload, size_t size,
+                  uint8_t channels = 0, uint16_t samples = 0) {
+    BlockHeader header;
+    header.type = type;
+    header.channels = channels;
+    header.sampleCount = samples;
+    header.firstSampleMs = timestampMs;
+    header.payloadBytes = static_cast<uint32_t>(size);
+    header.crc = blockCrc(header, payload, size);
+    uint8_t encoded[kBlockHeaderSize];
+    serializeBlockHeader(header, encoded);
+    fwrite(encoded, 1, sizeof(encoded), erg_);
+    if (size > 0U) {
+      fwrite(payload, 1, size, erg_);
+    }
+  }
+
+  FILE *erg_ = nullptr;
+  int32_t frames_[kBlockFrames * kRawChannelCount] = {};
+  uint16_t frameCount_ = 0;
+  uint32_t lastMs_ = 0;
+  SummaryAccumulator minute_;
+  SummaryAccumulator session_;
+  std::vector<IntervalSummary> index_;
+};
+
+void writeDiagnosticsRow(FILE *csv, const UsbDiagnostics &d) {
+  fprintf(csv, "%lu,%u,%u,%u,%u,0x%02X,%u,%u,%u,%u,%u,%lu,%lu,%lu,%d,%d,%d,%u,%u\n",
+          static_cast<unsigned long>(d.timestampMs), d.hr, d.spo2X100, d.rriMs, d.hrvMs,
+          d.status, (d.flags & kUsbDiagImuReady) != 0U, (d.flags & kUsbDiagFingerPresent) != 0U,
+          (d.flags & kUsbDiagPeakDetected) != 0U, (d.flags & kUsbDiagRriAccepted) != 0U,
+          d.motionState, static_cast<unsigned long>(d.irRaw),
+          static_cast<unsigned long>(d.redRaw), static_cast<unsigned long>(d.irFiltered),
+          d.accelXmg, d.accelYmg, d.accelZmg, d.accelMagnitudeMg, d.motionX1000);
+}
+
+// The stack columns follow the first frame's task list; a later frame with
+// other tasks is written in its own order under the same header.
+void writePerfRow(FILE *csv, const UsbPerf &p, bool header) {
+  if (header) {
+    fprintf(csv,
+            "timestamp_ms,period_ms,frames,render_avg_us,render_max_us,flush_avg_us,"
+            "flush_max_us,missed_deadlines,lvgl_used,lvgl_max_used,lvgl_total,lvgl_frag_pct,"
+            "internal_free,internal_min_free,internal_largest,psram_free");
+    for (uint8_t i = 0; i < p.taskCount; ++i) {
+      fprintf(csv, ",stack_%s", p.tasks[i].name);
+    }
+    fprintf(csv, "\n");
+  }
+  fprintf(csv, "%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%u,%lu,%lu,%lu,%lu",
+          static_cast<unsigned long>(p.timestampMs), static_cast<unsigned long>(p.periodMs),
+          static_cast<unsigned long>(p.frames), static_cast<unsigned long>(p.renderUsAvg),
+          static_cast<unsigned long>(p.renderUsMax), static_cast<unsigned long>(p.flushUsAvg),
+          static_cast<unsigned long>(p.flushUsMax),
+          static_cast<unsigned long>(p.missedDeadlines),
+          static_cast<unsigned long>(p.lvglUsedBytes),
+          static_cast<unsigned long>(p.lvglMaxUsedBytes),
+          static_cast<unsigned long>(p.lvglTotalBytes), p.lvglFragPct,
+          static_cast<unsigned long>(p.internalFreeBytes),
+          static_cast<unsigned long>(p.internalMinFreeBytes),
+          static_cast<unsigned long>(p.internalLargestBlock),
+          static_cast<unsigned long>(p.psramFreeBytes));
+  for (uint8_t i = 0; i < p.taskCount; ++i) {
+    fprintf(csv, ",%lu", static_cast<unsigned long>(p.tasks[i].minFreeBytes));
+  }
+  fprintf(csv, "\n");
+}
+
+bool attach(SerialPort &serial, UsbHost &host, const char *port) {
+  if (!serial.open(port)) {
+    fprintf(stderr, "%s: %s\n", port, strerror(errno));
+    return false;
+  }
+  if (!host.hello()) {
+    fprintf(stderr, "%s: no answer to Hello; is the band's firmware current?\n", port);
+    return false;
+  }
+  fprintf(stderr, "attached to %s (protocol v%u)\n", host.deviceName().c_str(),
+          host.version());
+  return true;
+}
+
+// Runs one request and reports a missing or negative Ack.
+bool run(UsbHost &host, UsbMessage type, const uint8_t *payload, size_t size,
+         const char *what) {
+  UsbStatus status = UsbStatus::Ok;
+  if (!host.request(type, payload, size, status)) {
+    fprintf(stderr, "%s: no ack\n", what);
+    return false;
+  }
+  if (status != UsbStatus::Ok) {
+    fprintf(stderr, "%s: %s\n", what, statusName(status));
+    return false;
+  }
+  return true;
+}
+
+void detach(UsbHost &host) {
+  UsbStatus status = UsbStatus::Ok;
+  host.request(UsbMessage::Bye, nullptr, 0, status);
+}
+
+}  // namespace
+
+int usbCapture(const char *port, const char *base, double seconds) {
+  SerialPort serial;
+  UsbHost host(serial);
+  if (!attach(serial, host, port)) {
+    return 1;
+  }
+
+  const std::string ergPath = std::string(base) + ".erg";
+  const std::string diagPath = std::string(base) + ".diag.csv";
+  const std::string perfPath = std::string(base) + ".perf.csv";
+  FILE *diagnosticsCsv = fopen(diagPath.c_str(), "wb");
+  if (diagnosticsCsv == nullptr) {
+    fprintf(stderr, "cannot create %s\n", diagPath.c_str());
+    return 1;
+  }
+  FILE *perfCsv = fopen(perfPath.c_str(), "wb");
+  if (perfCsv == nullptr) {
+    fprintf(stderr, "cannot create %s\n", perfPath.c_str());
+    fclose(diagnosticsCsv);
+    return 1;
+  }
+  fprintf(diagnosticsCsv,
+          "timestamp_ms,hr,spo2_x100,rri,hrv,status,imu_ready,finger_present,"
+          "peak_detected,rri_accepted,motion_state,ir_raw,red_raw,ir_filtered,"
+          "acc_x_mg,acc_y_mg,acc_z_mg,acc_mag_mg,motion_x1000\n");
+
+  CaptureWriter writer;
+  bool writeFailed = false;
+  bool samplesStarted = false;
+  uint32_t nextSampleIndex = 0;
+  uint64_t samples = 0;
+  uint64_t samplesLost = 0;
+  uint64_t diagnosticsFrames = 0;
+  bool vitalsStarted = false;
+  uint32_t nextVitalsMs = 0;
+  UsbCounters counters;
+  bool haveCounters = false;
+  UsbPerf perf;
+  uint64_t perfFrames = 0;
+  const auto ensureOpen = [&](uint32_t timestampMs) {
+    if (!writer.isOpen() && !writeFailed && !writer.open(ergPath, timestampMs)) {
+      fprintf(stderr, "cannot create %s\n", ergPath.c_str());
+      writeFailed = true;
+    }
+    return writer.isOpen();
+  };
+
+  double lastFrame = steadySeconds();
+  host.setHandler([&](const UsbFrameDecoder &frame) {
+    lastFrame = steadySeconds();
+    switch (frame.type()) {
+      case UsbMessage::Samples: {
+        uint32_t firstIndex = 0;
+        size_t count = 0;
+        if (!parseUsbSamples(frame.payload(), frame.payloadSize(), firstIndex, count) ||
+            count == 0U) {
+          break;
+        }
+        StreamSample sample;
+        parseUsbSample(frame.payload() + kUsbSamplesHeaderSize, sample);
+        if (!ensureOpen(sample.timestampMs)) {
+          break;
+        }
+        // Samples the band lost before they reached the link.
+        if (samplesStarted && firstIndex - nextSampleIndex < 0x80000000U) {
+          samplesLost += firstIndex - nextSampleIndex;
+        }
+        samplesStarted = true;
+        nextSampleIndex = firstIndex + static_cast<uint32_t>(count);
+        for (size_t i = 0; i < count; ++i) {
+          parseUsbSample(frame.payload() + kUsbSamplesHeaderSize + i * kUsbSampleSize, sample);
+          writer.addSample(sample);
+        }
+        samples += count;
+        break;
+      }
+      case UsbMessage::Diagnostics: {
+        UsbDiagnostics diagnostics;
+        if (!parseUsbDiagnostics(frame.payload(), frame.payloadSize(), diagnostics)) {
+          break;
+        }
+        ++diagnosticsFrames;
+        writeDiagnosticsRow(diagnosticsCsv, diagnostics);
+        if (ensureOpen(diagnostics.timestampMs) &&
+            (!vitalsStarted ||
+             static_cast<int32_t>(diagnostics.timestampMs - nextVitalsMs) >= 0)) {
+          writer.addVitals(diagnostics);
+          nextVitalsMs = (vitalsStarted ? nextVitalsMs : diagnostics.timestampMs) +
+                         kVitalsPeriodMs;
+          vitalsStarted = true;
+        }
+        break;
+      }
+      case UsbMessage::Counters:
+        haveCounters = parseUsbCounters(frame.payload(), frame.payloadSize(), counters);
+        break;
+      case UsbMessage::Perf:
+        if (parseUsbPerf(frame.payload(), frame.payloadSize(), perf)) {
+          writePerfRow(perfCsv, perf, perfFrames == 0U);
+          ++perfFrames;
+        }
+        break;
+      default:
+        break;
+    }
+  });
+
+  if (!run(host, UsbMessage::StartCapture, nullptr, 0, "start capture")) {
+    fclose(diagnosticsCsv);
+    fclose(perfCsv);
+    return 1;
+  }
+  g_stop = 0;
+  signal(SIGINT, onSignal);
+  const double start = steadySeconds();
+  double nextReport = start + 1.0;
+  lastFrame = start;
+  bool portGone = false;
+  bool silent = false;
+  while (g_stop == 0 && !writeFailed && (seconds <= 0.0 || steadySeconds() - start < seconds)) {
+    if (!host.pump(100)) {
+      portGone = true;
+      break;
+    }
+    if (steadySeconds() - lastFrame >= kCaptureSilenceS) {
+      silent = true;
+      break;
+    }
+    if (steadySeconds() >= nextReport) {
+      nextReport += 1.0;
+      fprintf(stderr, "capture: %.0f s, %llu samples, %llu lost, %u frames lost, %u errors",
+              steadySeconds() - start, static_cast<unsigned long long>(samples),
+              static_cast<unsigned long long>(samplesLost), host.lostFrames(), host.errors());
+      if (haveCounters) {
+        fprintf(stderr, " | band: backlog %u, stalls %u, dropped %u, pump max %u us",
+                counters.samplesBacklog, counters.txStalls, counters.framesDropped,
+                counters.pumpMaxUs);
+      }
+      fprintf(stderr, "\n");
+    }
+  }
+  signal(SIGINT, SIG_DFL);
+  const double elapsed = steadySeconds() - start;
+
+  // Samples sent before the ack arrive before it.
+  if (!portGone && !silent) {
+    run(host, UsbMessage::StopCapture, nullptr, 0, "stop capture");
+    detach(host);
+  }
+  const long ergBytes = writer.close();
+  fclose(diagnosticsCsv);
+  fclose(perfCsv);
+
+  fprintf(stderr,
+          "capture: %.1f s, %llu samples (%.1f Hz), %llu lost on the band, %u frames lost, "
+          "%u bad frames, %llu diagnostics\n",
+          elapsed, static_cast<unsigned long long>(samples),
+          elapsed > 0.0 ? static_cast<double>(samples) / elapsed : 0.0,
+          static_cast<unsigned long long>(samplesLost), host.lostFrames(), host.errors(),
+          static_cast<unsigned long long>(diagnosticsFrames));
+  if (haveCounters) {
+    fprintf(stderr,
+            "band: %u samples sent, %u dropped, %u frames (%u bytes), %u stalls, "
+            "%u frames dropped, pump max %u us, heap %u (min %u)\n",
+            counters.samplesSent, counters.samplesDropped, counters.framesSent,
+            counters.bytesSent, counters.txStalls, counters.framesDropped, counters.pumpMaxUs,
+            counters.freeHeap, counters.minFreeHeap);
+  }
+  if (perfFrames > 0U) {
+    fprintf(stderr,
+            "ui: %lu frames in the last %lu ms, render max %lu us, flush max %lu us, "
+            "%lu missed; LVGL %lu/%lu bytes, PSRAM free %lu\n",
+            static_cast<unsigned long>(perf.frames), static_cast<unsigned long>(perf.periodMs),
+            static_cast<unsigned long>(perf.renderUsMax),
+            static_cast<unsigned long>(perf.flushUsMax),
+            static_cast<unsigned long>(perf.missedDeadlines),
+            static_cast<unsigned long>(perf.lvglUsedBytes),
+            static_cast<unsigned long>(perf.lvglTotalBytes),
+            static_cast<unsigned long>(perf.psramFreeBytes));
+  }
+  fprintf(stderr, "wrote %s (%ld bytes), %s and %s\n", ergPath.c_str(), ergBytes,
+          diagPath.c_str(), perfPath.c_str());
+  if (portGone) {
+    fprintf(stderr, "%s: port closed during capture\n", port);
+  }
+  if (silent) {
+    fprintf(stderr, "%s: band stopped sending for %.0f s\n", port, kCaptureSilenceS);
+  }
+  return portGone || silent || writeFailed ? 1 : 0;
+}
+
+int usbCommand(const char *port, const char *line) {
+  SerialPort serial;
+  UsbHost host(serial);
+  if (!attach(serial, host, port)) {
+    return 1;
+  }
+  const bool ok = run(host, UsbMessage::Command, reinterpret_cast<const uint8_t *>(line),
+                      strlen(line), line);
+  // Let the band's log line about the command come through.
+  host.pump(200);
+  detach(host);
+  if (ok) {
+    fprintf(stderr, "%s: ok\n", line);
+  }
+  return ok ? 0 : 1;
+}
+
+int usbSetRtc(const char *port) {
+  SerialPort serial;
+  UsbHost host(serial);
+  if (!attach(serial, host, port)) {
+    return 1;
+  }
+  const time_t now = time(nullptr);
+  tm local;
+  localtime_r(&now, &local);
+  UsbDateTime dateTime;
+  dateTime.year = static_cast<uint16_t>(local.tm_year + 1900);
+  dateTime.month = static_cast<uint8_t>(local.tm_mon + 1);
+  dateTime.day = static_cast<uint8_t>(local.tm_mday);
+  dateTime.hour = static_cast<uint8_t>(local.tm_hour);
+  dateTime.minute = static_cast<uint8_t>(local.tm_min);
+  dateTime.second = static_cast<uint8_t>(local.tm_sec);
+  uint8_t payload[kUsbDateTimeSize];
+  serializeUsbDateTime(dateTime, payload);
+  const bool ok = run(host, UsbMessage::SetRtc, payload, sizeof(payload), "set RTC");
+  host.pump(200);
+  detach(host);
+  if (ok) {
+    fprintf(stderr, "RTC set to %04u-%02u-%02u %02u:%02u:%02u\n", dateTime.year,
+            dateTime.month, dateTime.day, dateTime.hour, dateTime.minute, dateTime.second);
+  }
+  return ok ? 0 : 1;
+}
+
+}  // namespace ergo
@@ -0,0 +1,21 @@
+#pragma once
+
+// Host side of the USB CDC binary protocol (usb_protocol.h) on POSIX serial
+// ports: bench captures written straight to the .erg recording format, and
+// console commands with an acknowledged result.
+
+namespace ergo {
+
+// Streams samples, diagnostics, counters and perf snapshots until `seconds`
+// pass (0 = until Ctrl-C). Writes <base>.erg (raw blocks, minute index,
+// footer), <base>.diag.csv (one row per diagnostics frame) and
+// <base>.perf.csv (one row per perf frame, about one a second).
+int usbCapture(const char *port, const char *base, double seconds);
+
+// Runs one console command line (RTC=..., LOG=...) and prints its status.
+int usbCommand(const char *port, const char *line);
+
+// Sets the band's RTC to this host's local time.
+int usbSetRtc(const char *port);
+
+}  // namespace ergo